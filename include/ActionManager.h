@@ -18,6 +18,7 @@
 #define ACTION_MANAGER_H_
 
 #include <queue>
+#include <vector>
 #include <pthread.h>
 #include <ctime>
 #include <string>
@@ -54,6 +55,17 @@ public:
         return new ActionRequest(_type);
     }
 
+    /**
+     *  Key used to order actions when the ActionManager uses worker threads.
+     *  Actions with the same key are executed, in order, by the same worker.
+     *  Actions with a negative key are executed by the manager thread.
+     *    @return the action key (e.g. the VM ID)
+     */
+    virtual int key() const
+    {
+        return -1;
+    }
+
 protected:
     Type _type;
 };
@@ -117,6 +129,8 @@ private:
 };
 
 
+extern "C" void * action_worker_loop(void *arg);
+
 /**
  *  ActionManager. Provides action support for a class implementing
  *  the ActionListener interface.
@@ -125,7 +139,12 @@ class ActionManager
 {
 public:
 
-    ActionManager();
+    /**
+     *  @param num_workers number of threads to execute USER actions. When
+     *  greater than 1, USER actions are hashed by their key onto the worker
+     *  threads; otherwise every action is executed by the loop thread.
+     */
+    ActionManager(unsigned int num_workers = 1);
 
     virtual ~ActionManager();
 
@@ -212,11 +231,32 @@ public:
     };
 
 private:
+    /**
+     *  Worker thread and its queue of pending actions, processed in a FIFO
+     *  manner
+     */
+    struct ActionWorker
+    {
+        ActionManager *             am;
+
+        std::queue<ActionRequest *> actions;
+
+        pthread_mutex_t             mutex;
+        pthread_cond_t              cond;
+
+        pthread_t                   thread;
+    };
+
     /**
      *  Queue of pending actions, processed in a FIFO manner
      */
     std::queue<ActionRequest *> actions;
 
+    /**
+     *  Worker threads, empty if actions are executed by the loop thread
+     */
+    std::vector<ActionWorker *> workers;
+
     /**
      *  Action synchronization is implemented using the pthread library,
      *  with condition variable and its associated mutex
@@ -245,6 +285,28 @@ private:
         pthread_mutex_unlock(&mutex);
     };
 
+    /**
+     *  Adds an action to the queue of the given worker
+     */
+    void trigger(ActionWorker * aw, ActionRequest * ar);
+
+    /**
+     *  Starts the worker threads
+     */
+    void start_workers();
+
+    /**
+     *  Sends FINALIZE to the worker threads and waits for them to drain their
+     *  queues
+     */
+    void stop_workers();
+
+    /**
+     *  Action loop of a worker thread, ends when FINALIZE is received
+     */
+    void worker_loop(ActionWorker * aw);
+
+    friend void * action_worker_loop(void *arg);
 };
 
 #endif /*ACTION_MANAGER_H_*/
@@ -23,6 +23,7 @@
 #include <algorithm>
 
 #include "NebulaUtil.h"
+#include "FlatMap.h"
 
 using namespace std;
 
@@ -78,6 +79,11 @@ public:
      */
     virtual string * marshall(const char * _sep = 0) const = 0;
 
+    /**
+     *  Same as above but the attribute is appended to the buffer
+     */
+    virtual void marshall(string& buffer, const char * _sep = 0) const = 0;
+
     /**
      *  Write the attribute using a simple XML format. The string MUST be freed
      *  by the calling function.
@@ -85,6 +91,11 @@ public:
      */
     virtual string * to_xml() const = 0;
 
+    /**
+     *  Same as above but the attribute is appended to the buffer
+     */
+    virtual void to_xml(string& buffer) const = 0;
+
     /**
      *  Builds a new attribute from a string.
      */
@@ -153,6 +164,11 @@ public:
         return rs;
     };
 
+    void marshall(string& buffer, const char * _sep = 0) const
+    {
+        buffer.append(attribute_value);
+    };
+
     /**
      *  Write the attribute using a simple XML format:
      *
@@ -165,12 +181,20 @@ public:
     {
         string * xml = new string;
 
-        *xml = "<" + name() + ">" + one_util::escape_xml(attribute_value) +
-               "</"+ name() + ">";
+        to_xml(*xml);
 
         return xml;
     }
 
+    void to_xml(string& buffer) const
+    {
+        buffer.append(1, '<').append(name()).append(1, '>');
+
+        buffer.append(one_util::escape_xml(attribute_value));
+
+        buffer.append("</").append(name()).append(1, '>');
+    }
+
     /**
      *  Builds a new attribute from a string.
      */
@@ -222,7 +246,7 @@ public:
 
     VectorAttribute(const string& name):Attribute(name){};
 
-    VectorAttribute(const string& name,const  map<string,string>& value):
+    VectorAttribute(const string& name,const  FlatMap<string,string>& value):
             Attribute(name),attribute_value(value){};
 
     VectorAttribute(const VectorAttribute& va):Attribute(va.attribute_name)
@@ -238,9 +262,10 @@ public:
     ~VectorAttribute(){};
 
     /**
-     *  Returns the attribute value, a string.
+     *  Returns the attribute values, sorted by name. It can be converted to a
+     *  map<string,string> if needed.
      */
-    const map<string,string>& value() const
+    const FlatMap<string,string>& value() const
     {
         return attribute_value;
     };
@@ -264,7 +289,7 @@ public:
     template<typename T>
     int vector_value(const string& name, T& value) const
     {
-        map<string,string>::const_iterator it;
+        FlatMap<string,string>::const_iterator it;
 
         it = attribute_value.find(name);
 
@@ -305,7 +330,7 @@ public:
     template<typename T>
     string vector_value_str(const string& name, T& value) const
     {
-        map<string,string>::const_iterator it;
+        FlatMap<string,string>::const_iterator it;
 
         it = attribute_value.find(name);
 
@@ -338,6 +363,11 @@ public:
      */
     string * marshall(const char * _sep = 0) const;
 
+    /**
+     *  Same as above but the attribute is appended to the buffer
+     */
+    void marshall(string& buffer, const char * _sep = 0) const;
+
     /**
      *  Write the attribute using a simple XML format:
      *
@@ -357,6 +387,11 @@ public:
      */
     void to_xml(ostringstream &oss) const;
 
+    /**
+     *  Same as above but the attribute is appended to the buffer
+     */
+    void to_xml(string& buffer) const;
+
     /**
      *  Builds a new attribute from a string of the form:
      *  "VAL_NAME_1=VAL_VALUE_1,...,VAL_NAME_N=VAL_VALUE_N".
@@ -366,7 +401,7 @@ public:
     /**
      *  Replace the value of the given attribute with the provided map
      */
-    void replace(const map<string,string>& attr);
+    void replace(const FlatMap<string,string>& attr);
 
     /**
      * The attributes from vattr will be copied to this vector
@@ -439,7 +474,7 @@ private:
 
     static const int    magic_sep_size;
 
-    map<string,string> attribute_value;
+    FlatMap<string,string> attribute_value;
 };
 
 #endif /*ATTRIBUTE_H_*/
@@ -17,7 +17,8 @@
 #ifndef BITMAP_H_
 #define BITMAP_H_
 
-#include <bitset>
+#include <vector>
+#include <stdint.h>
 
 #include "Attribute.h"
 #include "Callbackable.h"
@@ -25,8 +26,9 @@
 class SqlDB;
 
 /**
- *  This class represents a generic BitMap
- *
+ *  This class represents a generic BitMap. The map is stored as an array of
+ *  64-bit words so free bits are looked up a word at a time. Reserved bits
+ *  (and padding bits beyond N) are kept in a separate mask.
  */
 template <unsigned int N>
 class BitMap : public Callbackable
@@ -37,17 +39,26 @@ public:
      *  that MUST exists during the object lifetime.
      */
     BitMap(const VectorAttribute& bs_conf, int _id, const char * _db_table)
-        : id(_id), start_bit(0), bs(0), db_table(_db_table)
+        : id(_id), start_bit(0), first_word(0), bs(0), reserved(NWORDS, 0),
+          db_table(_db_table)
     {
-        std::string reserved;
+        std::string reserved_str;
 
         bs_conf.vector_value("START", start_bit);
-        bs_conf.vector_value("RESERVED", reserved);
+        bs_conf.vector_value("RESERVED", reserved_str);
 
-        if (!reserved.empty())
+        if (!reserved_str.empty())
         {
-            set_reserved_bit(reserved);
+            set_ranges(reserved_str, reserved);
         }
+
+        // Padding bits of the last word are never available
+        for (unsigned int bit = N; bit < NWORDS * 64; ++bit)
+        {
+            reserved[bit / 64] |= word_bit(bit);
+        }
+
+        first_word = start_bit / 64;
     };
 
     virtual ~BitMap()
@@ -79,7 +90,12 @@ public:
     int insert(int _id, SqlDB * db)
     {
         id = _id;
-        bs = new std::bitset<N>;
+
+        delete bs;
+
+        bs = new std::vector<uint64_t>(NWORDS, 0);
+
+        first_word = start_bit / 64;
 
         return insert_replace(db, false);
     }
@@ -101,11 +117,17 @@ public:
             return -1;
         }
 
-        bs = new std::bitset<N>(*uzbs);
+        delete bs;
+
+        bs = new std::vector<uint64_t>(NWORDS, 0);
+
+        int rc = from_string(*uzbs);
 
         delete uzbs;
 
-        return 0;
+        first_word = start_bit / 64;
+
+        return rc;
     }
 
     int update(SqlDB * db)
@@ -136,31 +158,48 @@ public:
      */
     int get(unsigned int hint, unsigned int& bit)
     {
-        if ( hint != 0 )
+        if ( hint != 0 && hint < N )
         {
-            if ( bs->test(hint) == false && reserved_bit.count(hint) == 0 )
+            uint64_t mask = word_bit(hint);
+            uint64_t used = (*bs)[hint / 64] | reserved[hint / 64];
+
+            if ( (used & mask) == 0 )
             {
-                bs->set(hint);
+                (*bs)[hint / 64] |= mask;
 
                 bit = hint;
                 return 0;
             }
         }
 
-        for (bit = start_bit; ; ++bit)
+        if ( start_bit >= N )
         {
-            try
+            return -1;
+        }
+
+        // Words below first_word have no free bits at or above start_bit
+        for (unsigned int w = first_word; w < NWORDS; ++w)
+        {
+            uint64_t free_bits = ~((*bs)[w] | reserved[w]);
+
+            if ( w == start_bit / 64 )
             {
-                if ( bs->test(bit) == false && reserved_bit.count(bit) == 0)
-                {
-                    bs->set(bit);
-                    return 0;
-                }
+                free_bits &= ~(word_bit(start_bit) - 1);
             }
-            catch (const std::out_of_range& oor)
+
+            if ( free_bits == 0 )
             {
-                return -1;
+                first_word = w + 1;
+                continue;
             }
+
+            first_word = w;
+
+            bit = w * 64 + __builtin_ctzll(free_bits);
+
+            (*bs)[w] |= word_bit(bit);
+
+            return 0;
         }
 
         return -1;
@@ -172,11 +211,17 @@ public:
      */
     void reset(int bit)
     {
-        try
+        if ( bit < 0 || (unsigned int) bit >= N )
+        {
+            return;
+        }
+
+        (*bs)[bit / 64] &= ~word_bit(bit);
+
+        if ( (unsigned int) bit >= start_bit && (unsigned int) bit / 64 < first_word )
         {
-            bs->reset(bit);
+            first_word = bit / 64;
         }
-        catch(const std::out_of_range& oor){};
     }
 
     /**
@@ -186,20 +231,21 @@ public:
      */
     int set(int bit)
     {
-        int rc = -1;
-
-        try
+        if ( bit < 0 || (unsigned int) bit >= N )
         {
-            if (bs->test(bit) == false)
-            {
-                bs->set(bit);
+            return -1;
+        }
 
-                rc = 0;
-            }
+        uint64_t mask = word_bit(bit);
+
+        if ( ((*bs)[bit / 64] & mask) != 0 )
+        {
+            return -1;
         }
-        catch(const std::out_of_range& oor){};
 
-        return rc;
+        (*bs)[bit / 64] |= mask;
+
+        return 0;
     }
 
     /**
@@ -211,6 +257,22 @@ public:
     }
 
 private:
+    /**
+     *  Number of 64-bit words needed to hold N bits
+     */
+    static const unsigned int NWORDS = (N + 63) / 64;
+
+    /**
+     *  Tag that prefixes the range-encoded form of the map. Legacy maps are
+     *  stored as the N character string of a std::bitset<N>.
+     */
+    static const char RANGES_TAG = 'R';
+
+    static uint64_t word_bit(unsigned int bit)
+    {
+        return static_cast<uint64_t>(1) << (bit % 64);
+    }
+
     /* ---------------------------------------------------------------------- */
     /* Bitmap configuration attributes                                        */
     /* ---------------------------------------------------------------------- */
@@ -218,9 +280,17 @@ private:
 
     unsigned int start_bit;
 
-    std::set<unsigned int> reserved_bit;
+    /**
+     *  Lowest word that may hold a free bit (at or above start_bit)
+     */
+    unsigned int first_word;
 
-    std::bitset<N> * bs;
+    std::vector<uint64_t> * bs;
+
+    /**
+     *  Reserved bits mask, it also includes the padding bits beyond N
+     */
+    std::vector<uint64_t> reserved;
 
     /* ---------------------------------------------------------------------- */
     /* Database implementation                                                */
@@ -306,7 +376,7 @@ private:
             oss << "INSERT ";
         }
 
-        std::string * zipped = one_util::zlib_compress(bs->to_string(), true);
+        std::string * zipped = one_util::zlib_compress(to_string(), true);
 
         if (zipped == 0)
         {
@@ -328,12 +398,111 @@ private:
     }
 
     /**
-     * The reserved bit string is separated by ',' for each element
-     * and by ':' for ranges.
-     *   @param string with reserved bits
+     *  Encodes the set bits of the map as a list of ranges, using the same
+     *  syntax as the RESERVED attribute (e.g. "R5900:5910,6000")
+     *    @return the string representation of the map
      */
+    std::string to_string()
+    {
+        std::ostringstream oss;
+
+        bool in_run = false;
+        bool first  = true;
+
+        unsigned int run_start = 0;
+
+        oss << RANGES_TAG;
+
+        for (unsigned int bit = 0; bit <= N; ++bit)
+        {
+            bool is_set = false;
+
+            if ( bit < N )
+            {
+                uint64_t word = (*bs)[bit / 64];
+
+                if ( !in_run && word >> (bit % 64) == 0 )
+                {
+                    bit |= 63; //skip the rest of the word
+                    continue;
+                }
+
+                is_set = (word & word_bit(bit)) != 0;
+            }
+
+            if ( is_set && !in_run )
+            {
+                run_start = bit;
+                in_run    = true;
+            }
+            else if ( !is_set && in_run )
+            {
+                if ( !first )
+                {
+                    oss << ",";
+                }
+
+                oss << run_start;
+
+                if ( bit - 1 != run_start )
+                {
+                    oss << ":" << bit - 1;
+                }
+
+                first  = false;
+                in_run = false;
+            }
+        }
+
+        return oss.str();
+    }
 
-    void set_reserved_bit(std::string& reserved)
+    /**
+     *  Loads the map from its string representation, either the range list
+     *  or the legacy std::bitset<N> string.
+     *    @param str the uncompressed map
+     *    @return 0 on success
+     */
+    int from_string(const std::string& str)
+    {
+        if ( !str.empty() && str[0] == RANGES_TAG )
+        {
+            set_ranges(str.substr(1), *bs);
+
+            return 0;
+        }
+
+        if ( str.size() != N )
+        {
+            return -1;
+        }
+
+        // Legacy format, first character is the most significant bit
+        for (unsigned int i = 0; i < N; ++i)
+        {
+            switch (str[i])
+            {
+                case '1':
+                    (*bs)[(N - 1 - i) / 64] |= word_bit(N - 1 - i);
+                    break;
+                case '0':
+                    break;
+                default:
+                    return -1;
+            }
+        }
+
+        return 0;
+    }
+
+    /**
+     * Sets the bits in a range string. The string is separated by ',' for
+     * each element and by ':' for ranges.
+     *   @param ranges string with the bits
+     *   @param words to set the bits in
+     */
+    static void set_ranges(const std::string& ranges,
+            std::vector<uint64_t>& words)
     {
         std::vector<std::string> strings;
         std::vector<std::string> range;
@@ -343,13 +512,18 @@ private:
 
         unsigned int bit, bit_start, bit_end;
 
-        strings = one_util::split(reserved, ',', true);
+        strings = one_util::split(ranges, ',', true);
 
         for (it = strings.begin(); it != strings.end(); it++)
         {
             // Try to split it by ':'
             range = one_util::split(*it, ':', true);
 
+            if ( range.empty() )
+            {
+                continue;
+            }
+
             iss.clear();
             iss.str(range[0]);
             iss >> bit_start;
@@ -379,14 +553,12 @@ private:
                 continue;
             }
 
-            for (bit = bit_start; bit <= bit_end; bit++)
+            for (bit = bit_start; bit <= bit_end && bit < N; bit++)
             {
-                reserved_bit.insert(bit);
+                words[bit / 64] |= word_bit(bit);
             }
         }
-
     }
 };
 
 #endif /*BITMAP_H_*/
-
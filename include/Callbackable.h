@@ -19,6 +19,7 @@
 
 #include <pthread.h>
 #include <sstream>
+#include <vector>
 
 using namespace std;
 
@@ -169,4 +170,70 @@ private:
     std::string * value;
 };
 
+/* -------------------------------------------------------------------------- */
+/* Class to obtain a column of values (e.g. a list of names)                  */
+/* -------------------------------------------------------------------------- */
+
+template <class T>
+class vector_cb : public Callbackable
+{
+public:
+    void set_callback(std::vector<T> * _values)
+    {
+        values = _values;
+
+        Callbackable::set_callback(
+                static_cast<Callbackable::Callback>(&vector_cb::callback));
+    }
+
+    virtual int callback(void *nil, int num, char **_values, char **names)
+    {
+        if ( _values == 0 || _values[0] == 0 || num != 1 )
+        {
+            return -1;
+        }
+
+        T value;
+
+        std::istringstream iss(_values[0]);
+
+        iss >> value;
+
+        values->push_back(value);
+
+        return 0;
+    }
+
+private:
+    std::vector<T> * values;
+};
+
+template<>
+class vector_cb<std::string> : public Callbackable
+{
+public:
+    void set_callback(std::vector<std::string> * _values)
+    {
+        values = _values;
+
+        Callbackable::set_callback(
+                static_cast<Callbackable::Callback>(&vector_cb::callback));
+    }
+
+    virtual int callback(void *nil, int num, char **_values, char **names)
+    {
+        if ( _values == 0 || _values[0] == 0 || num != 1 )
+        {
+            return -1;
+        }
+
+        values->push_back(_values[0]);
+
+        return 0;
+    }
+
+private:
+    std::vector<std::string> * values;
+};
+
 #endif /*CALLBACKABLE_H_*/
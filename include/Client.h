@@ -92,11 +92,13 @@ public:
      *    @param timeout (ms) for the request, set 0 for global xml_rpc timeout
      *    @param result of the xmlrpc call
      *    @param error string if any
+     *    @param fault_code of the xmlrpc fault if the call failed, if not 0
      *    @return 0
      */
     static int call(const std::string& endpoint, const std::string& method,
         const xmlrpc_c::paramList& plist, unsigned int _timeout,
-        xmlrpc_c::value * const result, std::string& error);
+        xmlrpc_c::value * const result, std::string& error,
+        int * fault_code = 0);
 
 	/**
      *  Performs an xmlrpc call to the initialized server and credentials.
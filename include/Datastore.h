@@ -201,14 +201,26 @@ public:
      *    @param total_mb
      *    @param free_mb
      *    @param used_mb
+     *    @return true if the capacity of the datastore changed
      */
-    void update_monitor(long long total, long long free, long long used)
+    bool update_monitor(long long total, long long free, long long used)
     {
+        bool changed = total_mb != total || free_mb != free || used_mb != used;
+
         total_mb = total;
         free_mb  = free;
         used_mb  = used;
+
+        return changed;
     }
 
+    /**
+     *  Identifies the storage backend of the datastore. Datastores with the
+     *  same key (e.g. those using the same Ceph pool) are monitored once.
+     *    @return the key, empty if the backend is not shared
+     */
+    string get_backend_key() const;
+
     /**
      *  Returns the available capacity in the datastore.
      *    @params avail the total available size in the datastore (MB)
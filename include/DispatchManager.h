@@ -71,6 +71,11 @@ public:
         return new DMAction(*this);
     }
 
+    int key() const
+    {
+        return _vm_id;
+    }
+
 private:
     Actions _action;
 
@@ -81,8 +86,13 @@ class DispatchManager : public ActionListener
 {
 public:
 
-    DispatchManager():
-            hpool(0), vmpool(0), vrouterpool(0), tm(0), vmm(0), lcm(0), imagem(0)
+    /**
+     *    @param num_threads number of threads to execute actions, actions on
+     *    the same VM are executed in order
+     */
+    DispatchManager(unsigned int num_threads):
+            hpool(0), vmpool(0), vrouterpool(0), tm(0), vmm(0), lcm(0),
+            imagem(0), am(num_threads)
     {
         am.addListener(this);
     };
@@ -92,11 +92,21 @@ protected:
         return va->marshall(_sep);
     };
 
+    void marshall(string& buffer, const char * _sep = 0) const
+    {
+        va->marshall(buffer, _sep);
+    };
+
     string * to_xml() const
     {
         return va->to_xml();
     };
 
+    void to_xml(string& buffer) const
+    {
+        va->to_xml(buffer);
+    };
+
     void unmarshall(const std::string& sattr, const char * _sep = 0)
     {
         va->unmarshall(sattr, _sep);
@@ -23,12 +23,13 @@
 
 #include "ReplicaManager.h"
 #include "ActionManager.h"
+#include "Callbackable.h"
 
 extern "C" void * frm_loop(void *arg);
 
 class SqlDB;
 
-class FedReplicaManager : public ReplicaManager, ActionListener
+class FedReplicaManager : public ReplicaManager, ActionListener, Callbackable
 {
 public:
 
@@ -37,8 +38,10 @@ public:
      *  @param _p purge timeout for log
      *  @param d pointer to underlying DB (LogDB)
      *  @param l log_retention length (num records)
+     *  @param w max number of records sent to a zone in a single call
      */
-    FedReplicaManager(time_t _t, time_t _p, SqlDB * d, unsigned int l);
+    FedReplicaManager(time_t _t, time_t _p, SqlDB * d, unsigned int l,
+            unsigned int w);
 
     virtual ~FedReplicaManager();
 
@@ -60,11 +63,23 @@ public:
     int apply_log_record(int index, const std::string& sql);
 
     /**
-     *  Record was successfully replicated on zone, increase next index and
-     *  send any pending records.
+     *  Applies a batch of consecutive records, as sent by the master in a
+     *  single replication call [SLAVE]
+     *    @param index of the first record in the batch
+     *    @param records compressed batch as generated by pack_records
+     *    @param error description if any
+     *    @return 0 on success, last_index if missing records, -1 on error
+     */
+    int apply_log_records(int index, const std::string& records,
+            std::string& error);
+
+    /**
+     *  Records were successfully replicated on zone, update next index, open
+     *  the zone window and send any pending records.
      *    @param zone_id
+     *    @param zone_last last index replicated in the zone
      */
-    void replicate_success(int zone_id);
+    void replicate_success(int zone_id, int zone_last);
 
     /**
      *  Record could not be replicated on zone, decrease next index and
@@ -74,7 +89,8 @@ public:
     void replicate_failure(int zone_id, int zone_last);
 
     /**
-     *  XML-RPC API call to replicate a log entry on slaves
+     *  XML-RPC API call to replicate the next batch of log entries on slaves.
+     *  The batch size is limited by the current window of the zone
      *     @param zone_id
      *     @param success status of API call
      *     @param last index replicate in zone slave
@@ -154,6 +170,13 @@ public:
         return last_index;
     }
 
+    /**
+     *  Replication status of each zone: next record, lag in number of records,
+     *  current window and time of the last successful call
+     *    @param oss stream to write the <FEDLOG_ZONES> element
+     */
+    void zones_to_xml(std::ostringstream& oss);
+
 private:
     friend void * frm_loop(void *arg);
 
@@ -184,17 +207,32 @@ private:
 
     static const time_t xmlrpc_timeout_ms;
 
+    // -------------------------------------------------------------------------
+    // Replication window
+    //   - max_window. Maximum number of records sent to a zone in a call. The
+    //     window of each zone doubles on success up to this value and goes
+    //     back to 1 on failure.
+    //   - secret. oneadmin credentials, read from the oneauth file on first
+    //     use and after a failed call
+    // -------------------------------------------------------------------------
+    unsigned int max_window;
+
+    std::string secret;
+
     // -------------------------------------------------------------------------
     // Synchronization variables
     //   - last_index in the replication log
     //   - zones list of zones in the federation with:
     //     - list of servers <id, xmlrpc endpoint>
     //     - next index to send to this zone
+    //     - batch, false if the zone does not implement fedreplicatebatch
+    //       (older versions), records are sent one by one with fedreplicate
     // -------------------------------------------------------------------------
     struct ZoneServers
     {
         ZoneServers(int z, unsigned int l, const std::map<int,std::string>& s):
-            zone_id(z), servers(s), next(l){};
+            zone_id(z), servers(s), next(l), window(1), last_success(0),
+            batch(true){};
 
         ~ZoneServers(){};
 
@@ -203,6 +241,12 @@ private:
         std::map<int, std::string> servers;
 
         unsigned int next;
+
+        unsigned int window;
+
+        time_t last_success;
+
+        bool batch;
     };
 
     std::map<int, ZoneServers *> zones;
@@ -238,14 +282,6 @@ private:
 
     static const char * db_bootstrap;
 
-    /**
-     *  Gets a record from the log
-     *    @param index of the record
-     *    @param sql command of the record
-     *    @return 0 in case of success -1 otherwise
-     */
-    int get_log_record(int index, std::string& sql);
-
     /**
      *  Inserts a new record in the log ans updates the last_index variable
      *  (memory and db)
@@ -263,14 +299,45 @@ private:
     int get_last_index(unsigned int& index);
 
     /**
-     *  Get the nest record to replicate in a zone
+     *  Gets a range of records from the log, packed to be sent in a single
+     *  replication call
+     *    @param index of the first record
+     *    @param num max number of records
+     *    @param pack false to get a single record as is (num is ignored)
+     *    @param records packed and compressed records, or the record
+     *    @param count number of records read
+     *    @return 0 on success -1 otherwise
+     */
+    int get_log_records(int index, unsigned int num, bool pack,
+            std::string& records, int& count);
+
+    /**
+     *  Get the next records to replicate in a zone
      *    @param zone_id of the zone
-     *    @param index of the next record to send
-     *    @param sql command to replicate
+     *    @param index of the first record to send
+     *    @param records packed and compressed records, or a single record if
+     *    the zone does not support batches
+     *    @param count number of records in the batch
+     *    @param batch true if the zone supports batches
      *    @return 0 on success, -1 otherwise
      */
-    int get_next_record(int zone_id, int& index, std::string& sql,
-        std::map<int, std::string>& zservers);
+    int get_next_records(int zone_id, int& index, std::string& records,
+        int& count, std::map<int, std::string>& zservers, bool& batch);
+
+    /**
+     *  Callback to pack the records of a SELECT log_index, sqlcmd query. Each
+     *  record is stored as "<length> <sqlcmd>"
+     */
+    int select_records_cb(void *_records, int num, char **values, char **names);
+
+    /**
+     *  Splits a batch of records, as packed by select_records_cb
+     *    @param records compressed batch
+     *    @param sqls commands in the batch
+     *    @return 0 on success -1 if the batch is malformed
+     */
+    static int unpack_records(const std::string& records,
+            std::vector<std::string>& sqls);
 };
 
 #endif /*FED_REPLICA_MANAGER_H_*/
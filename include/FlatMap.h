@@ -0,0 +1,284 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#ifndef FLAT_MAP_H_
+#define FLAT_MAP_H_
+
+#include <vector>
+#include <map>
+#include <utility>
+#include <algorithm>
+
+/**
+ *  Associative containers stored in a vector sorted by key. They are used for
+ *  template attributes, that are small and mostly built in key order (e.g.
+ *  from XML), so they need a single allocation instead of one per element as
+ *  std::map. They provide the subset of the std::map/multimap interface used
+ *  by the Template classes, with the same iteration order.
+ *
+ *  Iterators are invalidated by insert and erase.
+ */
+template<typename K, typename V>
+class FlatMapBase
+{
+public:
+    typedef std::pair<K, V> value_type;
+
+    typedef typename std::vector<value_type>::iterator       iterator;
+    typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+    iterator begin() { return elements.begin(); };
+
+    iterator end() { return elements.end(); };
+
+    const_iterator begin() const { return elements.begin(); };
+
+    const_iterator end() const { return elements.end(); };
+
+    size_t size() const { return elements.size(); };
+
+    bool empty() const { return elements.empty(); };
+
+    void clear() { elements.clear(); };
+
+    void reserve(size_t n) { elements.reserve(n); };
+
+    iterator lower_bound(const K& key)
+    {
+        return std::lower_bound(elements.begin(), elements.end(), key,
+                key_less());
+    };
+
+    const_iterator lower_bound(const K& key) const
+    {
+        return std::lower_bound(elements.begin(), elements.end(), key,
+                key_less());
+    };
+
+    iterator upper_bound(const K& key)
+    {
+        return std::upper_bound(elements.begin(), elements.end(), key,
+                key_less());
+    };
+
+    const_iterator upper_bound(const K& key) const
+    {
+        return std::upper_bound(elements.begin(), elements.end(), key,
+                key_less());
+    };
+
+    std::pair<iterator, iterator> equal_range(const K& key)
+    {
+        return std::equal_range(elements.begin(), elements.end(), key,
+                key_less());
+    };
+
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+        return std::equal_range(elements.begin(), elements.end(), key,
+                key_less());
+    };
+
+    /**
+     *  @return the first element with the key or end()
+     */
+    iterator find(const K& key)
+    {
+        iterator it = lower_bound(key);
+
+        if ( it != elements.end() && !(key < it->first) )
+        {
+            return it;
+        }
+
+        return elements.end();
+    };
+
+    const_iterator find(const K& key) const
+    {
+        const_iterator it = lower_bound(key);
+
+        if ( it != elements.end() && !(key < it->first) )
+        {
+            return it;
+        }
+
+        return elements.end();
+    };
+
+    size_t count(const K& key) const
+    {
+        std::pair<const_iterator, const_iterator> range = equal_range(key);
+
+        return range.second - range.first;
+    };
+
+    iterator erase(iterator pos)
+    {
+        return elements.erase(pos);
+    };
+
+    iterator erase(iterator first, iterator last)
+    {
+        return elements.erase(first, last);
+    };
+
+    /**
+     *  Removes all the elements with the key
+     *    @return the number of elements removed
+     */
+    size_t erase(const K& key)
+    {
+        std::pair<iterator, iterator> range = equal_range(key);
+
+        size_t num = range.second - range.first;
+
+        elements.erase(range.first, range.second);
+
+        return num;
+    };
+
+    bool operator==(const FlatMapBase& other) const
+    {
+        return elements == other.elements;
+    };
+
+    bool operator!=(const FlatMapBase& other) const
+    {
+        return elements != other.elements;
+    };
+
+protected:
+    FlatMapBase(){};
+
+    ~FlatMapBase(){};
+
+    /**
+     *  Compares elements and keys, for the std algorithms
+     */
+    struct key_less
+    {
+        bool operator()(const value_type& a, const K& b) const
+        {
+            return a.first < b;
+        };
+
+        bool operator()(const K& a, const value_type& b) const
+        {
+            return a < b.first;
+        };
+
+        bool operator()(const value_type& a, const value_type& b) const
+        {
+            return a.first < b.first;
+        };
+    };
+
+    std::vector<value_type> elements;
+};
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Flat replacement of std::map, keys are unique
+ */
+template<typename K, typename V>
+class FlatMap : public FlatMapBase<K, V>
+{
+public:
+    typedef typename FlatMapBase<K, V>::value_type     value_type;
+    typedef typename FlatMapBase<K, V>::iterator       iterator;
+    typedef typename FlatMapBase<K, V>::const_iterator const_iterator;
+
+    FlatMap(){};
+
+    FlatMap(const std::map<K, V>& m)
+    {
+        this->elements.assign(m.begin(), m.end());
+    };
+
+    ~FlatMap(){};
+
+    /**
+     *  Inserts the element if the key does not exist
+     *    @return the element with the key, and true if it was inserted
+     */
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        iterator it = this->lower_bound(value.first);
+
+        if ( it != this->elements.end() && !(value.first < it->first) )
+        {
+            return std::make_pair(it, false);
+        }
+
+        return std::make_pair(this->elements.insert(it, value), true);
+    };
+
+    V& operator[](const K& key)
+    {
+        return insert(value_type(key, V())).first->second;
+    };
+
+    /**
+     *  Conversion for the interfaces that use std::map (e.g. driver
+     *  configuration attributes)
+     */
+    operator std::map<K, V>() const
+    {
+        return std::map<K, V>(this->elements.begin(), this->elements.end());
+    };
+};
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Flat replacement of std::multimap, elements with the same key are kept in
+ *  insertion order
+ */
+template<typename K, typename V>
+class FlatMultiMap : public FlatMapBase<K, V>
+{
+public:
+    typedef typename FlatMapBase<K, V>::value_type     value_type;
+    typedef typename FlatMapBase<K, V>::iterator       iterator;
+    typedef typename FlatMapBase<K, V>::const_iterator const_iterator;
+
+    FlatMultiMap(){};
+
+    ~FlatMultiMap(){};
+
+    /**
+     *  Inserts the element after the existing ones with the same key
+     *    @return the inserted element
+     */
+    iterator insert(const value_type& value)
+    {
+        if ( this->elements.empty() ||
+                !(value.first < this->elements.back().first) )
+        {
+            this->elements.push_back(value);
+
+            return this->elements.end() - 1;
+        }
+
+        return this->elements.insert(this->upper_bound(value.first), value);
+    };
+};
+
+#endif /*FLAT_MAP_H_*/
@@ -0,0 +1,232 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#ifndef HOOK_EVENT_BUS_H_
+#define HOOK_EVENT_BUS_H_
+
+#include <pthread.h>
+#include <time.h>
+
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+extern "C" void * hook_event_bus_loop(void *arg);
+
+/**
+ *  A state change of an object, e.g. a VM entering RUNNING. Events are
+ *  rendered as:
+ *    <EVENT>
+ *      <OBJECT>VM</OBJECT><TYPE>STATE</TYPE><ID>3</ID><TIMESTAMP>..</TIMESTAMP>
+ *      <STATE>ACTIVE</STATE>...
+ *    </EVENT>
+ */
+class HookEvent
+{
+public:
+    HookEvent(const string& _object, const string& _type, int _oid):
+        object(_object), type(_type), oid(_oid), timestamp(time(0)){};
+
+    ~HookEvent(){};
+
+    /**
+     *  Adds an attribute to the event
+     *    @param name of the attribute
+     *    @param value of the attribute, it is escaped when rendered
+     */
+    void add(const string& name, const string& value)
+    {
+        attributes.push_back(make_pair(name, value));
+    };
+
+    /**
+     *  Prints the event in XML format
+     *    @param xml the string to store the XML
+     *    @return the same xml string to use it in << compounds
+     */
+    string& to_xml(string& xml) const;
+
+private:
+    string object;
+
+    string type;
+
+    int    oid;
+
+    time_t timestamp;
+
+    vector<pair<string, string> > attributes;
+};
+
+/**
+ *  The HookEventBus delivers events to a subscriber in batches. Events are
+ *  stored in a bounded queue (the oldest events are dropped when it is full)
+ *  and delivered by a dedicated thread, either:
+ *    - to a long-running consumer listening in a local (UNIX) socket. Each
+ *      batch is written as a line: <EVENTS><EVENT>...</EVENT>...</EVENTS>\n.
+ *      The connection is kept open and the batch is retried if it fails.
+ *    - to a command, executed once per batch through the Hook Manager driver.
+ *      $EVENTS in the arguments is replaced by the base64 encoded batch. The
+ *      bus waits for the command result (see command_result) and retries the
+ *      batch if it fails, up to max_retries times. Then the batch is dropped.
+ *  Failed deliveries are retried with an exponential backoff, from period up
+ *  to max_retry_period seconds.
+ */
+class HookEventBus
+{
+public:
+    /**
+     *  Creates the bus and starts the delivery thread
+     *    @param name of the subscriber, used in log messages
+     *    @param cmd executed for each batch, if socket is empty
+     *    @param args for the command
+     *    @param socket path of the consumer socket
+     *    @param batch max number of events per batch
+     */
+    HookEventBus(const string& name, const string& cmd, const string& args,
+            const string& socket, unsigned int batch);
+
+    ~HookEventBus();
+
+    /**
+     *  Adds an event to the queue, it does not block on the subscriber
+     *    @param event to deliver
+     */
+    void publish(const HookEvent& event);
+
+    /**
+     *  Sets the result of the command executed for the last batch of a bus.
+     *  It is called by the Hook Manager driver for hooks executed with -1 as
+     *  object id. Commands are executed as <hook name>#<sequence>, results
+     *  of previous executions (e.g. after a timeout) are ignored.
+     *    @param tag of the execution, as echoed by the driver
+     *    @param success true if the command succeeded
+     */
+    static void command_result(const string& tag, bool success);
+
+private:
+    friend void * hook_event_bus_loop(void *arg);
+
+    /**
+     *  Max number of events in the queue
+     */
+    static const unsigned int max_events;
+
+    /**
+     *  Seconds to wait for a batch to fill up, or to retry a failed delivery
+     */
+    static const time_t period;
+
+    /**
+     *  Max seconds to wait before retrying a failed delivery
+     */
+    static const time_t max_retry_period;
+
+    /**
+     *  Max number of attempts to deliver a batch to a command
+     */
+    static const unsigned int max_retries;
+
+    /**
+     *  Max size (bytes) of a batch delivered to a command. The base64 batch
+     *  is part of the command line, that must fit in MAX_ARG_STRLEN (128KB)
+     */
+    static const size_t max_command_batch;
+
+    /**
+     *  Seconds to wait for the result of a batch command
+     */
+    static const time_t command_timeout;
+
+    /**
+     *  Buses that deliver to a command, by hook name, to route the results
+     */
+    static map<string, HookEventBus *> command_buses;
+
+    static pthread_mutex_t command_buses_mutex;
+
+    string name;
+
+    string cmd;
+
+    string args;
+
+    string socket_path;
+
+    unsigned int batch_size;
+
+    /**
+     *  Events, in XML format, waiting to be delivered
+     */
+    deque<string> events;
+
+    /**
+     *  Events dropped since the last delivery
+     */
+    unsigned int dropped;
+
+    bool finalized;
+
+    pthread_t thread;
+
+    pthread_mutex_t mutex;
+
+    pthread_cond_t cond;
+
+    /**
+     *  Connection to the consumer socket, -1 if not connected
+     */
+    int socket_fd;
+
+    /**
+     *  The command of the last batch is running, and its result
+     */
+    bool command_pending;
+
+    bool command_success;
+
+    /**
+     *  Sequence number of the last command executed
+     */
+    unsigned long command_seq;
+
+    /**
+     *  Delivery loop, executed by the bus thread
+     */
+    void loop();
+
+    /**
+     *  Sends a batch to the subscriber
+     *    @param batch in XML format
+     *    @return 0 on success
+     */
+    int deliver(const string& batch);
+
+    int socket_deliver(const string& batch);
+
+    /**
+     *  Executes the command for a batch, and waits for its result up to
+     *  command_timeout seconds
+     *    @param batch in XML format
+     *    @return 0 if the command succeeded
+     */
+    int command_deliver(const string& batch);
+};
+
+#endif /*HOOK_EVENT_BUS_H_*/
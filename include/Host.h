@@ -66,6 +66,15 @@ public:
      */
     string& to_xml(string& xml) const;
 
+    /**
+     * Function to print the Host object into a string in XML format, with
+     * the attributes shown in pool listings (summary). It is stored in the
+     * DB along with the body.
+     *  @param xml the resulting XML string
+     *  @return a reference to the generated string
+     */
+    string& to_xml_short(string& xml) const;
+
     /**
      *  Rebuilds the object from an xml formatted string
      *    @param xml_str The xml-formatted string
@@ -282,51 +291,55 @@ public:
     /**
      *  Adds a new VM to the given share by incrementing the cpu, mem and disk
      *  counters
-     *    @param vm_id id of the vm to add to the host
-     *    @param cpu needed by the VM (percentage)
-     *    @param mem needed by the VM (in KB)
-     *    @param disk needed by the VM
-     *    @param pci devices needed by th VM
-     *    @return 0 on success
+     *    @param sr capacity needed by the VM, PCI devices and NUMA nodes
+     *    assigned to the VM are added to their attributes
+     *    @return 0 on success, -1 if the VM NUMA nodes cannot be assigned
      */
-    void add_capacity(int vm_id, long long cpu, long long mem, long long disk,
-            vector<VectorAttribute *> pci)
+    int add_capacity(HostShareCapacity& sr)
     {
-        if ( vm_collection.add(vm_id) == 0 )
+        if ( vm_collection.add(sr.vmid) == 0 )
         {
-            host_share.add(vm_id, cpu, mem, disk, pci);
+            if ( host_share.add(sr) != 0 )
+            {
+                ostringstream oss;
+                oss << "Cannot assign the NUMA nodes of VM " << sr.vmid
+                    << " in host " << oid << ".";
+
+                NebulaLog::log("ONE", Log::ERROR, oss);
+
+                vm_collection.del(sr.vmid);
+
+                return -1;
+            }
         }
         else
         {
             ostringstream oss;
-            oss << "Trying to add VM " << vm_id
+            oss << "Trying to add VM " << sr.vmid
                 << ", that it is already associated to host " << oid << ".";
 
             NebulaLog::log("ONE", Log::ERROR, oss);
         }
+
+        return 0;
     };
 
     /**
      *  Deletes a new VM from the given share by decrementing the cpu,mem and
      *  disk counters
-     *    @param vm_id id of the vm to delete from the host
-     *    @param cpu used by the VM (percentage)
-     *    @param mem used by the VM (in KB)
-     *    @param disk used by the VM
-     *    @param pci devices needed by th VM
+     *    @param sr capacity used by the VM
      *    @return 0 on success
      */
-    void del_capacity(int vm_id, long long cpu, long long mem, long long disk,
-            const vector<VectorAttribute *>& pci)
+    void del_capacity(HostShareCapacity& sr)
     {
-        if ( vm_collection.del(vm_id) == 0 )
+        if ( vm_collection.del(sr.vmid) == 0 )
         {
-            host_share.del(cpu, mem, disk, pci);
+            host_share.del(sr);
         }
         else
         {
             ostringstream oss;
-            oss << "Trying to remove VM " << vm_id
+            oss << "Trying to remove VM " << sr.vmid
                 << ", that it is not associated to host " << oid << ".";
 
             NebulaLog::log("ONE", Log::ERROR, oss);
@@ -348,29 +361,25 @@ public:
 
     /**
      *  Tests whether a new VM can be hosted by the host or not
-     *    @param cpu needed by the VM (percentage)
-     *    @param mem needed by the VM (in Kb)
-     *    @param disk needed by the VM
-     *    @param pci devices needed by the VM
+     *    @param sr capacity needed by the VM
      *    @param error Returns the error reason, if any
      *    @return true if the share can host the VM
      */
-    bool test_capacity(long long cpu, long long mem, long long disk,
-                       vector<VectorAttribute *> &pci, string& error) const
+    bool test_capacity(HostShareCapacity& sr, string& error) const
     {
-        return host_share.test(cpu, mem, disk, pci, error);
+        return host_share.test(sr, error);
     }
 
     /**
      *  Tests whether a new VM can be hosted by the host or not, checking the
-     *  PCI devices only.
-     *    @param pci devices needed by the VM
+     *  PCI devices and NUMA nodes only.
+     *    @param sr capacity needed by the VM
      *    @param error Returns the error reason, if any
      *    @return true if the share can host the VM
      */
-    bool test_capacity(vector<VectorAttribute *> &pci, string& error) const
+    bool test_devices(HostShareCapacity& sr, string& error) const
     {
-        return host_share.test(pci, error);
+        return host_share.test_devices(sr, error);
     }
 
     /**
@@ -504,6 +513,8 @@ private:
 
     static const char * db_bootstrap;
 
+    static const SqlIndex db_indexes[];
+
     static const char * table;
 
     static const char * monit_db_names;
@@ -521,6 +532,43 @@ private:
      */
     int insert_replace(SqlDB *db, bool replace, string& error_str);
 
+    /**
+     *  Updates the last_mon_time and short_body columns of the Host, used
+     *  instead of a full body write when the monitoring did not change it.
+     *    @param db The SQL DB
+     *    @return 0 one success
+     */
+    int update_last_mon_time(SqlDB *db);
+
+    /**
+     *  Writes the Host in binary format, LAST_MON_TIME is a volatile field
+     *    @param bw the binary writer
+     *    @return 0 on success
+     */
+    int to_binary(BinaryWriter& bw) const;
+
+    /**
+     *  Rebuilds the Host from its binary format
+     *    @param br the binary reader
+     *    @return 0 on success, -1 otherwise
+     */
+    int from_binary(BinaryReader& br);
+
+    /**
+     *  Elements of the Host body updated on every monitoring cycle
+     */
+    static const char * const volatile_names[];
+
+    const char * const * volatile_elements() const
+    {
+        return volatile_names;
+    };
+
+    time_t volatile_time() const
+    {
+        return last_monitored;
+    };
+
     /**
      *  Bootstraps the database table(s) associated to the Host
      *    @return 0 on success
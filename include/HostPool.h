@@ -125,7 +125,22 @@ public:
      */
     static int bootstrap(SqlDB *_db)
     {
-        return Host::bootstrap(_db);
+        int rc;
+
+        rc  = Host::bootstrap(_db);
+        rc += bootstrap_indexes(_db);
+
+        return rc;
+    };
+
+    /**
+     *  Creates the secondary indexes of the Host pool tables that are
+     *  missing in the DB
+     *    @return 0 on success
+     */
+    static int bootstrap_indexes(SqlDB * _db)
+    {
+        return _db->create_indexes(Host::db_indexes);
     };
 
     /**
@@ -140,25 +155,24 @@ public:
     /**
      * Allocates a given capacity to the host
      *   @param oid the id of the host to allocate the capacity
-     *   @param vm_id id of the vm to add to the host
-     *   @param cpu amount of CPU, in percentage
-     *   @param mem amount of main memory, in KB
-     *   @param disk amount of disk
-     *   @param pci devices requested by the VM
+     *   @param sr capacity requested by the VM
      *
-     *   @return 0 on success -1 in case of failure
+     *   @return 0 on success -1 in case of failure (the host does not exist
+     *   or the VM NUMA nodes cannot be assigned)
      */
-    int add_capacity(int oid, int vm_id, int cpu, int mem, int disk,
-            vector<VectorAttribute *> pci)
+    int add_capacity(int oid, HostShareCapacity& sr)
     {
         int rc = 0;
         Host * host = get(oid, true);
 
         if ( host != 0 )
         {
-          host->add_capacity(vm_id, cpu, mem, disk, pci);
+          rc = host->add_capacity(sr);
 
-          update(host);
+          if ( rc == 0 )
+          {
+              update(host);
+          }
 
           host->unlock();
         }
@@ -173,20 +187,15 @@ public:
     /**
      * De-Allocates a given capacity to the host
      *   @param oid the id of the host to allocate the capacity
-     *   @param vm_id id of the vm to add to the host
-     *   @param cpu amount of CPU
-     *   @param mem amount of main memory
-     *   @param disk amount of disk
-     *   @param pci devices requested by the VM
+     *   @param sr capacity requested by the VM
      */
-    void del_capacity(int oid, int vm_id, int cpu, int mem, int disk,
-            vector<VectorAttribute *> pci)
+    void del_capacity(int oid, HostShareCapacity& sr)
     {
         Host *  host = get(oid, true);
 
         if ( host != 0 )
         {
-            host->del_capacity(vm_id, cpu, mem, disk, pci);
+            host->del_capacity(sr);
 
             update(host);
 
@@ -228,6 +237,22 @@ public:
         return PoolSQL::dump(oss, "HOST_POOL", Host::table, where, limit);
     };
 
+    /**
+     *  Dumps the summary of the Hosts (see Host::to_xml_short) in XML format.
+     *  The Host bodies are not read from the DB.
+     *  @param oss the output stream to dump the pool contents
+     *  @param where filter for the objects, defaults to all
+     *  @param limit parameters used for pagination
+     *
+     *  @return 0 on success
+     */
+    int dump_summary(ostringstream& oss, const string& where,
+                     const string& limit)
+    {
+        return PoolSQL::dump(oss, "HOST_POOL", "short_body", Host::table,
+                             where, limit);
+    };
+
     /**
      *  Finds a set objects that satisfies a given condition
      *   @param oids a vector with the oids of the objects.
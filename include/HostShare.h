@@ -21,6 +21,7 @@
 #include "Template.h"
 #include <time.h>
 #include <set>
+#include <map>
 
 /* ------------------------------------------------------------------------ */
 /* ------------------------------------------------------------------------ */
@@ -74,6 +75,13 @@ public:
      */
     int from_xml_node(const xmlNodePtr node);
 
+    /**
+     *  Builds the devices from the binary format of the template
+     *    @param br the binary reader
+     *    @return 0 on success, -1 otherwise
+     */
+    int from_binary(BinaryReader& br);
+
     /**
      *  Test whether this PCI device set has the requested devices available.
      *    @param devs list of requested devices by the VM.
@@ -161,6 +169,194 @@ private:
     map <string, PCIDevice *> pci_devices;
 };
 
+/**
+ *  This class represents the NUMA topology of the host. The list is in the
+ *  form:
+ *  <NODE>
+ *    <NODE_ID> ID of the NUMA node
+ *    <CPUS> List of node CPUs and the VM using them, e.g. 0:-1,1:5,2:5,3:-1
+ *    <TOTAL_MEMORY> Memory of the node (in KB)
+ *    <FREE_MEMORY> Free memory as reported by the monitor probe (in KB)
+ *    <MEMORY_USAGE> Memory allocated to VMs (in KB)
+ *    <VMS_MEMORY> Memory allocated to each VM, e.g. 5:1048576
+ *  <HUGEPAGE>
+ *    <NODE_ID> NUMA node of the hugepage pool
+ *    <SIZE> Size of the pages (in KB)
+ *    <PAGES> Number of pages in the pool
+ *    <FREE> Free pages as reported by the monitor probe
+ *    <USAGE> Pages allocated to VMs
+ *    <VMS> Pages allocated to each VM, e.g. 5:512
+ *
+ *  VMs request NUMA nodes with the NUMA_NODE attribute (TOTAL_CPUS and MEMORY
+ *  in KB). Each VM node is placed on a host node that has enough free CPUs
+ *  and memory, the assignment is stored in the NODE_ID and CPUS attributes of
+ *  the VM node. Nodes with PIN_POLICY = NONE do not reserve CPUs, and nodes
+ *  with HUGEPAGE_SIZE (in KB) take its memory from the hugepage pool of that
+ *  size.
+ */
+class HostShareNUMA : public Template
+{
+public:
+
+    HostShareNUMA() : Template(false, '=', "NUMA_NODES"){};
+
+    virtual ~HostShareNUMA();
+
+    /**
+     *  Builds the NUMA nodes from its XML representation. This function is
+     *  used when loading the host from the DB.
+     *    @param node xmlNode for the template
+     *    @return 0 on success
+     */
+    int from_xml_node(const xmlNodePtr node);
+
+    /**
+     *  Builds the nodes from the binary format of the template
+     *    @param br the binary reader
+     *    @return 0 on success, -1 otherwise
+     */
+    int from_binary(BinaryReader& br);
+
+    /**
+     *  Test whether the VM nodes can be placed in the host NUMA nodes
+     *    @param nodes VM NUMA_NODE attributes
+     *    @return true if the nodes fit in the host
+     */
+    bool test(const vector<VectorAttribute *> &nodes) const;
+
+    /**
+     *  Assigns host nodes and CPUs to the VM nodes. The VM NUMA_NODE
+     *  attributes are extended with the NODE_ID and CPUS of the assignment.
+     *    @param nodes VM NUMA_NODE attributes
+     *    @param vmid of the VM
+     *    @return 0 on success, -1 if the nodes do not fit (nothing assigned)
+     */
+    int add(vector<VectorAttribute *> &nodes, int vmid);
+
+    /**
+     *  Frees the CPUs and memory allocated to the VM
+     *    @param vmid of the VM
+     */
+    void del(int vmid);
+
+    /**
+     *  Updates the NUMA nodes and hugepage pools with monitor data. CPUs,
+     *  nodes and pools in use by VMs are kept even if they are no longer
+     *  reported.
+     *    @param numa_att NUMA_NODE attributes from the probes
+     *    @param huge_att HUGEPAGE attributes from the probes
+     */
+    void set_monitorization(vector<VectorAttribute*> &numa_att,
+            vector<VectorAttribute*> &huge_att);
+
+private:
+    /**
+     *  Sets the internal class structures from the template
+     */
+    void init();
+
+    /**
+     *  Hugepage pool of a NUMA node
+     */
+    struct HugePage
+    {
+        HugePage(VectorAttribute * _attrs);
+
+        /**
+         *  Number of pages not allocated to VMs
+         */
+        unsigned long free_pages() const
+        {
+            return pages > usage ? pages - usage : 0;
+        };
+
+        /**
+         *  Writes the page allocation back to the attribute
+         */
+        void update_attrs();
+
+        unsigned long size;  /**< Page size in KB */
+        unsigned long pages;
+        unsigned long usage;
+
+        map<int, unsigned long> vms; /**< VM id -> allocated pages */
+
+        VectorAttribute * attrs;
+    };
+
+    /**
+     *  Internal structure to represent NUMA nodes for fast look up and
+     *  update
+     */
+    struct NUMANode
+    {
+        NUMANode(VectorAttribute * _attrs);
+
+        ~NUMANode(){};
+
+        /**
+         *  Number of CPUs not assigned to any VM
+         */
+        unsigned int free_cpus() const;
+
+        /**
+         *  Memory not allocated to VMs, in KB
+         */
+        long long free_memory() const
+        {
+            return total_mem - mem_usage;
+        };
+
+        /**
+         *  Writes the CPU and memory allocation back to the attribute
+         */
+        void update_attrs();
+
+        unsigned int node_id;
+
+        long long total_mem;
+        long long mem_usage;
+
+        map<unsigned int, int> cpus; /**< CPU id -> VM id (-1 if free) */
+
+        map<int, long long> vms_mem; /**< VM id -> allocated memory */
+
+        map<unsigned long, HugePage> hugepages; /**< size -> hugepage pool */
+
+        VectorAttribute * attrs;
+    };
+
+    map<unsigned int, NUMANode *> nodes;
+
+    /**
+     *  Computes the host node for each VM node. Nodes with less free CPUs
+     *  are tried first to keep large nodes available for large VMs.
+     *    @param vm_nodes VM NUMA_NODE attributes
+     *    @param placement host node for each VM node
+     *    @return true if all the VM nodes can be placed
+     */
+    bool schedule(const vector<VectorAttribute *> &vm_nodes,
+            vector<NUMANode *>& placement) const;
+};
+
+/* ------------------------------------------------------------------------ */
+/* ------------------------------------------------------------------------ */
+
+/**
+ *  Capacity requested by a VM to a host
+ */
+struct HostShareCapacity
+{
+    int vmid;
+
+    long long cpu;  /**< CPU in percentage */
+    long long mem;  /**< Memory in KB */
+    long long disk; /**< Disk in MB */
+
+    vector<VectorAttribute *> pci;   /**< PCI attributes of the VM */
+    vector<VectorAttribute *> nodes; /**< NUMA_NODE attributes of the VM */
+};
+
 class Host;
 
 /**
@@ -185,24 +381,42 @@ public:
      */
     int from_xml_node(const xmlNodePtr node);
 
+    /**
+     *  Writes the counters, datastores, PCI devices and NUMA nodes in binary
+     *  format
+     *    @param bw the binary writer
+     */
+    void to_binary(BinaryWriter& bw) const;
+
+    /**
+     *  Rebuilds the object from its binary format
+     *    @param br the binary reader
+     *    @return 0 on success, -1 otherwise
+     */
+    int from_binary(BinaryReader& br);
+
     /**
      *  Add a new VM to this share
-     *    @param vmid of the VM
-     *    @param cpu requested by the VM, in percentage
-     *    @param mem requested by the VM, in KB
-     *    @param disk requested by the VM
-     *    @param pci_devs requested by the VM
+     *    @param sr capacity requested by the VM
+     *    @return 0 on success, -1 if the NUMA nodes of the VM cannot be
+     *    assigned (the share is not modified)
      */
-    void add(int vmid, long long cpu, long long mem, long long disk,
-        vector<VectorAttribute *> pci_devs)
+    int add(HostShareCapacity& sr)
     {
-        cpu_usage  += cpu;
-        mem_usage  += mem;
-        disk_usage += disk;
+        if ( numa.add(sr.nodes, sr.vmid) != 0 )
+        {
+            return -1;
+        }
+
+        cpu_usage  += sr.cpu;
+        mem_usage  += sr.mem;
+        disk_usage += sr.disk;
 
-        pci.add(pci_devs, vmid);
+        pci.add(sr.pci, sr.vmid);
 
         running_vms++;
+
+        return 0;
     }
 
     /**
@@ -220,77 +434,73 @@ public:
 
     /**
      *  Delete a VM from this share
-     *    @param cpu requested by the VM
-     *    @param mem requested by the VM
-     *    @param disk requested by the VM
-     *    @param pci_devs requested by the VM
+     *    @param sr capacity requested by the VM
      */
-    void del(long long cpu, long long mem, long long disk,
-            const vector<VectorAttribute *>& pci_devs)
+    void del(HostShareCapacity& sr)
     {
-        cpu_usage  -= cpu;
-        mem_usage  -= mem;
-        disk_usage -= disk;
+        cpu_usage  -= sr.cpu;
+        mem_usage  -= sr.mem;
+        disk_usage -= sr.disk;
+
+        pci.del(sr.pci);
 
-        pci.del(pci_devs);
+        numa.del(sr.vmid);
 
         running_vms--;
     }
 
     /**
      *  Check if this share can host a VM.
-     *    @param cpu requested by the VM
-     *    @param mem requested by the VM
-     *    @param disk requested by the VM
-     *    @param pci_devs requested by the VM
+     *    @param sr capacity requested by the VM
      *    @param error Returns the error reason, if any
      *
      *    @return true if the share can host the VM or it is the only one
      *    configured
      */
-    bool test(long long cpu, long long mem, long long disk,
-              vector<VectorAttribute *>& pci_devs, string& error) const
+    bool test(HostShareCapacity& sr, string& error) const
     {
-        bool pci_fits = pci.test(pci_devs);
+        if ( !test_devices(sr, error) )
+        {
+            return false;
+        }
 
-        bool fits = (((max_cpu  - cpu_usage ) >= cpu) &&
-                     ((max_mem  - mem_usage ) >= mem) &&
-                     ((max_disk - disk_usage) >= disk)&&
-                     pci_fits);
+        bool fits = (((max_cpu  - cpu_usage ) >= sr.cpu) &&
+                     ((max_mem  - mem_usage ) >= sr.mem) &&
+                     ((max_disk - disk_usage) >= sr.disk));
 
         if (!fits)
         {
-            if ( pci_fits )
-            {
-                error = "Not enough capacity.";
-            }
-            else
-            {
-                error = "Unavailable PCI device.";
-            }
+            error = "Not enough capacity.";
         }
 
         return fits;
     }
 
     /**
-     *  Check if this share can host a VM, testing only the PCI devices.
-     *    @param pci_devs requested by the VM
+     *  Check if this share can host a VM, testing only the PCI devices and
+     *  NUMA nodes.
+     *    @param sr capacity requested by the VM
      *    @param error Returns the error reason, if any
      *
      *    @return true if the share can host the VM or it is the only one
      *    configured
      */
-    bool test(vector<VectorAttribute *>& pci_devs, string& error) const
+    bool test_devices(HostShareCapacity& sr, string& error) const
     {
-        bool fits = pci.test(pci_devs);
-
-        if (!fits)
+        if (!pci.test(sr.pci))
         {
             error = "Unavailable PCI device.";
+            return false;
         }
 
-        return fits;
+        if (!numa.test(sr.nodes))
+        {
+            error = "Not enough free CPUs, memory or hugepages in the host "
+                "NUMA nodes.";
+            return false;
+        }
+
+        return true;
     }
 
     /**
@@ -306,6 +516,14 @@ public:
      */
     string& to_xml(string& xml) const;
 
+    /**
+     * Function to print the HostShare capacity and usage counters, without
+     * the datastore and PCI devices, into a string in XML format
+     *  @param xml the resulting XML string
+     *  @return a reference to the generated string
+     */
+    string& to_xml_short(string& xml) const;
+
     void set_ds_monitorization(const vector<VectorAttribute*> &ds_att);
 
     void set_pci_monitorization(vector<VectorAttribute*> &pci_att)
@@ -313,6 +531,12 @@ public:
         pci.set_monitorization(pci_att);
     }
 
+    void set_numa_monitorization(vector<VectorAttribute*> &numa_att,
+            vector<VectorAttribute*> &huge_att)
+    {
+        numa.set_monitorization(numa_att, huge_att);
+    }
+
     /**
      *  Resets capaity values of the share
      */
@@ -385,6 +609,13 @@ private:
 
     HostShareDatastore ds;
     HostSharePCI       pci;
+    HostShareNUMA      numa;
+
+    /**
+     *  Writes the capacity and usage counters as XML elements
+     *    @param oss the output stream
+     */
+    void counters_to_xml(ostringstream& oss) const;
 };
 
 #endif /*HOST_SHARE_H_*/
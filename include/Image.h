@@ -174,6 +174,15 @@ public:
      */
     string& to_xml(string& xml) const;
 
+    /**
+     * Function to print the Image object into a string in XML format, with
+     * the attributes shown in pool listings (summary). It is stored in the
+     * DB along with the body.
+     *  @param xml the resulting XML string
+     *  @return a reference to the generated string
+     */
+    string& to_xml_short(string& xml) const;
+
     /**
      *  Rebuilds the object from an xml formatted string
      *    @param xml_str The xml-formatted string
@@ -729,6 +738,8 @@ protected:
 
     static const char * db_bootstrap;
 
+    static const SqlIndex db_indexes[];
+
     static const char * table;
 
     /**
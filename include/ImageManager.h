@@ -20,6 +20,7 @@
 #include "MadManager.h"
 #include "ActionManager.h"
 #include "ImageManagerDriver.h"
+#include "MonitorQueue.h"
 #include "NebulaLog.h"
 
 using namespace std;
@@ -248,8 +249,23 @@ public:
      /**
       *  Trigger a monitor action for the datastore.
       *    @param ds_id id of the datastore to monitor
+      *    @return 0 if the monitor action was sent to the driver
       */
-     void monitor_datastore(int ds_id);
+     int monitor_datastore(int ds_id);
+
+     /**
+      *  Ends a monitor action of the datastore and dispatches the next ones
+      *  in the queue.
+      *    @param ds_id id of the datastore
+      *    @param group datastores sharing the backend, they should be updated
+      *    with the monitor result of ds_id
+      */
+     void monitor_done(int ds_id, vector<int>& group)
+     {
+         ds_monitor.done(ds_id, group);
+
+         dispatch_monitor();
+     };
 
     /**
      *  Set the snapshots for the given image. The image MUST be persistent
@@ -330,6 +346,16 @@ private:
      */
     ActionManager         am;
 
+    /**
+     *  Datastores to be monitored, limits concurrent monitor actions
+     */
+    MonitorQueue          ds_monitor;
+
+    /**
+     *  Sends the monitor actions allowed by the concurrency limit
+     */
+    void dispatch_monitor();
+
     /**
      *  Returns a pointer to the Image Manager Driver used for the Repository
      *    @return the Image Manager driver or 0 in not found
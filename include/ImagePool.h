@@ -125,7 +125,22 @@ public:
      */
     static int bootstrap(SqlDB *_db)
     {
-        return Image::bootstrap(_db);
+        int rc;
+
+        rc  = Image::bootstrap(_db);
+        rc += bootstrap_indexes(_db);
+
+        return rc;
+    };
+
+    /**
+     *  Creates the secondary indexes of the Image pool tables that are missing
+     *  in the DB
+     *    @return 0 on success
+     */
+    static int bootstrap_indexes(SqlDB * _db)
+    {
+        return _db->create_indexes(Image::db_indexes);
     };
 
     /**
@@ -142,6 +157,22 @@ public:
         return PoolSQL::dump(oss, "IMAGE_POOL", Image::table, where, limit);
     }
 
+    /**
+     *  Dumps the summary of the Images (see Image::to_xml_short) in XML
+     *  format. The Image bodies are not read from the DB.
+     *  @param oss the output stream to dump the pool contents
+     *  @param where filter for the objects, defaults to all
+     *  @param limit parameters used for pagination
+     *
+     *  @return 0 on success
+     */
+    int dump_summary(ostringstream& oss, const string& where,
+                     const string& limit)
+    {
+        return PoolSQL::dump(oss, "IMAGE_POOL", "short_body", Image::table,
+                             where, limit);
+    }
+
     /**
      *  Generates a DISK attribute for VM templates using the Image metadata.
      *  If the disk uses an Image, it tries to acquire it.
@@ -140,6 +140,21 @@ public:
         return new LCMAction(*this);
     }
 
+    /**
+     *  Actions are ordered by VM ID. UPDATESG uses the vm_id field for the
+     *  security group ID and iterates over its VMs (locking each one), so it
+     *  is executed by the manager thread and not hashed onto a VM worker.
+     */
+    int key() const
+    {
+        if ( _action == UPDATESG )
+        {
+            return -1;
+        }
+
+        return _vm_id;
+    }
+
 private:
     Actions _action;
 
@@ -159,9 +174,13 @@ class LifeCycleManager : public ActionListener
 {
 public:
 
-    LifeCycleManager():
+    /**
+     *    @param num_threads number of threads to execute actions, actions on
+     *    the same VM are executed in order
+     */
+    LifeCycleManager(unsigned int num_threads):
         vmpool(0), hpool(0), ipool(0), sgpool(0), clpool(0), tm(0), vmm(0),
-        dm(0), imagem(0)
+        dm(0), am(num_threads), imagem(0)
     {
         am.addListener(this);
     };
@@ -141,6 +141,39 @@ public:
      */
     int purge_log();
 
+    // -------------------------------------------------------------------------
+    // Snapshots of the replicated DB state
+    // -------------------------------------------------------------------------
+    /**
+     *  Writes a snapshot of the replicated tables to a (zlib compressed) file.
+     *  The snapshot is consistent with the last log record applied to the DB,
+     *  rows are read from a DB view (see SqlDB::open_snapshot) opened with the
+     *  LogDB mutex held, so records can be applied while the file is written.
+     *    @param file path of the snapshot
+     *    @param index of the last log record included in the snapshot
+     *    @param term of the last log record included in the snapshot
+     *    @return 0 on success
+     */
+    int create_snapshot(const std::string& file, unsigned int& index,
+            unsigned int& term);
+
+    /**
+     *  Replaces the replicated tables with the contents of a snapshot, in a
+     *  single DB transaction. The log is reset to continue after the snapshot.
+     *    @param file path of the snapshot
+     *    @param index of the last log record included in the snapshot
+     *    @param term of the last log record included in the snapshot
+     *    @return 0 on success
+     */
+    int install_snapshot(const std::string& file, unsigned int index,
+            unsigned int term);
+
+    /**
+     *  SQL command of the log records that close a snapshot. These records
+     *  keep the index and term of the snapshot and can not be replicated
+     */
+    static const std::string snapshot_sql;
+
     // -------------------------------------------------------------------------
     // SQL interface
     // -------------------------------------------------------------------------
@@ -175,6 +208,26 @@ public:
         return db->multiple_values_support();
     }
 
+    int index_exists(const string& table, const string& name)
+    {
+        return db->index_exists(table, name);
+    }
+
+    int table_names(vector<string>& tables)
+    {
+        return db->table_names(tables);
+    }
+
+    int exec_transaction(SqlCommandReader& cmds)
+    {
+        return db->exec_transaction(cmds);
+    }
+
+    SqlSnapshot * open_snapshot()
+    {
+        return db->open_snapshot();
+    }
+
     // -------------------------------------------------------------------------
     // Database methods
     // -------------------------------------------------------------------------
@@ -201,6 +254,20 @@ public:
      */
     void get_last_record_index(unsigned int& _i, unsigned int& _t);
 
+    /**
+     *  @return index of the last record applied to the DB
+     */
+    unsigned int get_last_applied();
+
+    /**
+     *  Waits until a log record has been applied to the DB. Followers use it
+     *  to serve reads that need to see a previous write.
+     *    @param index of the log record
+     *    @param timeout_ms max time to wait for the record
+     *    @return 0 if the record has been applied, -1 on timeout
+     */
+    int wait_applied(unsigned int index, long long timeout_ms);
+
 protected:
     int exec(std::ostringstream& cmd, Callbackable* obj, bool quiet)
     {
@@ -210,6 +277,11 @@ protected:
 private:
     pthread_mutex_t mutex;
 
+    /**
+     *  Signaled when records are applied to the DB
+     */
+    pthread_cond_t applied_cond;
+
     /**
      *  The Database was started in solo mode (no server_id defined)
      */
@@ -254,6 +326,24 @@ private:
 
     static const char * db_bootstrap;
 
+    /**
+     *  Tables not included in DB snapshots, they are not replicated
+     */
+    static const char * local_tables[];
+
+    /**
+     *  Builds the SQL command to insert a log record
+     *    @param index of the log entry
+     *    @param term for the log entry
+     *    @param sql command to modify DB state
+     *    @param ts timestamp of record application to DB state
+     *    @param oss the resulting SQL command
+     *
+     *    @return 0 on success
+     */
+    int insert_sql(int index, int term, const std::string& sql, time_t ts,
+            std::ostringstream& oss);
+
     /**
      *  Applies the SQL command of the given record to the database. The
      *  timestamp of the record is updated.
@@ -323,6 +413,26 @@ public:
         return _logdb->multiple_values_support();
     }
 
+    int index_exists(const string& table, const string& name)
+    {
+        return _logdb->index_exists(table, name);
+    }
+
+    int table_names(vector<string>& tables)
+    {
+        return _logdb->table_names(tables);
+    }
+
+    int exec_transaction(SqlCommandReader& cmds)
+    {
+        return _logdb->exec_transaction(cmds);
+    }
+
+    SqlSnapshot * open_snapshot()
+    {
+        return _logdb->open_snapshot();
+    }
+
 protected:
     int exec(std::ostringstream& cmd, Callbackable* obj, bool quiet)
     {
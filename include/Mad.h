@@ -51,8 +51,11 @@ protected:
             uid(userid),
             attributes(attrs),
             sudo_execution(sudo),
-            pid(-1)
-    {};
+            pid(-1),
+            framed(false)
+    {
+        pthread_mutex_init(&write_mutex, 0);
+    };
 
     /**
      *  The destructor of the class finalizes the driver process, and all its
@@ -74,9 +77,27 @@ protected:
         str  = os.str();
         cstr = str.c_str();
 
+        pthread_mutex_lock(&write_mutex);
+
         ::write(nebula_mad_pipe, cstr, str.size());
+
+        pthread_mutex_unlock(&write_mutex);
     };
 
+    /**
+     *  Send a command with a payload (e.g. a XML document) to the driver. If
+     *  the driver supports framed messages the payload is sent as is after the
+     *  command line: "COMMAND ARGS @[z]<length>\n<payload>". Payloads larger
+     *  than FRAME_ZLIB_SIZE are compressed (z flag). Otherwise the payload is
+     *  base64 encoded and sent as the last argument of the command.
+     *    @param os an output string stream with the command and arguments, it
+     *    must NOT be terminated with the end of line character.
+     *    @param payload of the command
+     */
+    void write(
+        ostringstream&  os,
+        const string&   payload) const;
+
     /**
      *  Send a DRIVER_CANCEL command to the driver
      *    @param oid identifies the action (that associated with oid)
@@ -132,6 +153,12 @@ private:
      */
     int                 nebula_mad_pipe;
 
+    /**
+     *  Serializes the messages sent to the driver, they can be written by
+     *  different manager threads
+     */
+    mutable pthread_mutex_t write_mutex;
+
     /**
      *  User running this MAD as defined in the upool DB
      */
@@ -154,6 +181,32 @@ private:
      */
     pid_t               pid;
 
+    /**
+     *  True if the driver accepts framed payloads, as announced in the reply
+     *  to the INIT command (INIT SUCCESS - FRAMED)
+     */
+    bool                framed;
+
+    /**
+     *  Buffer to build framed messages, reused to avoid allocations. Protected
+     *  by the write_mutex.
+     */
+    mutable string      frame_buffer;
+
+    /**
+     *  Framed payloads of this size or larger are zlib compressed
+     */
+    static const size_t FRAME_ZLIB_SIZE;
+
+    /**
+     *  Writes the whole buffer to the driver pipe, the write_mutex MUST be
+     *  locked before calling this function
+     *    @param buffer to write
+     *    @param size of the buffer
+     *    @return 0 on success
+     */
+    int write_pipe(const char * buffer, size_t size) const;
+
     /**
      *  Starts the MAD. This function creates a new process, sets up the
      *  communication pipes and sends the initialization command to the driver.
@@ -93,8 +93,9 @@ public:
     /**
      *  Set monitor information for the MarketPlace
      *    @param data template with monitor information
+     *    @return true if the capacity of the marketplace changed
      */
-    void update_monitor(const Template& data);
+    bool update_monitor(const Template& data);
 
     /**
      *  Check if action is supported for the apps
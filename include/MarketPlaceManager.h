@@ -20,6 +20,7 @@
 #include "MadManager.h"
 #include "ActionManager.h"
 #include "MarketPlaceManagerDriver.h"
+#include "MonitorQueue.h"
 #include "NebulaLog.h"
 
 extern "C" void * marketplace_action_loop(void *arg);
@@ -121,8 +122,23 @@ public:
      /**
       *  Trigger a monitor action for the marketplace .
       *    @param ds_id id of the datastore to monitor
+      *    @return 0 if the monitor action was sent to the driver
       */
-     void monitor_market(int ds_id);
+     int monitor_market(int ds_id);
+
+     /**
+      *  Ends a monitor action of the marketplace and dispatches the next ones
+      *  in the queue.
+      *    @param mp_id id of the marketplace
+      */
+     void monitor_done(int mp_id)
+     {
+         std::vector<int> group;
+
+         mp_monitor.done(mp_id, group);
+
+         dispatch_monitor();
+     };
 
      /**
       *  Relsease resources locked by this app during the import phase
@@ -186,6 +202,16 @@ private:
      */
     ActionManager         am;
 
+    /**
+     *  Marketplaces to be monitored, limits concurrent monitor actions
+     */
+    MonitorQueue          mp_monitor;
+
+    /**
+     *  Sends the monitor actions allowed by the concurrency limit
+     */
+    void dispatch_monitor();
+
     /**
      *  Returns a pointer to the marketplace driver.
      *    @return the marketplace manager driver or 0 in not found
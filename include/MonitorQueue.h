@@ -0,0 +1,182 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#ifndef MONITOR_QUEUE_H_
+#define MONITOR_QUEUE_H_
+
+#include <pthread.h>
+#include <time.h>
+
+#include <deque>
+#include <map>
+#include <vector>
+
+/**
+ *  This class limits the number of concurrent monitor operations sent to a
+ *  driver. Objects are queued each monitor cycle and dispatched as previous
+ *  operations finish. An object can lead a group of objects that share the
+ *  same backend, the result of the leader is used for all of them.
+ */
+class MonitorQueue
+{
+public:
+    MonitorQueue():max_active(0), timeout(0)
+    {
+        pthread_mutex_init(&mutex, 0);
+    };
+
+    ~MonitorQueue()
+    {
+        pthread_mutex_destroy(&mutex);
+    };
+
+    /**
+     *  Sets the limits of the queue
+     *    @param _max_active concurrent operations, 0 for unlimited
+     *    @param _timeout for an operation, after it the slot is released
+     */
+    void set_limits(unsigned int _max_active, time_t _timeout)
+    {
+        pthread_mutex_lock(&mutex);
+
+        max_active = _max_active;
+        timeout    = _timeout;
+
+        pthread_mutex_unlock(&mutex);
+    };
+
+    /**
+     *  Adds an object to the queue, objects already queued or being
+     *  monitored are skipped.
+     *    @param id of the object
+     *    @param group objects that share the result
+     *    @return true if the object was added
+     */
+    bool push(int id, const std::vector<int>& group)
+    {
+        bool added = false;
+
+        pthread_mutex_lock(&mutex);
+
+        if ( groups.find(id) == groups.end() )
+        {
+            groups.insert(std::make_pair(id, group));
+
+            pending.push_back(id);
+
+            added = true;
+        }
+
+        pthread_mutex_unlock(&mutex);
+
+        return added;
+    };
+
+    /**
+     *  Gets the objects to monitor now, up to the concurrency limit
+     *    @param ids of the objects, they are set as active
+     */
+    void pop(std::vector<int>& ids)
+    {
+        std::map<int, time_t>::iterator it;
+
+        time_t the_time = time(0);
+
+        pthread_mutex_lock(&mutex);
+
+        for (it = active.begin(); it != active.end(); )
+        {
+            if ( timeout > 0 && the_time - it->second > timeout )
+            {
+                groups.erase(it->first);
+
+                active.erase(it++);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        while (!pending.empty() && (max_active == 0||active.size()<max_active))
+        {
+            int id = pending.front();
+
+            pending.pop_front();
+
+            active.insert(std::make_pair(id, the_time));
+
+            ids.push_back(id);
+        }
+
+        pthread_mutex_unlock(&mutex);
+    };
+
+    /**
+     *  Ends the monitor operation of an object
+     *    @param id of the object
+     *    @param group objects that share the result with this one
+     */
+    void done(int id, std::vector<int>& group)
+    {
+        std::map<int, std::vector<int> >::iterator it;
+
+        group.clear();
+
+        pthread_mutex_lock(&mutex);
+
+        if ( active.erase(id) == 1 )
+        {
+            it = groups.find(id);
+
+            group.swap(it->second);
+
+            groups.erase(it);
+        }
+
+        pthread_mutex_unlock(&mutex);
+    };
+
+private:
+    pthread_mutex_t mutex;
+
+    /**
+     *  Max number of active operations, 0 no limit
+     */
+    unsigned int max_active;
+
+    /**
+     *  Max duration of an operation
+     */
+    time_t timeout;
+
+    /**
+     *  Objects waiting to be monitored
+     */
+    std::deque<int> pending;
+
+    /**
+     *  Objects being monitored, and the start time of the operation
+     */
+    std::map<int, time_t> active;
+
+    /**
+     *  Objects in the queue (pending or active) and their groups
+     */
+    std::map<int, std::vector<int> > groups;
+};
+
+#endif /*MONITOR_QUEUE_H_*/
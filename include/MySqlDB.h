@@ -75,6 +75,36 @@ public:
      */
     bool multiple_values_support();
 
+    /**
+     *  Checks if an index is defined for a table
+     *    @param table name of the table
+     *    @param name of the index
+     *    @return 1 if the index exists, 0 if not and -1 on DB error
+     */
+    int index_exists(const string& table, const string& name);
+
+    /**
+     *  Gets the names of the tables defined in the DB
+     *    @param tables names of the tables
+     *    @return 0 on success
+     */
+    int table_names(vector<string>& tables);
+
+    /**
+     *  Executes a set of SQL commands in a single transaction, using the same
+     *  connection of the pool for all of them
+     *    @param cmds the SQL commands
+     *    @return 0 on success
+     */
+    int exec_transaction(SqlCommandReader& cmds);
+
+    /**
+     *  Opens a new connection to the DB (not from the pool) and starts a
+     *  transaction WITH CONSISTENT SNAPSHOT on it.
+     *    @return the DB view, 0 on error
+     */
+    SqlSnapshot * open_snapshot();
+
 protected:
     /**
      *  Wraps the mysql_query function call
@@ -85,6 +115,12 @@ protected:
     int exec(ostringstream& cmd, Callbackable* obj, bool quiet);
 
 private:
+    friend class MySqlSnapshot;
+
+    /**
+     *  Executes a query in the given connection, see exec
+     */
+    int exec(MYSQL * db, ostringstream& cmd, Callbackable* obj, bool quiet);
 
     /**
      *  Number of concurrent DB connections.
@@ -159,6 +195,14 @@ public:
 
     bool multiple_values_support(){return true;};
 
+    int index_exists(const string& table, const string& name){return -1;};
+
+    int table_names(vector<string>& tables){return -1;};
+
+    int exec_transaction(SqlCommandReader& cmds){return -1;};
+
+    SqlSnapshot * open_snapshot(){return 0;};
+
 protected:
     int exec(ostringstream& cmd, Callbackable* obj, bool quiet){return -1;};
 };
@@ -0,0 +1,142 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#ifndef OBJECT_BINARY_H_
+#define OBJECT_BINARY_H_
+
+#include <string>
+#include <vector>
+#include <map>
+
+using namespace std;
+
+/**
+ *  Compact binary encoding for object bodies. Fields are written in a fixed
+ *  order by each object:
+ *    - Integers are zig-zag varints
+ *    - Strings are a varint length followed by the bytes
+ *    - Names (e.g. template attributes) are interned, the first occurrence is
+ *      written as 0 + string, next ones as the varint index + 1
+ *
+ *  The fields that change on every update (e.g. last monitoring time) are
+ *  written at the end, after mark_volatile(), so they can be excluded from
+ *  the body digest.
+ */
+class BinaryWriter
+{
+public:
+    BinaryWriter():volatile_pos(string::npos){};
+
+    ~BinaryWriter(){};
+
+    void put(long long value);
+
+    void put(const string& value);
+
+    void put_name(const string& name);
+
+    /**
+     *  Marks the start of the volatile fields
+     */
+    void mark_volatile()
+    {
+        volatile_pos = buffer.size();
+    };
+
+    /**
+     *  @return the encoded fields
+     */
+    const string& str() const
+    {
+        return buffer;
+    };
+
+    /**
+     *  @return the size of the fields before the volatile ones
+     */
+    size_t stable_size() const
+    {
+        return volatile_pos == string::npos ? buffer.size() : volatile_pos;
+    };
+
+private:
+    string buffer;
+
+    size_t volatile_pos;
+
+    map<string, unsigned int> names;
+};
+
+/**
+ *  Decodes the fields written by a BinaryWriter, get functions return -1
+ *  if the buffer is truncated or corrupted.
+ */
+class BinaryReader
+{
+public:
+    BinaryReader(const string& _buffer):buffer(_buffer), pos(0){};
+
+    ~BinaryReader(){};
+
+    int get(long long& value);
+
+    int get(int& value);
+
+    int get(time_t& value);
+
+    int get(string& value);
+
+    int get_name(string& name);
+
+private:
+    const string& buffer;
+
+    size_t pos;
+
+    vector<string> names;
+};
+
+/* -------------------------------------------------------------------------- */
+/* Body storage: binary bodies are stored as text in the body column of the   */
+/* object table as "OBIN:" + base64(varint stable size + fields)              */
+/* -------------------------------------------------------------------------- */
+
+namespace one_binary
+{
+    /**
+     *  @return true if the body is in binary format
+     */
+    bool is_binary(const string& body);
+
+    /**
+     *  Renders the fields of a writer as a DB body
+     *    @param bw the writer with the object fields
+     *    @param body the resulting body
+     *    @return 0 on success
+     */
+    int to_body(const BinaryWriter& bw, string& body);
+
+    /**
+     *  Gets the fields from a binary DB body
+     *    @param body stored in the DB
+     *    @param fields object fields, to be read with a BinaryReader
+     *    @param stable part of the fields, used to compute the body digest
+     *    @return 0 on success
+     */
+    int from_body(const string& body, string& fields, string& stable);
+};
+
+#endif /*OBJECT_BINARY_H_*/
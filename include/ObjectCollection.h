@@ -80,6 +80,14 @@ public:
      */
     int from_xml(const ObjectXML* xml, const string& xpath_prefix);
 
+    /**
+     *  Rebuilds the object from an xml node
+     *    @param node The xml node pointer
+     *
+     *    @return 0 on success, -1 otherwise
+     */
+    int from_xml_node(const xmlNodePtr node);
+
     /**
      * Function to print the Collection object into a string in
      * XML format
@@ -138,14 +146,6 @@ private:
      *  Set containing the relations IDs
      */
     set<int> collection_set;
-
-    /**
-     *  Rebuilds the object from an xml node
-     *    @param node The xml node pointer
-     *
-     *    @return 0 on success, -1 otherwise
-     */
-    int from_xml_node(const xmlNodePtr node);
 };
 
 #endif /*OBJECT_COLLECTION_H_*/
@@ -27,6 +27,8 @@
 #include <libxml/xpath.h>
 #include <libxml/xpathInternals.h>
 
+#include "ObjectXMLDecoder.h"
+
 /**
  *  This class represents a generic Object supported by a xml document.
  *  The class provides basic methods to query attributes, and get xml nodes
@@ -117,6 +119,22 @@ public:
 
     void xpaths(std::vector<std::string>& values, const char * xpath_expr);
 
+    /**
+     *  Decodes the object document in a single pass, use it instead of
+     *  several xpath() calls when loading an object.
+     *    @param dec decoder with the bound elements
+     *    @return 0 on success, -1 for each element not found
+     */
+    int decode(ObjectXMLDecoder& dec) const
+    {
+        if ( xml == 0 )
+        {
+            return dec.decode(0);
+        }
+
+        return dec.decode(xmlDocGetRootElement(xml));
+    };
+
     /**
      *  Gets a xpath attribute, if the attribute is not found a default is used.
      *  This function only returns the first element
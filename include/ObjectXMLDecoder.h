@@ -0,0 +1,228 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#ifndef OBJECT_XML_DECODER_H_
+#define OBJECT_XML_DECODER_H_
+
+#include <string>
+#include <vector>
+
+#include <libxml/tree.h>
+
+/**
+ *  Decodes an object document in a single traversal. Element paths (e.g.
+ *  /HOST/HOST_SHARE/MEM_USAGE) are bound to object members before decoding;
+ *  the document is then walked once, visiting only the subtrees that contain
+ *  a bound path. It replaces a sequence of ObjectXML::xpath() calls, that
+ *  evaluate an XPath expression over the whole document for each member:
+ *
+ *    ObjectXMLDecoder dec;
+ *
+ *    dec.bind("/HOST/ID", oid, -1);
+ *    dec.bind("/HOST/NAME", name, "not_found");
+ *    dec.bind_node("/HOST/TEMPLATE", tmpl_node);
+ *
+ *    rc = dec.decode(root);
+ *
+ *  Values are converted as xpath() does: the member is set to the default
+ *  when bound, and overwritten if the element is found and can be converted.
+ *  Only the first element of a path is used, except for bind_all().
+ */
+class ObjectXMLDecoder
+{
+public:
+    ObjectXMLDecoder(){};
+
+    ~ObjectXMLDecoder(){};
+
+    /**
+     *  Binds an element to a numeric member
+     *    @param path of the element
+     *    @param value member, set to def
+     *    @param def default value if the element is not found
+     */
+    template<typename T>
+    void bind(const char * path, T& value, const T& def)
+    {
+        value = def;
+
+        bindings.push_back(Binding(path, SCALAR, &set_number<T>, &value));
+    };
+
+    void bind(const char * path, std::string& value, const char * def)
+    {
+        value = def;
+
+        bindings.push_back(Binding(path, SCALAR, &set_string, &value));
+    };
+
+    /**
+     *  Binds all the elements of a path (e.g. /HOST/VMS/ID) to a vector,
+     *  elements that cannot be converted are skipped
+     */
+    template<typename T>
+    void bind_all(const char * path, std::vector<T>& values)
+    {
+        bindings.push_back(Binding(path, LIST, &add_number<T>, &values));
+    };
+
+    void bind_all(const char * path, std::vector<std::string>& values)
+    {
+        bindings.push_back(Binding(path, LIST, &add_string, &values));
+    };
+
+    /**
+     *  Binds an element to a node, to be decoded by a nested object (e.g. a
+     *  Template). The node points to the decoded document and it is valid
+     *  while the document exists; node is set to 0 if not found.
+     */
+    void bind_node(const char * path, xmlNodePtr& node)
+    {
+        node = 0;
+
+        bindings.push_back(Binding(path, NODE, 0, &node));
+    };
+
+    /**
+     *  Decodes the document, bindings are not cleared so the decoder can
+     *  not be reused.
+     *    @param root element of the document
+     *    @return 0 if all the elements bound with bind() were found and
+     *    converted, -1 for each one missing (as a sum of xpath() calls).
+     */
+    int decode(const xmlNodePtr root);
+
+    // -------------------------------------------------------------------------
+    // Conversion functions, same semantics as ObjectXML::xpath()
+    // -------------------------------------------------------------------------
+    /**
+     *  Converts the content of an element
+     *    @param node the element
+     *    @param value converted
+     *    @return 0 on success, -1 otherwise (value is not modified)
+     */
+    template<typename T>
+    static int node_value(const xmlNodePtr node, T& value)
+    {
+        xmlChar *    alloc = 0;
+        const char * str   = content(node, &alloc);
+
+        int rc = to_value(str, value);
+
+        xmlFree(alloc);
+
+        return rc;
+    };
+
+    static int to_value(const char * str, int& value);
+
+    static int to_value(const char * str, long& value);
+
+    static int to_value(const char * str, long long& value);
+
+    static int to_value(const char * str, unsigned int& value);
+
+    static int to_value(const char * str, float& value);
+
+    static int to_value(const char * str, std::string& value);
+
+private:
+    /**
+     *  Sets a member from the element content, returns -1 if the content
+     *  cannot be converted
+     */
+    typedef int (*setter_t)(const char * str, void * value);
+
+    enum BindingType
+    {
+        SCALAR = 0,
+        LIST   = 1,
+        NODE   = 2
+    };
+
+    struct Binding
+    {
+        Binding(const char * _path, BindingType _type, setter_t _setter,
+                void * _value):path(_path), type(_type), setter(_setter),
+            value(_value), done(false), failed(false){};
+
+        std::string path;
+
+        BindingType type;
+
+        setter_t    setter;
+
+        void *      value;
+
+        bool        done;
+
+        bool        failed;
+    };
+
+    std::vector<Binding> bindings;
+
+    /**
+     *  Number of bindings still pending, used to end the traversal. Bindings
+     *  to lists are always pending.
+     */
+    unsigned int pending;
+
+    /**
+     *  Visits the element children of node
+     *    @param node parent
+     *    @param path of the parent, children names are appended to it
+     */
+    void visit(const xmlNodePtr node, std::string& path);
+
+    /**
+     *  @return true if a pending binding is under the given path
+     */
+    bool is_prefix(const std::string& path) const;
+
+    /**
+     *  Gets the text of an element. If it has a single text (or CDATA) child
+     *  its content is returned without copying it; otherwise it is allocated
+     *  in alloc, and must be freed by the caller.
+     */
+    static const char * content(const xmlNodePtr node, xmlChar ** alloc);
+
+    template<typename T>
+    static int set_number(const char * str, void * value)
+    {
+        return to_value(str, *static_cast<T *>(value));
+    };
+
+    template<typename T>
+    static int add_number(const char * str, void * value)
+    {
+        T val;
+
+        if ( to_value(str, val) != 0 )
+        {
+            return -1;
+        }
+
+        static_cast<std::vector<T> *>(value)->push_back(val);
+
+        return 0;
+    };
+
+    static int set_string(const char * str, void * value);
+
+    static int add_string(const char * str, void * value);
+};
+
+#endif /*OBJECT_XML_DECODER_H_*/
@@ -129,6 +129,9 @@ public:
              locked(false),
              lock_owner(""),
              lock_expires(0),
+             version(0),
+             body_digest(""),
+             body_time(0),
              table(_table)
     {
         pthread_mutex_init(&mutex,0);
@@ -178,6 +181,15 @@ public:
         return name;
     };
 
+    /**
+     *  @return the number of body writes since the object was loaded, an
+     *  update that skipped an unchanged body does not increase it
+     */
+    unsigned long get_version() const
+    {
+        return version;
+    };
+
     /**
      *  Set the name of the object and check if it is valid.
      *    @param _name the new name
@@ -325,6 +337,40 @@ public:
      */
     virtual int from_xml(const string &xml_str) = 0;
 
+    /**
+     *  Renders the object body to store it in the DB. The body is in binary
+     *  format if enabled and implemented by the object (to_binary), XML
+     *  otherwise.
+     *    @param body the resulting body
+     *    @return a reference to the generated string
+     */
+    string& to_body(string& body) const;
+
+    /**
+     *  Rebuilds the object from its DB body, in XML or binary format. The
+     *  digest of the body is updated.
+     *    @param body as stored in the DB
+     *    @return 0 on success, -1 otherwise
+     */
+    int from_body(const string& body);
+
+    /**
+     *  Sets the format of the DB body for the objects that implement it
+     *    @param binary true to use the binary format, false for XML
+     */
+    static void set_binary_body(bool binary)
+    {
+        binary_body = binary;
+    };
+
+    /**
+     *  @return true if bodies are written in binary format
+     */
+    static bool is_binary_body()
+    {
+        return binary_body;
+    };
+
     // ------------------------------------------------------------------------
     // Template
     // ------------------------------------------------------------------------
@@ -538,7 +584,7 @@ protected:
             return -1;
         }
 
-        return from_xml(values[0]);
+        return from_body(values[0]);
     };
 
     /**
@@ -555,6 +601,77 @@ protected:
      */
     virtual int select(SqlDB *db, const string& _name, int _uid);
 
+    /**
+     *  Returns the NULL terminated list of top level elements of the body that
+     *  change on every monitoring cycle (e.g. LAST_POLL). They are not
+     *  considered when checking if the body needs to be written to the DB.
+     */
+    virtual const char * const * volatile_elements() const
+    {
+        return 0;
+    };
+
+    /**
+     *  @return the time stored in the volatile elements of the object (e.g.
+     *  LAST_POLL), 0 if the object has none
+     */
+    virtual time_t volatile_time() const
+    {
+        return 0;
+    };
+
+    /**
+     *  Writes the object in binary format, see ObjectBinary.h. Objects that
+     *  support the binary body must implement to_binary and from_binary.
+     *    @param bw the binary writer
+     *    @return 0 on success, -1 if not supported
+     */
+    virtual int to_binary(BinaryWriter& bw) const
+    {
+        return -1;
+    };
+
+    /**
+     *  Rebuilds the object from its binary format
+     *    @param br the binary reader
+     *    @return 0 on success, -1 otherwise
+     */
+    virtual int from_binary(BinaryReader& br)
+    {
+        return -1;
+    };
+
+    /**
+     *  Computes the digest of the object body, without the volatile elements
+     *    @param body of the object as stored in the DB
+     *    @return the digest
+     */
+    string digest_body(const string& body) const;
+
+    /**
+     *  Checks if the body of the object needs to be written to the DB. This is
+     *  the case when the body differs from the one last read or written, or
+     *  when its volatile time (e.g. LAST_POLL) has been set or reset, or has
+     *  drifted more than BODY_REFRESH seconds from the one in the DB body.
+     *    @param body of the object as stored in the DB
+     *    @param digest of the body, to be used with body_written
+     *    @return true if the body needs to be written
+     */
+    bool body_changed(const string& body, string& digest) const;
+
+    /**
+     *  Updates the digest, volatile time and version of the persisted body. It
+     *  must be called after the body has been successfully written to the DB
+     *    @param digest of the body as returned by body_changed
+     */
+    void body_written(const string& digest)
+    {
+        body_digest = digest;
+        body_time   = volatile_time();
+
+        version++;
+    };
+
     /**
      *  Drops object from the database
      *    @param db pointer to the db
@@ -734,6 +851,24 @@ protected:
      */
     time_t  lock_expires;
 
+    /**
+     *  Number of times the body has been written to the DB since the object
+     *  was loaded, see get_version
+     */
+    unsigned long version;
+
+    /**
+     *  Digest of the last body read from or written to the DB
+     */
+    string  body_digest;
+
+    /**
+     *  Volatile time (e.g. LAST_POLL) of the last body read from or written to
+     *  the DB. The object is loaded from the DB body, so it is kept across
+     *  pool reads.
+     */
+    time_t  body_time;
+
 private:
     /**
      *  Characters that can not be in a name
@@ -745,6 +880,17 @@ private:
      */
     static const int LOCK_DB_EXPIRATION;
 
+    /**
+     *  Max drift of the volatile time of a body with only volatile changes
+     *  before it is written
+     */
+    static const int BODY_REFRESH;
+
+    /**
+     *  Write bodies in binary format
+     */
+    static bool binary_body;
+
     /**
      *  The PoolSQL, friend to easily manipulate its Objects
      */
@@ -60,6 +60,20 @@ public:
         PoolObjectSQL   *objsql,
         string&          error_str);
 
+    /**
+     *  Allocates a set of objects with consecutive oids, reserved at once.
+     *  The objects are inserted in order, the allocation stops at the first
+     *  failure. No memory is allocated for the objects.
+     *   @param objs initialized ObjectSQLs
+     *   @param oids assigned to the objects inserted in the DB
+     *   @param error_str Returns the error reason, if any
+     *   @return 0 if all the objects were allocated, -1 otherwise
+     */
+    int allocate(
+        vector<PoolObjectSQL *>& objs,
+        vector<int>&             oids,
+        string&                  error_str);
+
     /**
      *  Gets an object from the pool (if needed the object is loaded from the
      *  database).
@@ -162,6 +176,14 @@ public:
      */
     void clean();
 
+    /**
+     *  Rewrites the bodies of the pool objects that are not in the format
+     *  set in PoolObjectSQL (binary or XML). Must be called at start up in
+     *  solo mode, hooks are not triggered.
+     *    @return 0 on success
+     */
+    int migrate_bodies();
+
     /**
      *  Dumps the pool in XML format. A filter can be also added to the
      *  query
@@ -188,6 +210,22 @@ public:
     virtual int dump(ostringstream& oss, const string& where,
                      const string& limit) = 0;
 
+    /**
+     *  Dumps a summary of the pool in XML format, with the attributes shown
+     *  in pool listings. Pools that do not keep object summaries in the DB
+     *  dump the full objects.
+     *  @param oss the output stream to dump the pool contents
+     *  @param where filter for the objects, defaults to all
+     *  @param limit parameters used for pagination
+     *
+     *  @return 0 on success
+     */
+    virtual int dump_summary(ostringstream& oss, const string& where,
+                             const string& limit)
+    {
+        return dump(oss, where, limit);
+    };
+
     // -------------------------------------------------------------------------
     // Function to generate dump filters
     // -------------------------------------------------------------------------
@@ -282,6 +320,28 @@ protected:
              const string&  elem_name,
              const char *   table,
              const string&  where,
+             const string&  limit)
+    {
+        return dump(oss, elem_name, "body", table, where, limit);
+    }
+
+    /**
+     *  Dumps a column of the pool table (e.g. body or short_body) in XML
+     *  format. A filter and limit can be also added to the query
+     *  @param oss the output stream to dump the pool contents
+     *  @param elem_name Name of the root xml pool name
+     *  @param column with the XML document of each object
+     *  @param table Pool table name
+     *  @param where filter for the objects, defaults to all
+     *  @param limit parameters used for pagination
+     *
+     *  @return 0 on success
+     */
+    int dump(ostringstream& oss,
+             const string&  elem_name,
+             const char *   column,
+             const char *   table,
+             const string&  where,
              const string&  limit);
 
     /**
@@ -327,7 +387,7 @@ protected:
     /* Interface to access the lastOID assigned by the pool                   */
     /* ---------------------------------------------------------------------- */
     /**
-     *  Gets the value of the last identifier assigned by the pool
+     *  Gets the value of the last identifier reserved by the pool
      *   @return the lastOID of the pool
      */
     int get_lastOID();
@@ -347,6 +407,33 @@ private:
      */
     string table;
 
+    /* ---------------------------------------------------------------------- */
+    /* OID sequence. OIDs are reserved in blocks of OID_BLOCK ids, only the   */
+    /* last OID of the block is stored in pool_control. Unused OIDs of a block*/
+    /* are lost when oned is restarted or a new leader is elected.            */
+    /* ---------------------------------------------------------------------- */
+    static const int OID_BLOCK;
+
+    pthread_mutex_t oid_mutex;
+
+    /**
+     *  Next OID to be assigned, -1 if no block has been reserved
+     */
+    int next_oid;
+
+    /**
+     *  Last OID of the reserved block
+     */
+    int reserved_oid;
+
+    /**
+     *  Gets a range of consecutive OIDs, a new block is reserved if the
+     *  current one has not enough OIDs.
+     *    @param count number of OIDs
+     *    @return the first OID of the range, -1 if the block cannot be stored
+     */
+    int reserve_oids(int count);
+
     /**
      *  The pool is implemented with a Map of SQL object pointers, using the
      *  OID as key.
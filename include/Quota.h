@@ -174,7 +174,7 @@ public:
       */
      virtual int get_quota(const string& id, VectorAttribute **va)
      {
-         map<string, Attribute *>::iterator it;
+         FlatMultiMap<string, Attribute *>::iterator it;
          return get_quota(id, va, it);
      }
 
@@ -284,7 +284,7 @@ protected:
     virtual int get_quota(
             const string& id,
             VectorAttribute **va,
-            map<string, Attribute *>::iterator& it);
+            FlatMultiMap<string, Attribute *>::iterator& it);
 
     /**
      * Checks if a quota has 0 limit and usage, and deletes it
@@ -98,7 +98,7 @@ protected:
     int get_quota(
             const string& id,
             VectorAttribute **va,
-            map<string, Attribute *>::iterator& it)
+            FlatMultiMap<string, Attribute *>::iterator& it)
     {
         it = attributes.begin();
         return get_quota(id, va);
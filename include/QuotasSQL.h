@@ -17,9 +17,81 @@
 #ifndef GROUP_QUOTAS_H_
 #define GROUP_QUOTAS_H_
 
+#include <pthread.h>
+#include <map>
+
 #include "Quotas.h"
 #include "ObjectSQL.h"
 
+/**
+ *  The QuotasLedger writes quota updates to the DB with group commit. The
+ *  quotas updated concurrently by different threads are written in a single
+ *  SQL statement (and Raft log record in HA), the first thread performs the
+ *  write while the rest wait for it. Updates are persisted when commit
+ *  returns, so quotas in the DB are always up to date.
+ */
+class QuotasLedger
+{
+public:
+    QuotasLedger(const char * _table, const char * _names);
+
+    ~QuotasLedger();
+
+    /**
+     *  Writes the quotas of a user or group, together with any other update
+     *  waiting in the ledger
+     *    @param db pointer to the db
+     *    @param oid of the user or group
+     *    @param sql_xml escaped quotas body
+     *    @return 0 on success
+     */
+    int commit(SqlDB * db, int oid, const string& sql_xml);
+
+private:
+    /**
+     *  Set of quota updates written in the same statement
+     */
+    struct Batch
+    {
+        Batch():rc(0), done(false), refs(0){};
+
+        map<int, string> bodies;
+
+        int  rc;
+
+        bool done;
+
+        int  refs;
+    };
+
+    const char * table;
+
+    const char * names;
+
+    pthread_mutex_t mutex;
+
+    pthread_cond_t  cond;
+
+    /**
+     *  Batch open to new updates
+     */
+    Batch * filling;
+
+    /**
+     *  A thread is writing a batch
+     */
+    bool writing;
+
+    /**
+     *  Writes the quotas of a batch in the DB
+     *    @return 0 on success
+     */
+    int write(SqlDB * db, const map<int, string>& bodies);
+};
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 class QuotasSQL : public Quotas, ObjectSQL
 {
 public:
@@ -82,6 +154,8 @@ protected:
 
     virtual const char * table_oid_column() const = 0;
 
+    virtual QuotasLedger& ledger() const = 0;
+
     int from_xml(const string& xml);
 
 private:
@@ -187,6 +261,11 @@ protected:
         return db_oid_column;
     };
 
+    QuotasLedger& ledger() const
+    {
+        return db_ledger;
+    };
+
 private:
 
     friend class GroupPool;
@@ -198,6 +277,8 @@ private:
     static const char * db_bootstrap;
     static const char * db_table;
     static const char * db_oid_column;
+
+    static QuotasLedger db_ledger;
 };
 
 /* -------------------------------------------------------------------------- */
@@ -240,6 +321,11 @@ protected:
         return db_oid_column;
     };
 
+    QuotasLedger& ledger() const
+    {
+        return db_ledger;
+    };
+
 private:
 
     friend class UserPool;
@@ -251,6 +337,8 @@ private:
     static const char * db_bootstrap;
     static const char * db_table;
     static const char * db_oid_column;
+
+    static QuotasLedger db_ledger;
 };
 
 #endif /*QUOTAS_SQL_H_*/
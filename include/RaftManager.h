@@ -78,8 +78,40 @@ public:
      *  detected (same index, different term):
      *    - Decrease follower next_index
      *    - Retry (do not wait for replica events)
+     *    @param follower_id of the server
+     *    @param flast last log index in the follower, -1 if not known. It is
+     *    used to skip the records missing in the follower log
      */
-    void replicate_failure(int follower_id);
+    void replicate_failure(int follower_id, int flast = -1);
+
+    /**
+     *  Follower successfully installed a DB snapshot:
+     *    - Update match and next entries on follower to the snapshot index
+     *    - Continue replicating the log records after the snapshot
+     *    @param follower_id of the server
+     *    @param index of the last log record included in the snapshot
+     */
+    void snapshot_success(int follower_id, unsigned int index);
+
+    /**
+     *  Writes a chunk of a DB snapshot sent by the leader. The snapshot is
+     *  installed in the DB when the last chunk is received. Chunks must belong
+     *  to the transfer started by chunk 0 (same leader, term and index).
+     *  Snapshots already committed by the follower (index <= commit) are not
+     *  installed, their chunks are acknowledged so the leader moves on.
+     *    @param leader_id of the server sending the snapshot
+     *    @param leader_term of the server sending the snapshot
+     *    @param index of the last log record included in the snapshot
+     *    @param term of the last log record included in the snapshot
+     *    @param chunk sequence number, starting at 0
+     *    @param data of the chunk (base64 encoded)
+     *    @param last true if this is the last chunk of the snapshot
+     *    @param error string if any
+     *    @return 0 on success
+     */
+    int receive_snapshot(int leader_id, unsigned int leader_term,
+            unsigned int index, unsigned int term, int chunk,
+            const std::string& data, bool last, std::string& error);
 
     /**
      *  Triggers a REPLICATE event, it will notify the replica threads to
@@ -238,7 +270,43 @@ public:
      *    @return -1 if a XMl-RPC (network) error occurs, 0 otherwise
      */
 	int xmlrpc_replicate_log(int follower_id, LogDBRecord * lr, bool& success,
-			unsigned int& ft, std::string& error);
+			unsigned int& ft, std::string& error)
+    {
+        int flast;
+
+        return xmlrpc_replicate_log(follower_id, lr, success, ft, flast, error);
+    };
+
+    /**
+     *  Calls the follower xml-rpc method
+	 *    @param follower_id to make the call
+     *    @param lr the record to replicate
+     *    @param success of the xml-rpc method
+     *    @param ft term in the follower as returned by the replicate call
+     *    @param flast last log index in the follower when the previous record
+     *    is missing in its log, -1 otherwise
+	 *    @param error describing error if any
+     *    @return -1 if a XMl-RPC (network) error occurs, 0 otherwise
+     */
+	int xmlrpc_replicate_log(int follower_id, LogDBRecord * lr, bool& success,
+			unsigned int& ft, int& flast, std::string& error);
+
+    /**
+     *  Sends a chunk of a DB snapshot to the follower
+	 *    @param follower_id to make the call
+     *    @param index of the last log record included in the snapshot
+     *    @param term of the last log record included in the snapshot
+     *    @param chunk sequence number, starting at 0
+     *    @param data of the chunk (base64 encoded)
+     *    @param last true if this is the last chunk of the snapshot
+     *    @param success of the xml-rpc method
+     *    @param ft term in the follower as returned by the call
+	 *    @param error describing error if any
+     *    @return -1 if a XMl-RPC (network) error occurs, 0 otherwise
+     */
+    int xmlrpc_install_snapshot(int follower_id, unsigned int index,
+            unsigned int term, int chunk, const std::string& data, bool last,
+            bool& success, unsigned int& ft, std::string& error);
 
     /**
      *  Calls the request vote xml-rpc method
@@ -341,11 +409,15 @@ private:
     //    - timer_period_ms. Base timer to wake up the manager (10ms)
     //    - purge_period_ms. How often the LogDB is purged (600s)
     //    - xmlrpc_timeout. To timeout xml-rpc api calls to replicate log
+    //    - snapshot_timeout_ms. To timeout snapshot chunks, the last one
+    //      includes the DB install in the follower
 	//    - election_timeout. Timeout leader heartbeats (followers)
 	//    - broadcast_timeout. To send heartbeat to followers (leader)
     //--------------------------------------------------------------------------
     static const time_t timer_period_ms;
 
+    static const time_t snapshot_timeout_ms;
+
     time_t purge_period_ms;
 
     time_t xmlrpc_timeout_ms;
@@ -377,6 +449,20 @@ private:
 
     std::map<int, std::string>  servers;
 
+    //---------------------------- FOLLOWER VARIABLES --------------------------
+    //
+    //   - snapshot_chunk, next chunk of the snapshot being received
+    //   - snapshot_leader, snapshot_lterm, snapshot_index, the transfer of the
+    //     chunks (leader id and term, and index of the snapshot)
+    // -------------------------------------------------------------------------
+    int snapshot_chunk;
+
+    int snapshot_leader;
+
+    unsigned int snapshot_lterm;
+
+    unsigned int snapshot_index;
+
     // -------------------------------------------------------------------------
     // Hooks
     // -------------------------------------------------------------------------
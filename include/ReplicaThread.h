@@ -122,6 +122,17 @@ private:
      */
     int replicate();
 
+    /**
+     *  Sends a DB snapshot to the follower, used when the records it needs
+     *  are no longer in the log
+     */
+    int install_snapshot();
+
+    /**
+     *  Size of the snapshot chunks sent in each xml-rpc call
+     */
+    static const size_t snapshot_chunk_size;
+
     /**
      * Pointers to other components
      */
@@ -179,6 +179,13 @@ protected:
 
     bool leader_only; //Method can be only execute by leaders or solo servers
 
+    /**
+     *  Method accepts a {READ_INDEX: int} struct as last parameter, see
+     *  wait_read_index. Set by the object info (one.<obj>.info) and pool info
+     *  (RequestManagerPoolInfoFilter) methods.
+     */
+    bool read_index;
+
     static const long long xmlrpc_timeout; //Timeout (ms) for request forwarding
 
     /* ---------------------------------------------------------------------- */
@@ -195,6 +202,8 @@ protected:
         log_method_call = true;
 
         leader_only     = true;
+
+        read_index      = false;
     };
 
     virtual ~Request(){};
@@ -268,6 +277,23 @@ protected:
      */
     void success_response(bool val, RequestAttributes& att);
 
+    /**
+     *  Builds an XML-RPC response updating retval. After calling this function
+     *  the xml-rpc execute method should return
+     *    @param val array of ids to be returned to the client
+     *    @param att the specific request attributes
+     */
+    void success_response(const vector<int>& val, RequestAttributes& att);
+
+    /**
+     *  Builds an XML-RPC response updating retval. After calling this function
+     *  the xml-rpc execute method should return
+     *    @param val array to be returned to the client
+     *    @param att the specific request attributes
+     */
+    void success_response(const xmlrpc_c::value_array& val,
+            RequestAttributes& att);
+
     /**
      *  Builds an XML-RPC response updating retval. After calling this function
      *  the xml-rpc excute method should return. A descriptive error message
@@ -405,6 +431,27 @@ private:
      */
     void failure_response(ErrorCode ec, const string& va, RequestAttributes& ra);
 
+    /**
+     *  Waits until the log index requested by the client is applied to the
+     *  DB, so the reads served by followers include the client previous
+     *  writes. The index is sent as a trailing struct {READ_INDEX: int}, it
+     *  is removed from the parameters passed to the method. A failure
+     *  response is built if the index is not applied in xmlrpc_timeout ms.
+     *    @param _paramList list of XML parameters, the last one is the index
+     *    @param paramList the method parameters (without the index)
+     *    @param att the specific request attributes
+     *    @return true if the request can be served
+     */
+    bool wait_read_index(xmlrpc_c::paramList const& _paramList,
+        xmlrpc_c::paramList& paramList, RequestAttributes& att);
+
+    /**
+     *  Adds the last log index applied to the DB to a successful response. It
+     *  can be used by the client as the read index of later requests.
+     *    @param att the specific request attributes
+     */
+    void add_log_index(RequestAttributes& att);
+
     /**
      * Logs the method invocation, including the arguments
      * @param att the specific request attributes
@@ -36,6 +36,8 @@ protected:
         auth_op = AuthRequest::USE;
 
         leader_only = false;
+
+        read_index  = true;
     };
 
     ~RequestManagerInfo(){};
@@ -62,13 +62,21 @@ protected:
     RequestManagerPoolInfoFilter(const string& method_name,
                                  const string& help,
                                  const string& signature)
-        :Request(method_name,signature,help)
+        :Request(method_name,signature,help), summary(false)
     {
         leader_only = false;
+
+        read_index  = true;
     };
 
     ~RequestManagerPoolInfoFilter(){};
 
+    /**
+     *  Dump the object summaries (PoolSQL::dump_summary) instead of the
+     *  full objects
+     */
+    bool summary;
+
     /* -------------------------------------------------------------------- */
 
     virtual void request_execute(
@@ -95,6 +103,20 @@ protected:
               int                end_id,
               const string&      and_clause,
               const string&      or_clause);
+
+    /**
+     *  Builds the LIMIT clause for paginated requests (end_id < -1)
+     */
+    static void limit_filter(int start_id, int end_id, string& limit_clause)
+    {
+        if ( end_id < -1 )
+        {
+            ostringstream oss;
+
+            oss << start_id << "," << -end_id;
+            limit_clause = oss.str();
+        }
+    };
 };
 
 /* ------------------------------------------------------------------------- */
@@ -126,6 +148,31 @@ public:
 
     void request_execute(
             xmlrpc_c::paramList const& paramList, RequestAttributes& att);
+
+protected:
+    VirtualMachinePoolInfo(const string& method_name, const string& help):
+        RequestManagerPoolInfoFilter(method_name, help, "A:siiii")
+    {
+        Nebula& nd  = Nebula::instance();
+        pool        = nd.get_vmpool();
+        auth_object = PoolObjectSQL::VM;
+    };
+};
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------------------------------------------------------- */
+
+class VirtualMachinePoolSummary : public VirtualMachinePoolInfo
+{
+public:
+    VirtualMachinePoolSummary():
+        VirtualMachinePoolInfo("one.vmpool.summary",
+                               "Returns a summary of the virtual machine pool")
+    {
+        summary = true;
+    };
+
+    ~VirtualMachinePoolSummary(){};
 };
 
 /* ------------------------------------------------------------------------- */
@@ -206,6 +253,31 @@ public:
 /* ------------------------------------------------------------------------- */
 /* ------------------------------------------------------------------------- */
 
+class VirtualMachinePoolArchive : public RequestManagerPoolInfoFilter
+{
+public:
+
+    VirtualMachinePoolArchive():
+        RequestManagerPoolInfoFilter("one.vmpool.archive",
+                                     "Returns the archived (DONE) virtual machines",
+                                     "A:siii")
+    {
+        Nebula& nd  = Nebula::instance();
+        pool        = nd.get_vmpool();
+        auth_object = PoolObjectSQL::VM;
+    };
+
+    ~VirtualMachinePoolArchive(){};
+
+    /* -------------------------------------------------------------------- */
+
+    void request_execute(
+            xmlrpc_c::paramList const& paramList, RequestAttributes& att);
+};
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------------------------------------------------------- */
+
 class TemplatePoolInfo : public RequestManagerPoolInfoFilter
 {
 public:
@@ -261,6 +333,31 @@ public:
     };
 
     ~ImagePoolInfo(){};
+
+protected:
+    ImagePoolInfo(const string& method_name, const string& help):
+        RequestManagerPoolInfoFilter(method_name, help, "A:siii")
+    {
+        Nebula& nd  = Nebula::instance();
+        pool        = nd.get_ipool();
+        auth_object = PoolObjectSQL::IMAGE;
+    };
+};
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------------------------------------------------------- */
+
+class ImagePoolSummary: public ImagePoolInfo
+{
+public:
+    ImagePoolSummary():
+        ImagePoolInfo("one.imagepool.summary",
+                      "Returns a summary of the image pool")
+    {
+        summary = true;
+    };
+
+    ~ImagePoolSummary(){};
 };
 
 /* ------------------------------------------------------------------------- */
@@ -285,6 +382,31 @@ public:
 
     void request_execute(
             xmlrpc_c::paramList const& paramList, RequestAttributes& att);
+
+protected:
+    HostPoolInfo(const string& method_name, const string& help):
+        RequestManagerPoolInfoFilter(method_name, help, "A:s")
+    {
+        Nebula& nd  = Nebula::instance();
+        pool        = nd.get_hpool();
+        auth_object = PoolObjectSQL::HOST;
+    };
+};
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------------------------------------------------------- */
+
+class HostPoolSummary : public HostPoolInfo
+{
+public:
+    HostPoolSummary():
+        HostPoolInfo("one.hostpool.summary",
+                     "Returns a summary of the host pool")
+    {
+        summary = true;
+    };
+
+    ~HostPoolSummary(){};
 };
 
 /* ------------------------------------------------------------------------- */
@@ -100,4 +100,36 @@ protected:
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+class VMTemplateInstantiateBulk : public RequestManagerVMTemplate
+{
+public:
+    VMTemplateInstantiateBulk():
+        RequestManagerVMTemplate("one.template.instantiatebulk", "Instantiates"
+            " a set of virtual machines using a template", "A:sisibsA")
+    {
+        auth_op = AuthRequest::USE;
+    };
+
+    ~VMTemplateInstantiateBulk(){};
+
+protected:
+
+    /**
+     *  The template is merged with the user attributes and authorized once.
+     *  Quotas are checked for all the VMs in a single update. Parameters:
+     *    - Template ID
+     *    - Name of the VMs, "%i" is replaced by the VM index. Can be empty
+     *    - Number of VMs
+     *    - on_hold (optional)
+     *    - Template merged with the original contents (optional)
+     *    - Array of templates merged with each VM template (optional)
+     *  The response includes the array of new VM IDs
+     */
+    void request_execute(xmlrpc_c::paramList const& _paramList,
+                         RequestAttributes& att);
+};
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 #endif
@@ -127,6 +127,28 @@ public:
 /* ------------------------------------------------------------------------- */
 /* ------------------------------------------------------------------------- */
 
+class VirtualMachineActionBulk : public RequestManagerVirtualMachine
+{
+public:
+    //auth_op is set for each request from the action, as in one.vm.action
+    VirtualMachineActionBulk():
+        RequestManagerVirtualMachine("one.vm.actionbulk",
+                                     "Performs an action on a set of virtual "
+                                     "machines", "A:ssA"){};
+    ~VirtualMachineActionBulk(){};
+
+    /**
+     *  The VMs are authorized in a single request and the action is triggered
+     *  for each of them. The response includes an array with the result for
+     *  each VM: [ID, success, error message]
+     */
+    void request_execute(xmlrpc_c::paramList const& _paramList,
+            RequestAttributes& att);
+};
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------------------------------------------------------- */
+
 class VirtualMachineDeploy : public RequestManagerVirtualMachine
 {
 public:
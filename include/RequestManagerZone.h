@@ -104,6 +104,26 @@ public:
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+class ZoneInstallSnapshot : public RequestManagerZone
+{
+public:
+    ZoneInstallSnapshot():
+        RequestManagerZone("one.zone.installsnapshot",
+                "Install a DB snapshot from the leader", "A:siiiiisb")
+    {
+        log_method_call = false;
+        leader_only     = false;
+    };
+
+    ~ZoneInstallSnapshot(){};
+
+    void request_execute(xmlrpc_c::paramList const& _paramList,
+                         RequestAttributes& att);
+};
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 class ZoneVoteRequest : public RequestManagerZone
 {
 public:
@@ -156,4 +176,23 @@ public:
                          RequestAttributes& att);
 };
 
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+class ZoneReplicateFedLogBatch : public RequestManagerZone
+{
+public:
+    ZoneReplicateFedLogBatch():
+        RequestManagerZone("one.zone.fedreplicatebatch",
+                "Replicate a batch of fed log records", "A:siis")
+    {
+        log_method_call = false;
+    };
+
+    ~ZoneReplicateFedLogBatch(){};
+
+    void request_execute(xmlrpc_c::paramList const& _paramList,
+                         RequestAttributes& att);
+};
+
 #endif
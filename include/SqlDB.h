@@ -18,10 +18,61 @@
 #define SQL_DB_H_
 
 #include <sstream>
+#include <vector>
 #include "Callbackable.h"
 
 using namespace std;
 
+/**
+ *  Secondary index of a DB table. Tables declare their indexes as an array
+ *  terminated by an entry with a null name, e.g.
+ *    { {"vm_pool_state_idx", "vm_pool", "state, lcm_state"}, {0, 0, 0} }
+ */
+struct SqlIndex
+{
+    const char * name;    /**< Index name, unique in the DB */
+    const char * table;   /**< Indexed table */
+    const char * columns; /**< Comma separated list of columns */
+};
+
+/**
+ *  Source of SQL commands for SqlDB::exec_transaction. Commands are read one
+ *  at a time, so large sets of commands (e.g. a DB snapshot) are not loaded
+ *  in memory.
+ */
+class SqlCommandReader
+{
+public:
+    virtual ~SqlCommandReader(){};
+
+    /**
+     *  Reads the next command
+     *    @param cmd the SQL command
+     *    @return 0 on success, 1 if there are no more commands, -1 on error
+     */
+    virtual int next(string& cmd) = 0;
+};
+
+/**
+ *  Consistent read-only view of the DB, as returned by SqlDB::open_snapshot.
+ *  Reads are served from a dedicated connection (or a copy of the DB), so
+ *  they do not block the DB writers and do not see their changes. The view
+ *  is released when the object is deleted.
+ */
+class SqlSnapshot
+{
+public:
+    virtual ~SqlSnapshot(){};
+
+    /**
+     *  Reads from the view
+     *    @param cmd the SQL query
+     *    @param obj callback to process each row
+     *    @return 0 on success
+     */
+    virtual int exec_rd(ostringstream& cmd, Callbackable* obj) = 0;
+};
+
 /**
  * SqlDB class.Provides an abstract interface to implement a SQL backend
  */
@@ -83,6 +134,46 @@ public:
      */
     virtual bool multiple_values_support() = 0;
 
+    /**
+     *  Checks if an index is defined for a table
+     *    @param table name of the table
+     *    @param name of the index
+     *    @return 1 if the index exists, 0 if not and -1 on DB error
+     */
+    virtual int index_exists(const string& table, const string& name) = 0;
+
+    /**
+     *  Gets the names of the tables defined in the DB
+     *    @param tables names of the tables
+     *    @return 0 on success
+     */
+    virtual int table_names(vector<string>& tables) = 0;
+
+    /**
+     *  Executes a set of SQL commands in a single transaction, in the local DB
+     *  only. Either all the commands are applied or none.
+     *    @param cmds the SQL commands
+     *    @return 0 on success
+     */
+    virtual int exec_transaction(SqlCommandReader& cmds) = 0;
+
+    /**
+     *  Opens a consistent read-only view of the local DB with its contents
+     *  at the time of the call (e.g. to dump a snapshot while the DB is being
+     *  updated).
+     *    @return the view, to be deleted by the caller. 0 on error
+     */
+    virtual SqlSnapshot * open_snapshot() = 0;
+
+    /**
+     *  Creates the indexes not defined in the DB. Missing indexes are
+     *  reported in the log. Indexes are not replicated, they are created
+     *  in the local DB only.
+     *    @param indexes array of indexes, terminated by a null name
+     *    @return 0 on success
+     */
+    int create_indexes(const SqlIndex * indexes);
+
 protected:
     /**
      *  Performs a DB transaction
@@ -71,6 +71,37 @@ public:
      */
     bool multiple_values_support();
 
+    /**
+     *  Checks if an index is defined for a table
+     *    @param table name of the table
+     *    @param name of the index
+     *    @return 1 if the index exists, 0 if not and -1 on DB error
+     */
+    int index_exists(const string& table, const string& name);
+
+    /**
+     *  Gets the names of the tables defined in the DB
+     *    @param tables names of the tables
+     *    @return 0 on success
+     */
+    int table_names(vector<string>& tables);
+
+    /**
+     *  Executes a set of SQL commands in a single transaction. The DB mutex
+     *  is held for the whole transaction.
+     *    @param cmds the SQL commands
+     *    @return 0 on success
+     */
+    int exec_transaction(SqlCommandReader& cmds);
+
+    /**
+     *  Copies the DB to a temporary DB with the online backup API, holding
+     *  the DB mutex only for the copy. A read transaction on a second
+     *  connection would block the writers of this one until it ends.
+     *    @return the DB view, 0 on error
+     */
+    SqlSnapshot * open_snapshot();
+
 protected:
     /**
      *  Wraps the sqlite3_exec function call, and locks the DB mutex.
@@ -128,6 +159,14 @@ public:
 
     bool multiple_values_support(){return true;};
 
+    int index_exists(const string& table, const string& name){return -1;};
+
+    int table_names(vector<string>& tables){return -1;};
+
+    int exec_transaction(SqlCommandReader& cmds){return -1;};
+
+    SqlSnapshot * open_snapshot(){return 0;};
+
 protected:
     int exec(ostringstream& cmd, Callbackable* obj, bool quiet){return -1;};
 };
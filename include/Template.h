@@ -25,6 +25,7 @@
 #include <libxml/parser.h>
 
 #include "Attribute.h"
+#include "ObjectBinary.h"
 
 using namespace std;
 
@@ -49,7 +50,7 @@ public:
 
     Template(const Template& t)
     {
-        multimap<string,Attribute *>::const_iterator it;
+        FlatMultiMap<string, Attribute *>::const_iterator it;
 
         replace_mode = t.replace_mode;
         separator    = t.separator;
@@ -65,7 +66,7 @@ public:
 
     Template& operator=(const Template& t)
     {
-        multimap<string,Attribute *>::const_iterator it;
+        FlatMultiMap<string, Attribute *>::const_iterator it;
 
         if (this != &t)
         {
@@ -138,6 +139,19 @@ public:
      */
     int from_xml_node(const xmlNodePtr node);
 
+    /**
+     *  Writes the template attributes in binary format, see ObjectBinary.h
+     *    @param bw the binary writer
+     */
+    void to_binary(BinaryWriter& bw) const;
+
+    /**
+     *  Rebuilds the template from its binary format
+     *    @param br the binary reader
+     *    @return 0 on success, -1 otherwise
+     */
+    int from_binary(BinaryReader& br);
+
     /**
      *  Writes the Template into a output stream in txt format
      */
@@ -170,6 +184,14 @@ public:
      */
     string& to_xml(string& xml) const;
 
+    /**
+     *  Same as above but the template is appended to the buffer, so it can be
+     *  used to render it as part of an object without copying it
+     *    @param buffer to append the xml template representation
+     *    @return a reference to the buffer
+     */
+    string& append_xml(string& buffer) const;
+
     /**
      *  Writes the template in a plain text string
      *    @param str string that hold the template representation
@@ -265,10 +287,10 @@ public:
     template<typename T>
     int remove(const string& name, vector<T *>& values)
     {
-        pair<multimap<string, Attribute *>::iterator,
-             multimap<string, Attribute *>::iterator> index;
+        pair<FlatMultiMap<string, Attribute *>::iterator,
+             FlatMultiMap<string, Attribute *>::iterator> index;
 
-        multimap<string, Attribute *>::iterator i;
+        FlatMultiMap<string, Attribute *>::iterator i;
 
         int j;
 
@@ -436,7 +458,7 @@ protected:
     /**
      *  The template attributes
      */
-    multimap<string,Attribute *>    attributes;
+    FlatMultiMap<string, Attribute *> attributes;
 
     /**
      *  Builds a SingleAttribute from the given node
@@ -494,10 +516,6 @@ protected:
 private:
 
     bool                            replace_mode;
-    /**
-     *  Mutex to perform just one flex-bison parsing at a time
-     */
-    static pthread_mutex_t          mutex;
 
     /**
      * Character to separate key from value when dump onto a string
@@ -527,10 +545,10 @@ private:
     template<typename T>
     int __get(const string& name, vector<const T *>& values) const
     {
-        pair<multimap<string, Attribute *>::const_iterator,
-             multimap<string, Attribute *>::const_iterator> index;
+        pair<FlatMultiMap<string, Attribute *>::const_iterator,
+             FlatMultiMap<string, Attribute *>::const_iterator> index;
 
-        multimap<string, Attribute *>::const_iterator i;
+        FlatMultiMap<string, Attribute *>::const_iterator i;
 
         int j = 0;
 
@@ -556,10 +574,10 @@ private:
     template<typename T>
     int __get(const string& name, vector<T *>& values)
     {
-        pair<multimap<string, Attribute *>::iterator,
-             multimap<string, Attribute *>::iterator> index;
+        pair<FlatMultiMap<string, Attribute *>::iterator,
+             FlatMultiMap<string, Attribute *>::iterator> index;
 
-        multimap<string, Attribute *>::iterator i;
+        FlatMultiMap<string, Attribute *>::iterator i;
 
         int j = 0;
 
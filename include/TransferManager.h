@@ -79,6 +79,11 @@ public:
         return new TMAction(*this);
     }
 
+    int key() const
+    {
+        return _vm_id;
+    }
+
 private:
     Actions _action;
 
@@ -92,10 +97,12 @@ public:
     TransferManager(
         VirtualMachinePool * _vmpool,
         HostPool *           _hpool,
-        vector<const VectorAttribute*>& _mads):
+        vector<const VectorAttribute*>& _mads,
+        unsigned int         num_threads):
             MadManager(_mads),
             vmpool(_vmpool),
-            hpool(_hpool)
+            hpool(_hpool),
+            am(num_threads)
     {
         am.addListener(this);
     };
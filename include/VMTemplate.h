@@ -183,6 +183,8 @@ protected:
 
     static const char * db_bootstrap;
 
+    static const SqlIndex db_indexes[];
+
     static const char * table;
 
     /**
@@ -102,7 +102,22 @@ public:
      */
     static int bootstrap(SqlDB *_db)
     {
-        return VMTemplate::bootstrap(_db);
+        int rc;
+
+        rc  = VMTemplate::bootstrap(_db);
+        rc += bootstrap_indexes(_db);
+
+        return rc;
+    };
+
+    /**
+     *  Creates the secondary indexes of the template pool tables that are
+     *  missing in the DB
+     *    @return 0 on success
+     */
+    static int bootstrap_indexes(SqlDB * _db)
+    {
+        return _db->create_indexes(VMTemplate::db_indexes);
     };
 
 private:
@@ -37,6 +37,7 @@ using namespace std;
 
 class AuthRequest;
 class Snapshots;
+struct HostShareCapacity;
 
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
@@ -885,6 +886,15 @@ public:
         return to_xml_extended(xml, 2);
     }
 
+    /**
+     * Function to print the VirtualMachine object into a string in
+     * XML format, with the attributes shown in pool listings (summary). It is
+     * stored in the DB along with the body.
+     *  @param xml the resulting XML string
+     *  @return a reference to the generated string
+     */
+    string& to_xml_short(string& xml) const;
+
     /**
      *  Rebuilds the object from an xml formatted string
      *    @param xml_str The xml-formatted string
@@ -995,14 +1005,25 @@ public:
     };
 
     /**
-     *  Get the VM physical requirements for the host.
-     *    @param cpu
-     *    @param memory
-     *    @param disk
-     *    @param pci_dev
+     *  Get the VM physical capacity requirements for the host.
+     *    @param sr the HostShareCapacity to store the capacity request, it
+     *    includes the PCI and NUMA_NODE attributes of the VM.
      */
-    void get_requirements(int& cpu, int& memory, int& disk,
-            vector<VectorAttribute *>& pci_dev);
+    void get_capacity(HostShareCapacity& sr);
+
+    /**
+     *  Saves the NUMA pinning of the VM (NODE_ID and CPUS of each NUMA_NODE)
+     *  in NODE_ID_PREV and CPUS_PREV. It is called before the VM capacity is
+     *  added to the target host of a migration, that replaces the pinning.
+     */
+    void save_numa_pinning();
+
+    /**
+     *  Removes the NUMA pinning saved by save_numa_pinning()
+     *    @param restore the saved pinning, used when the migration fails and
+     *    the VM keeps running in the previous host
+     */
+    void clear_numa_pinning(bool restore);
 
     /**
      * Adds automatic placement requirements: Datastore and Cluster
@@ -1758,11 +1779,13 @@ private:
         ostringstream oss_monit(VirtualMachine::monit_db_bootstrap);
         ostringstream oss_hist(History::db_bootstrap);
         ostringstream oss_showback(VirtualMachine::showback_db_bootstrap);
+        ostringstream oss_archive(VirtualMachine::archive_db_bootstrap);
 
         rc =  db->exec_local_wr(oss_vm);
         rc += db->exec_local_wr(oss_monit);
         rc += db->exec_local_wr(oss_hist);
         rc += db->exec_local_wr(oss_showback);
+        rc += db->exec_local_wr(oss_archive);
 
         return rc;
     };
@@ -1786,6 +1809,56 @@ private:
      */
     int insert_replace(SqlDB *db, bool replace, string& error_str);
 
+    /**
+     *  Updates the last_poll and short_body columns of the VM, used instead of
+     *  a full body write when only LAST_POLL has changed.
+     *    @param db The SQL DB
+     *    @return 0 one success
+     */
+    int update_last_poll(SqlDB *db);
+
+    /**
+     *  Elements of the VM body updated on every monitoring cycle. MONITORING
+     *  is not included, so the body shows the last monitoring values.
+     */
+    static const char * const volatile_names[];
+
+    const char * const * volatile_elements() const
+    {
+        return volatile_names;
+    };
+
+    time_t volatile_time() const
+    {
+        return last_poll;
+    };
+
+    /**
+     *  Moves a DONE VM to the archive table. The body is stored compressed
+     *  and the VM is removed from the live VM table.
+     *    @param db The SQL DB
+     *    @param error_str Returns the error reason, if any
+     *    @return 0 one success
+     */
+    int insert_archive(SqlDB *db, string& error_str);
+
+    /**
+     *  Reads the Virtual Machine from the archive table
+     *    @param db The SQL DB
+     *    @return 0 on success
+     */
+    int select_archive(SqlDB *db);
+
+    /**
+     *  Callback function to unmarshall an archived VirtualMachine object
+     *  (VirtualMachine::select_archive)
+     *    @param num the number of columns read from the DB
+     *    @param names the column names
+     *    @param vaues the column values
+     *    @return 0 on success
+     */
+    int select_archive_cb(void *nil, int num, char **values, char **names);
+
     /**
      *  Updates the VM history record
      *    @param db pointer to the db
@@ -1839,11 +1912,6 @@ private:
     // -------------------------------------------------------------------------
     // Attribute Parser
     // -------------------------------------------------------------------------
-    /**
-     * Mutex to perform just one attribute parse at a time
-     */
-    static pthread_mutex_t lex_mutex;
-
     /**
      *  Attributes not allowed in NIC_DEFAULT to avoid authorization bypass and
      *  inconsistencies for NIC_DEFAULTS
@@ -1923,6 +1991,23 @@ private:
      */
     int parse_pci(string& error_str);
 
+    /**
+     * Parse the "TOPOLOGY" attribute of the template. VMs with a PINNED
+     * policy or HUGEPAGE_SIZE get a NUMA_NODE attribute for each node, with
+     * its share of VCPUs (TOTAL_CPUS) and MEMORY (in KB)
+     *    @param error_str Returns the error reason, if any
+     *    @return 0 on success
+     */
+    int parse_topology(string& error_str);
+
+    /**
+     * Checks the I/O tuning attributes of the template: FEATURES/IOTHREADS,
+     * DISK/IOTHREAD, NIC/VIRTIO_QUEUES and NIC/VHOST
+     *    @param error_str Returns the error reason, if any
+     *    @return 0 on success
+     */
+    int parse_io_tuning(string& error_str);
+
     /**
      *  Parse the "SCHED_REQUIREMENTS" attribute of the template by substituting
      *  $VARIABLE, $VARIABLE[ATTR] and $VARIABLE[ATTR, ATTR = VALUE]
@@ -2096,6 +2181,8 @@ protected:
 
     static const char * db_bootstrap;
 
+    static const SqlIndex db_indexes[];
+
     static const char * monit_table;
 
     static const char * monit_db_names;
@@ -2108,8 +2195,15 @@ protected:
 
     static const char * showback_db_bootstrap;
 
+    static const char * archive_table;
+
+    static const char * archive_db_names;
+
+    static const char * archive_db_bootstrap;
+
     /**
      *  Reads the Virtual Machine (identified with its OID) from the database.
+     *  DONE VMs are looked up in the archive table.
      *    @param db pointer to the db
      *    @return 0 on success
      */
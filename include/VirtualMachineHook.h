@@ -21,6 +21,7 @@
 #include <string>
 
 #include "Hook.h"
+#include "HookEventBus.h"
 #include "VirtualMachine.h"
 
 using namespace std;
@@ -82,4 +83,42 @@ private:
     VirtualMachine::VmState  vm;
 };
 
+/**
+ *  This class publishes every VM state change as an event in a HookEventBus.
+ *  Events are delivered in batches to a consumer socket, or to a command that
+ *  is executed once per batch, so no process is created per state change.
+ */
+class VirtualMachineEventHook : public Hook
+{
+public:
+    /**
+     *  Creates a VirtualMachineEventHook
+     *    @param name of the hook
+     *    @param cmd for the hook, executed for each batch if socket is empty
+     *    @param args for the hook, $EVENTS is replaced by the batch
+     *    @param socket path of the consumer socket
+     *    @param batch max number of events per batch
+     */
+    VirtualMachineEventHook(const string&  name,
+                            const string&  cmd,
+                            const string&  args,
+                            const string&  socket,
+                            unsigned int   batch):
+        Hook(name, cmd, args, Hook::UPDATE | Hook::ALLOCATE, false),
+        bus(name, cmd, args, socket, batch){};
+
+    ~VirtualMachineEventHook(){};
+
+    // -------------------------------------------------------------------------
+    // Hook methods
+    // -------------------------------------------------------------------------
+    void do_hook(void *arg);
+
+private:
+    /**
+     *  Queue and delivery thread for the events
+     */
+    HookEventBus bus;
+};
+
 #endif
@@ -83,6 +83,11 @@ public:
         return new VMMAction(*this);
     }
 
+    int key() const
+    {
+        return _vm_id;
+    }
+
 private:
     Actions _action;
 
@@ -98,7 +103,8 @@ public:
         time_t                    _poll_period,
         bool                      _do_vm_poll,
         int                       _vm_limit,
-        vector<const VectorAttribute*>& _mads);
+        vector<const VectorAttribute*>& _mads,
+        unsigned int              num_threads);
 
     ~VirtualMachineManager(){};
 
@@ -316,6 +322,8 @@ private:
      *    @param tmpl the VM information in XML
      *    @param ds_id of the system datastore
      *    @param id of the security group
+     *    @return the message, it is encoded when sent to the driver. It has
+     *    to be freed by the caller.
      */
     string * format_message(
         const string& hostname,
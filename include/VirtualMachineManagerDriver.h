@@ -428,15 +428,19 @@ private:
     }
 
     /**
-     *
+     *  Sends an action to the driver: "ACTION ID DRV_MSG". The driver message
+     *  is framed or base64 encoded depending on the driver capabilities.
+     *    @param aname name of the action
+     *    @param oid the virtual machine id
+     *    @param msg xml data for the mad operation
      */
     void write_drv(const char * aname, const int oid, const string& msg) const
     {
         ostringstream os;
 
-        os << aname << " " << oid << " " << msg << endl;
+        os << aname << " " << oid;
 
-        write(os);
+        write(os, msg);
     }
 };
 
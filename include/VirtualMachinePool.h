@@ -70,6 +70,34 @@ public:
         string&                  error_str,
         bool                     on_hold = false);
 
+    /**
+     *  Function to allocate a set of VM objects, with consecutive ids. The
+     *  templates are owned by the new VMs. Imported VMs (IMPORT_VM_ID) cannot
+     *  be allocated with this function.
+     *    @param uid user id (the owner of the VMs)
+     *    @param gid the id of the group the VMs are assigned to
+     *    @param uname user name
+     *    @param gname group name
+     *    @param umask permissions umask
+     *    @param vm_templates VM Template objects describing each VM
+     *    @param oids the ids assigned to the VMs (output)
+     *    @param error_str Returns the error reason, if any
+     *    @param on_hold flag to submit on hold
+     *
+     *    @return 0 on success, -1 if any VM could not be allocated. oids
+     *    contains the VMs allocated before the error
+     */
+    int allocate (
+        int                               uid,
+        int                               gid,
+        const string&                     uname,
+        const string&                     gname,
+        int                               umask,
+        vector<VirtualMachineTemplate *>& vm_templates,
+        vector<int>&                      oids,
+        string&                           error_str,
+        bool                              on_hold = false);
+
     /**
      *  Function to get a VM from the pool, if the object is not in memory
      *  it is loade from the DB
@@ -237,10 +265,21 @@ public:
 
         rc  = VirtualMachine::bootstrap(_db);
         rc += _db->exec_local_wr(oss_import);
+        rc += bootstrap_indexes(_db);
 
         return rc;
     };
 
+    /**
+     *  Creates the secondary indexes of the VirtualMachine pool tables that are
+     *  missing in the DB
+     *    @return 0 on success
+     */
+    static int bootstrap_indexes(SqlDB * _db)
+    {
+        return _db->create_indexes(VirtualMachine::db_indexes);
+    };
+
     /**
      *  Dumps the VM pool in XML format. A filter can be also added to the query
      *  Also the hostname where the VirtualMachine is running is added to the
@@ -257,6 +296,47 @@ public:
                              limit);
     };
 
+    /**
+     *  Dumps the summary of the VMs (see VirtualMachine::to_xml_short) in XML
+     *  format. The VM bodies are not read from the DB.
+     *  @param oss the output stream to dump the pool contents
+     *  @param where filter for the objects, defaults to all
+     *  @param limit parameters used for pagination
+     *
+     *  @return 0 on success
+     */
+    int dump_summary(ostringstream& oss, const string& where,
+                     const string& limit)
+    {
+        return PoolSQL::dump(oss, "VM_POOL", "short_body",
+                             VirtualMachine::table, where, limit);
+    };
+
+    /**
+     *  Dumps the VM pool and the archived (DONE) VMs in XML format, ordered by
+     *  VM id.
+     *  @param oss the output stream to dump the pool contents
+     *  @param where filter for the live VMs, defaults to all
+     *  @param archive_where filter for the archived VMs, defaults to all
+     *  @param limit parameters used for pagination
+     *  @param summary dump the VM summaries instead of the full VMs
+     *
+     *  @return 0 on success
+     */
+    int dump(ostringstream& oss, const string& where,
+             const string& archive_where, const string& limit, bool summary);
+
+    /**
+     *  Dumps the archived (DONE) VMs in XML format.
+     *  @param oss the output stream to dump the pool contents
+     *  @param where filter for the objects, defaults to all
+     *  @param limit parameters used for pagination
+     *
+     *  @return 0 on success
+     */
+    int dump_archive(ostringstream& oss, const string& where,
+                     const string& limit);
+
     /**
      *  Dumps the VM accounting information in XML format. A filter can be also
      *  added to the query as well as a time frame.
@@ -413,6 +493,19 @@ private:
      */
     int db_int_cb(void * _min_stime, int num, char **values, char **names);
 
+    /**
+     *  Callback used to dump live and archived VMs. The second column is 1
+     *  for archived VMs, whose body is compressed.
+     */
+    int dump_archive_cb(void * _oss, int num, char **values, char **names);
+
+    /**
+     *  Writes a table expression with the ownership columns of the live and
+     *  archived VMs, used to filter the history and showback records
+     *    @param cmd the SQL command
+     */
+    static void all_vms_table(ostringstream& cmd);
+
     // -------------------------------------------------------------------------
     // Virtual Machine ID - Deploy ID index for imported VMs
     // The index is managed by the VirtualMachinePool
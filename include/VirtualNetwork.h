@@ -650,6 +650,8 @@ private:
 
     static const char * db_bootstrap;
 
+    static const SqlIndex db_indexes[];
+
     /**
      *  Writes the Virtual Network and its associated template and leases in the database.
      *    @param db pointer to the db
@@ -123,10 +123,21 @@ public:
 
         rc  = VirtualNetwork::bootstrap(_db);
         rc += _db->exec_local_wr(BitMap<0>::bootstrap(vlan_table, oss));
+        rc += bootstrap_indexes(_db);
 
         return rc;
     };
 
+    /**
+     *  Creates the secondary indexes of the VirtualNetwork pool tables that are
+     *  missing in the DB
+     *    @return 0 on success
+     */
+    static int bootstrap_indexes(SqlDB * _db)
+    {
+        return _db->create_indexes(VirtualNetwork::db_indexes);
+    };
+
     /**
      *  Dumps the Virtual Network pool in XML format. A filter can be also added
      *  to the query
@@ -0,0 +1,163 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#include "Benchmark.h"
+#include "SqliteDB.h"
+#include "BitMap.h"
+#include "AddressRangeInternal.h"
+
+using namespace std;
+
+/* -------------------------------------------------------------------------- */
+/* BitMap                                                                     */
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Gets and releases a bit from a VNC port like bitmap. Half of the bits are
+ *  in use, so the free bit search has to skip allocated words.
+ */
+class BitMapGet : public Benchmark
+{
+public:
+    BitMapGet():Benchmark("bitmap_get"), db(0), bitmap(0){};
+
+    int setup()
+    {
+        VectorAttribute conf("BITMAP");
+        ostringstream   oss;
+
+        conf.replace("START", "0");
+        conf.replace("RESERVED", "0:5899");
+
+        db = new SqliteDB(":memory:");
+
+        db->exec_local_wr(BitMap<0>::bootstrap("bench_bitmap", oss));
+
+        bitmap = new BitMap<65536>(conf, 0, "bench_bitmap");
+
+        if ( bitmap->insert(0, db) != 0 )
+        {
+            return -1;
+        }
+
+        for (int i = 5901; i < 65536; i += 2)
+        {
+            bitmap->set(i);
+        }
+
+        return 0;
+    };
+
+    void run(unsigned int n)
+    {
+        unsigned int bit;
+
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            if ( bitmap->get(5900 + (i % 59636), bit) == 0 )
+            {
+                bitmap->reset(bit);
+            }
+        }
+    };
+
+    void teardown()
+    {
+        delete bitmap;
+        delete db;
+    };
+
+private:
+    SqlDB *         db;
+
+    BitMap<65536> * bitmap;
+};
+
+BENCHMARK(BitMapGet);
+
+/* -------------------------------------------------------------------------- */
+/* AddressRange                                                               */
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Allocates and frees a lease in a /16 IPv4 range with half of the addresses
+ *  already leased.
+ */
+class AddressRangeAllocate : public Benchmark
+{
+public:
+    AddressRangeAllocate():Benchmark("ar_allocate"), ar(0), ar_attr(0){};
+
+    int setup()
+    {
+        string error;
+
+        vector<string> inherit;
+
+        ar_attr = new VectorAttribute("AR");
+
+        ar_attr->replace("TYPE", "IP4");
+        ar_attr->replace("IP", "10.0.0.1");
+        ar_attr->replace("SIZE", "65536");
+
+        AddressRangeInternal * ari = new AddressRangeInternal(0);
+
+        ar = ari;
+
+        if ( ari->from_vattr(ar_attr, error) != 0 )
+        {
+            return -1;
+        }
+
+        for (int i = 0; i < 32768; ++i)
+        {
+            VectorAttribute nic("NIC");
+
+            ar->allocate_addr(PoolObjectSQL::VM, i, &nic, inherit);
+        }
+
+        return 0;
+    };
+
+    void run(unsigned int n)
+    {
+        vector<string> inherit;
+
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            VectorAttribute nic("NIC");
+
+            if (ar->allocate_addr(PoolObjectSQL::VM, 65536, &nic, inherit) == 0)
+            {
+                ar->free_addr(PoolObjectSQL::VM, 65536,
+                        nic.vector_value("MAC"));
+            }
+        }
+    };
+
+    void teardown()
+    {
+        delete ar;
+        delete ar_attr;
+    };
+
+private:
+    AddressRange *    ar;
+
+    VectorAttribute * ar_attr;
+};
+
+BENCHMARK(AddressRangeAllocate);
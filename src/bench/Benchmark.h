@@ -0,0 +1,92 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <string>
+#include <vector>
+
+/**
+ *  Base class for the oned micro-benchmarks. Each benchmark registers itself
+ *  at load time in a global list (see BENCHMARK below). The driver calls
+ *  setup() once, then run(n) with an increasing number of iterations until
+ *  the measurement is long enough, and finally teardown().
+ */
+class Benchmark
+{
+public:
+    Benchmark(const char * _name):name(_name)
+    {
+        benchmarks().push_back(this);
+    };
+
+    virtual ~Benchmark(){};
+
+    /**
+     *  Prepares the objects used by run(), not timed
+     *    @return 0 on success
+     */
+    virtual int setup()
+    {
+        return 0;
+    };
+
+    /**
+     *  Executes the benchmarked operation n times
+     *    @param n number of iterations
+     */
+    virtual void run(unsigned int n) = 0;
+
+    /**
+     *  Releases the objects created by setup(), not timed
+     */
+    virtual void teardown(){};
+
+    const std::string& get_name() const
+    {
+        return name;
+    };
+
+    /**
+     *  @return the list of registered benchmarks
+     */
+    static std::vector<Benchmark *>& benchmarks()
+    {
+        static std::vector<Benchmark *> _benchmarks;
+
+        return _benchmarks;
+    };
+
+private:
+    std::string name;
+};
+
+/**
+ *  Prevents the compiler from optimizing away a computed value
+ */
+template<typename T>
+inline void bench_keep(const T& value)
+{
+    __asm__ __volatile__("" : : "g"(&value) : "memory");
+}
+
+/**
+ *  Defines a static instance of a Benchmark class so it is registered
+ */
+#define BENCHMARK(cls) static cls cls##_instance
+
+#endif /*BENCHMARK_H_*/
@@ -0,0 +1,420 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#include "Benchmark.h"
+#include "SqliteDB.h"
+#include "LogDB.h"
+#include "PoolSQL.h"
+#include "AclManager.h"
+#include "AclRule.h"
+
+using namespace std;
+
+/* -------------------------------------------------------------------------- */
+/* Database helpers. Benchmarks use an in-memory SQLite database so results   */
+/* measure oned code paths and not the storage of the test box.               */
+/* -------------------------------------------------------------------------- */
+
+static SqlDB * bench_db()
+{
+    SqlDB * db = new SqliteDB(":memory:");
+
+    ostringstream oss("CREATE TABLE pool_control (tablename VARCHAR(32) "
+        "PRIMARY KEY, last_oid BIGINT UNSIGNED)");
+
+    db->exec_local_wr(oss);
+
+    return db;
+}
+
+/* -------------------------------------------------------------------------- */
+/* PoolSQL                                                                    */
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Minimal pool object, stored in the DB as a Document would be (body + perms)
+ */
+class BenchObject : public PoolObjectSQL
+{
+public:
+    BenchObject(int id):PoolObjectSQL(id, DOCUMENT, "", 0, 0, "oneadmin",
+        "oneadmin", table)
+    {
+        obj_template = new Template;
+    };
+
+    ~BenchObject()
+    {
+        delete obj_template;
+    };
+
+    string& to_xml(string& xml) const
+    {
+        ostringstream oss;
+        string        template_xml;
+        string        perm_str;
+
+        oss << "<BENCH>"
+                << "<ID>"    << oid   << "</ID>"
+                << "<UID>"   << uid   << "</UID>"
+                << "<GID>"   << gid   << "</GID>"
+                << "<UNAME>" << uname << "</UNAME>"
+                << "<GNAME>" << gname << "</GNAME>"
+                << "<NAME>"  << name  << "</NAME>"
+                << perms_to_xml(perm_str)
+                << obj_template->to_xml(template_xml)
+            << "</BENCH>";
+
+        xml = oss.str();
+
+        return xml;
+    };
+
+    int from_xml(const string &xml)
+    {
+        vector<xmlNodePtr> content;
+        int rc = 0;
+
+        update_from_str(xml);
+
+        rc += xpath(oid,   "/BENCH/ID",    -1);
+        rc += xpath(uid,   "/BENCH/UID",   -1);
+        rc += xpath(gid,   "/BENCH/GID",   -1);
+        rc += xpath(uname, "/BENCH/UNAME", "not_found");
+        rc += xpath(gname, "/BENCH/GNAME", "not_found");
+        rc += xpath(name,  "/BENCH/NAME",  "not_found");
+
+        rc += perms_from_xml();
+
+        ObjectXML::get_nodes("/BENCH/TEMPLATE", content);
+
+        if (content.empty())
+        {
+            return -1;
+        }
+
+        rc += obj_template->from_xml_node(content[0]);
+
+        ObjectXML::free_nodes(content);
+
+        return rc == 0 ? 0 : -1;
+    };
+
+    static const char * table;
+
+    static const char * db_bootstrap;
+
+private:
+    int insert(SqlDB *db, string& error_str)
+    {
+        ostringstream oss;
+
+        oss << "bench-" << oid;
+        name = oss.str();
+
+        obj_template->replace("DESCRIPTION", "PoolSQL benchmark object");
+        obj_template->replace("COUNTER", 0);
+
+        return insert_replace(db, false, error_str);
+    };
+
+    int update(SqlDB *db)
+    {
+        string error;
+
+        return insert_replace(db, true, error);
+    };
+
+    int insert_replace(SqlDB *db, bool replace, string& error_str)
+    {
+        ostringstream oss;
+        string        xml_body;
+
+        char * sql_xml = db->escape_str(to_xml(xml_body).c_str());
+
+        if ( sql_xml == 0 )
+        {
+            error_str = "Error transforming the object to XML.";
+            return -1;
+        }
+
+        if (replace)
+        {
+            oss << "REPLACE";
+        }
+        else
+        {
+            oss << "INSERT";
+        }
+
+        oss << " INTO " << table << " (oid, name, body, uid, gid, owner_u, "
+            << "group_u, other_u) VALUES (" << oid << ",'" << name << "','"
+            << sql_xml << "'," << uid << "," << gid << "," << owner_u << ","
+            << group_u << "," << other_u << ")";
+
+        db->free_str(sql_xml);
+
+        return db->exec_wr(oss);
+    };
+};
+
+const char * BenchObject::table = "bench_pool";
+
+const char * BenchObject::db_bootstrap = "CREATE TABLE IF NOT EXISTS "
+    "bench_pool (oid INTEGER PRIMARY KEY, name VARCHAR(128), body MEDIUMTEXT, "
+    "uid INTEGER, gid INTEGER, owner_u INTEGER, group_u INTEGER, "
+    "other_u INTEGER)";
+
+/* -------------------------------------------------------------------------- */
+
+class BenchPool : public PoolSQL
+{
+public:
+    BenchPool(SqlDB * db):PoolSQL(db, BenchObject::table){};
+
+    int allocate(string& error_str)
+    {
+        return PoolSQL::allocate(new BenchObject(-1), error_str);
+    };
+
+    int dump(ostringstream& oss, const string& where, const string& limit)
+    {
+        return PoolSQL::dump(oss, "BENCH_POOL", BenchObject::table, where,
+                limit);
+    };
+
+private:
+    PoolObjectSQL * create()
+    {
+        return new BenchObject(-1);
+    };
+};
+
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Gets an object from the pool and updates it, as most API calls do
+ */
+class PoolGetUpdate : public Benchmark
+{
+public:
+    static const int POOL_SIZE = 1000;
+
+    PoolGetUpdate():Benchmark("pool_get_update"), db(0), pool(0){};
+
+    int setup()
+    {
+        string error;
+
+        db = bench_db();
+
+        ostringstream oss(BenchObject::db_bootstrap);
+
+        db->exec_local_wr(oss);
+
+        pool = new BenchPool(db);
+
+        for (int i = 0; i < POOL_SIZE; ++i)
+        {
+            if ( pool->allocate(error) < 0 )
+            {
+                return -1;
+            }
+        }
+
+        return 0;
+    };
+
+    void run(unsigned int n)
+    {
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            PoolObjectSQL * object = pool->get(i % POOL_SIZE, true);
+
+            if ( object == 0 )
+            {
+                continue;
+            }
+
+            object->replace_template_attribute("COUNTER", i);
+
+            pool->update(object);
+
+            object->unlock();
+        }
+    };
+
+    void teardown()
+    {
+        delete pool;
+        delete db;
+    };
+
+private:
+    SqlDB *     db;
+
+    BenchPool * pool;
+};
+
+BENCHMARK(PoolGetUpdate);
+
+/* -------------------------------------------------------------------------- */
+/* LogDB                                                                      */
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Inserts a log record and applies it to the DB, as the leader does for
+ *  every DB write in HA mode.
+ */
+class LogDBInsertApply : public Benchmark
+{
+public:
+    LogDBInsertApply():Benchmark("logdb_insert_apply"), logdb(0), index(0){};
+
+    int setup()
+    {
+        SqlDB * db = bench_db();
+
+        ostringstream oss("CREATE TABLE bench_log_t (oid INTEGER PRIMARY KEY, "
+            "body TEXT)");
+
+        db->exec_local_wr(oss);
+
+        LogDB::bootstrap(db);
+
+        logdb = new LogDB(db, false, 0);
+
+        index = 0;
+
+        return 0;
+    };
+
+    void run(unsigned int n)
+    {
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            ostringstream sql;
+
+            ++index;
+
+            sql << "REPLACE INTO bench_log_t (oid, body) VALUES ("
+                << index % 1000 << ",'<BENCH><ID>" << index << "</ID></BENCH>')";
+
+            logdb->insert_log_record(index, 1, sql, 0);
+
+            logdb->apply_log_records(index);
+        }
+    };
+
+    void teardown()
+    {
+        delete logdb; // LogDB deletes the underlying DB
+    };
+
+private:
+    LogDB *      logdb;
+
+    unsigned int index;
+};
+
+BENCHMARK(LogDBInsertApply);
+
+/* -------------------------------------------------------------------------- */
+/* AclManager                                                                 */
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Authorizes a USE operation for a user of a group that is granted access
+ *  through a group rule, after evaluating the owner/group/other permissions.
+ */
+class AclAuthorize : public Benchmark
+{
+public:
+    AclAuthorize():Benchmark("acl_authorize"), db(0), aclm(0){};
+
+    int setup()
+    {
+        string error;
+
+        db = bench_db();
+
+        AclManager::bootstrap(db);
+
+        aclm = new AclManager(db, 0, false, 0);
+
+        // Per user rules, as created for a large number of users
+        for (int i = 0; i < 500; ++i)
+        {
+            aclm->add_rule(AclRule::INDIVIDUAL_ID | (1000 + i),
+                           AclRule::INDIVIDUAL_ID | PoolObjectSQL::VM | i,
+                           AuthRequest::MANAGE,
+                           AclRule::ALL_ID,
+                           error);
+        }
+
+        // @150 NET+IMAGE+TEMPLATE/@150 USE *
+        aclm->add_rule(AclRule::GROUP_ID | 150,
+                       AclRule::GROUP_ID |
+                           PoolObjectSQL::NET |
+                           PoolObjectSQL::IMAGE |
+                           PoolObjectSQL::TEMPLATE |
+                           150,
+                       AuthRequest::USE,
+                       AclRule::ALL_ID,
+                       error);
+
+        aclm->start();
+
+        groups.insert(150);
+
+        perms.obj_type = PoolObjectSQL::IMAGE;
+        perms.oid      = 42;
+        perms.uid      = 2;
+        perms.gid      = 150;
+
+        return 0;
+    };
+
+    void run(unsigned int n)
+    {
+        bool auth;
+
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            auth = aclm->authorize(1000 + (i % 500), groups, perms,
+                    AuthRequest::USE);
+
+            bench_keep(auth);
+        }
+    };
+
+    void teardown()
+    {
+        delete aclm;
+        delete db;
+    };
+
+private:
+    SqlDB *        db;
+
+    AclManager *   aclm;
+
+    set<int>       groups;
+
+    PoolObjectAuth perms;
+};
+
+BENCHMARK(AclAuthorize);
@@ -0,0 +1,465 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#include <stdlib.h>
+
+#include "Benchmark.h"
+#include "Template.h"
+#include "ObjectXML.h"
+#include "ObjectBinary.h"
+#include "HostShare.h"
+
+using namespace std;
+
+/* -------------------------------------------------------------------------- */
+/* Sample documents, similar in size to a typical VM template and Host        */
+/* -------------------------------------------------------------------------- */
+
+static const string vm_template =
+    "NAME   = \"bench-vm\"\n"
+    "CPU    = 0.5\n"
+    "VCPU   = 2\n"
+    "MEMORY = 1024\n"
+    "DISK   = [ IMAGE_ID = 12, DEV_PREFIX = \"vd\", CACHE = \"none\" ]\n"
+    "DISK   = [ TYPE = \"fs\", SIZE = 4096, FORMAT = \"raw\" ]\n"
+    "NIC    = [ NETWORK_ID = 3, MODEL = \"virtio\", SECURITY_GROUPS = \"0\" ]\n"
+    "NIC    = [ NETWORK = \"private\", NETWORK_UNAME = \"oneadmin\" ]\n"
+    "GRAPHICS = [ TYPE = \"vnc\", LISTEN = \"0.0.0.0\", KEYMAP = \"es\" ]\n"
+    "OS     = [ ARCH = \"x86_64\", BOOT = \"disk0\" ]\n"
+    "FEATURES = [ ACPI = \"yes\", APIC = \"yes\", PAE = \"yes\" ]\n"
+    "CONTEXT  = [ NETWORK = \"YES\", SSH_PUBLIC_KEY = \"$USER[SSH_PUBLIC_KEY]\","
+    " START_SCRIPT = \"yum -y update\" ]\n"
+    "SCHED_REQUIREMENTS = \"HYPERVISOR = kvm & FREE_CPU > 50\"\n"
+    "SCHED_RANK = \"FREE_CPU\"\n"
+    "DESCRIPTION = \"Template used by the oned micro-benchmarks\"\n"
+    "LOGO = \"images/logos/centos.png\"\n";
+
+static const char * host_xml =
+    "<HOST><ID>7</ID><NAME>node07</NAME><STATE>2</STATE>"
+    "<IM_MAD>kvm</IM_MAD><VM_MAD>kvm</VM_MAD><CLUSTER_ID>0</CLUSTER_ID>"
+    "<HOST_SHARE><DISK_USAGE>0</DISK_USAGE><MEM_USAGE>4194304</MEM_USAGE>"
+    "<CPU_USAGE>400</CPU_USAGE><MAX_DISK>512000</MAX_DISK>"
+    "<MAX_MEM>16777216</MAX_MEM><MAX_CPU>1600</MAX_CPU>"
+    "<FREE_DISK>300000</FREE_DISK><FREE_MEM>9000000</FREE_MEM>"
+    "<FREE_CPU>1100</FREE_CPU><USED_DISK>212000</USED_DISK>"
+    "<USED_MEM>7777216</USED_MEM><USED_CPU>500</USED_CPU>"
+    "<RUNNING_VMS>4</RUNNING_VMS></HOST_SHARE>"
+    "<VMS><ID>10</ID><ID>11</ID><ID>12</ID><ID>13</ID></VMS>"
+    "<TEMPLATE><ARCH><![CDATA[x86_64]]></ARCH>"
+    "<CPUSPEED><![CDATA[2400]]></CPUSPEED>"
+    "<HOSTNAME><![CDATA[node07]]></HOSTNAME>"
+    "<HYPERVISOR><![CDATA[kvm]]></HYPERVISOR>"
+    "<MODELNAME><![CDATA[Intel(R) Xeon(R) CPU E5-2630]]></MODELNAME>"
+    "<NETRX><![CDATA[123456789]]></NETRX>"
+    "<NETTX><![CDATA[987654321]]></NETTX>"
+    "<PRIORITY><![CDATA[5]]></PRIORITY>"
+    "</TEMPLATE></HOST>";
+
+/* -------------------------------------------------------------------------- */
+/* Template                                                                   */
+/* -------------------------------------------------------------------------- */
+
+class TemplateParse : public Benchmark
+{
+public:
+    TemplateParse():Benchmark("template_parse"){};
+
+    void run(unsigned int n)
+    {
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            Template tmpl;
+            char *   error = 0;
+
+            tmpl.parse(vm_template, &error);
+
+            free(error);
+        }
+    };
+};
+
+BENCHMARK(TemplateParse);
+
+/* -------------------------------------------------------------------------- */
+
+class TemplateToXML : public Benchmark
+{
+public:
+    TemplateToXML():Benchmark("template_to_xml"){};
+
+    int setup()
+    {
+        char * error = 0;
+
+        int rc = tmpl.parse(vm_template, &error);
+
+        free(error);
+
+        return rc;
+    };
+
+    void run(unsigned int n)
+    {
+        string xml;
+
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            tmpl.to_xml(xml);
+
+            bench_keep(xml);
+        }
+    };
+
+private:
+    Template tmpl;
+};
+
+BENCHMARK(TemplateToXML);
+
+/* -------------------------------------------------------------------------- */
+
+class TemplateFromXML : public Benchmark
+{
+public:
+    TemplateFromXML():Benchmark("template_from_xml"){};
+
+    int setup()
+    {
+        Template tmpl;
+        char *   error = 0;
+
+        int rc = tmpl.parse(vm_template, &error);
+
+        free(error);
+
+        tmpl.to_xml(xml);
+
+        return rc;
+    };
+
+    void run(unsigned int n)
+    {
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            Template tmpl;
+
+            tmpl.from_xml(xml);
+        }
+    };
+
+private:
+    string xml;
+};
+
+BENCHMARK(TemplateFromXML);
+
+/* -------------------------------------------------------------------------- */
+/* ObjectXML                                                                  */
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Host document with the search paths used by the scheduler, needed to
+ *  evaluate requirement expressions
+ */
+class HostBenchXML : public ObjectXML
+{
+public:
+    HostBenchXML():ObjectXML(host_xml)
+    {
+        ObjectXML::paths     = host_paths;
+        ObjectXML::num_paths = 3;
+    };
+
+private:
+    static const char * host_paths[];
+};
+
+const char * HostBenchXML::host_paths[] = {
+    "/HOST/TEMPLATE/",
+    "/HOST/HOST_SHARE/",
+    "/HOST/"};
+
+/* -------------------------------------------------------------------------- */
+
+class ObjectXMLXPath : public Benchmark
+{
+public:
+    ObjectXMLXPath():Benchmark("xml_xpath"){};
+
+    void run(unsigned int n)
+    {
+        int    free_cpu;
+        string hypervisor;
+
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            host.xpath(free_cpu, "/HOST/HOST_SHARE/FREE_CPU", -1);
+            host.xpath(hypervisor, "/HOST/TEMPLATE/HYPERVISOR", "");
+
+            bench_keep(free_cpu);
+        }
+    };
+
+private:
+    HostBenchXML host;
+};
+
+BENCHMARK(ObjectXMLXPath);
+
+/* -------------------------------------------------------------------------- */
+
+class ObjectXMLDecode : public Benchmark
+{
+public:
+    ObjectXMLDecode():Benchmark("xml_decode"){};
+
+    void run(unsigned int n)
+    {
+        int    free_cpu;
+        string hypervisor;
+
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            ObjectXMLDecoder dec;
+
+            dec.bind("/HOST/HOST_SHARE/FREE_CPU", free_cpu, -1);
+            dec.bind("/HOST/TEMPLATE/HYPERVISOR", hypervisor, "");
+
+            host.decode(dec);
+
+            bench_keep(free_cpu);
+        }
+    };
+
+private:
+    HostBenchXML host;
+};
+
+BENCHMARK(ObjectXMLDecode);
+
+/* -------------------------------------------------------------------------- */
+/* Host body codecs (BODY_FORMAT). Host objects are only created by the       */
+/* HostPool, the cases encode and decode the share and template of the host,  */
+/* most of its body.                                                          */
+/* -------------------------------------------------------------------------- */
+
+static const char * host_share_xml =
+    "<HOST><HOST_SHARE><DISK_USAGE>0</DISK_USAGE><MEM_USAGE>4194304</MEM_USAGE>"
+    "<CPU_USAGE>400</CPU_USAGE><TOTAL_MEM>16777216</TOTAL_MEM>"
+    "<TOTAL_CPU>1600</TOTAL_CPU><MAX_DISK>512000</MAX_DISK>"
+    "<MAX_MEM>16777216</MAX_MEM><MAX_CPU>1600</MAX_CPU>"
+    "<FREE_DISK>300000</FREE_DISK><FREE_MEM>9000000</FREE_MEM>"
+    "<FREE_CPU>1100</FREE_CPU><USED_DISK>212000</USED_DISK>"
+    "<USED_MEM>7777216</USED_MEM><USED_CPU>500</USED_CPU>"
+    "<RUNNING_VMS>4</RUNNING_VMS>"
+    "<DATASTORES><DS><FREE_MB><![CDATA[300000]]></FREE_MB>"
+    "<ID><![CDATA[0]]></ID><TOTAL_MB><![CDATA[512000]]></TOTAL_MB>"
+    "<USED_MB><![CDATA[212000]]></USED_MB></DS></DATASTORES>"
+    "<PCI_DEVICES></PCI_DEVICES></HOST_SHARE></HOST>";
+
+/**
+ *  Decodes the share and template of a host document
+ */
+static int host_body_from_xml(const string& body, HostShare& share,
+        Template& tmpl)
+{
+    ObjectXML xml(body);
+
+    vector<xmlNodePtr> nodes;
+
+    int rc = -1;
+
+    if ( xml.get_nodes("/HOST/HOST_SHARE", nodes) > 0 )
+    {
+        rc = share.from_xml_node(nodes[0]);
+    }
+
+    xml.free_nodes(nodes);
+
+    if ( rc == 0 && xml.get_nodes("/HOST/TEMPLATE", nodes) > 0 )
+    {
+        rc = tmpl.from_xml_node(nodes[0]);
+    }
+    else
+    {
+        rc = -1;
+    }
+
+    xml.free_nodes(nodes);
+
+    return rc;
+}
+
+class HostBody : public Benchmark
+{
+public:
+    HostBody(const char * name):Benchmark(name), tmpl(false, '=', "TEMPLATE"){};
+
+    int setup()
+    {
+        ObjectXML host(host_xml);
+
+        vector<xmlNodePtr> nodes;
+
+        string body = host_share_xml;
+
+        if ( host.get_nodes("/HOST/TEMPLATE", nodes) > 0 )
+        {
+            Template ht(false, '=', "TEMPLATE");
+            string   txml;
+
+            ht.from_xml_node(nodes[0]);
+
+            body.insert(body.size() - 7, ht.to_xml(txml));
+        }
+
+        host.free_nodes(nodes);
+
+        return host_body_from_xml(body, share, tmpl);
+    };
+
+protected:
+    HostShare share;
+
+    Template  tmpl;
+};
+
+/* -------------------------------------------------------------------------- */
+
+class HostBodyXML : public HostBody
+{
+public:
+    HostBodyXML():HostBody("host_body_xml"){};
+
+    void run(unsigned int n)
+    {
+        string share_xml;
+        string tmpl_xml;
+
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            HostShare rshare;
+            Template  rtmpl(false, '=', "TEMPLATE");
+
+            string body = "<HOST>" + share.to_xml(share_xml) +
+                tmpl.to_xml(tmpl_xml) + "</HOST>";
+
+            host_body_from_xml(body, rshare, rtmpl);
+
+            bench_keep(body);
+        }
+    };
+};
+
+BENCHMARK(HostBodyXML);
+
+/* -------------------------------------------------------------------------- */
+
+class HostBodyBinary : public HostBody
+{
+public:
+    HostBodyBinary():HostBody("host_body_binary"){};
+
+    void run(unsigned int n)
+    {
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            BinaryWriter bw;
+            HostShare    rshare;
+            Template     rtmpl(false, '=', "TEMPLATE");
+
+            string body, fields, stable;
+
+            share.to_binary(bw);
+            tmpl.to_binary(bw);
+
+            one_binary::to_body(bw, body);
+
+            one_binary::from_body(body, fields, stable);
+
+            BinaryReader br(fields);
+
+            rshare.from_binary(br);
+            rtmpl.from_binary(br);
+
+            bench_keep(body);
+        }
+    };
+};
+
+BENCHMARK(HostBodyBinary);
+
+/* -------------------------------------------------------------------------- */
+
+class ObjectXMLEvalBool : public Benchmark
+{
+public:
+    ObjectXMLEvalBool():Benchmark("xml_eval_bool"){};
+
+    void run(unsigned int n)
+    {
+        string expr = "HYPERVISOR = kvm & FREE_CPU > 50 & "
+                      "(CLUSTER_ID = 0 | CLUSTER_ID = 100) & "
+                      "HOSTNAME = \"node*\"";
+        bool   result;
+
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            char * error = 0;
+
+            host.eval_bool(expr, result, &error);
+
+            free(error);
+
+            bench_keep(result);
+        }
+    };
+
+private:
+    HostBenchXML host;
+};
+
+BENCHMARK(ObjectXMLEvalBool);
+
+/* -------------------------------------------------------------------------- */
+
+class ObjectXMLEvalArith : public Benchmark
+{
+public:
+    ObjectXMLEvalArith():Benchmark("xml_eval_arith"){};
+
+    void run(unsigned int n)
+    {
+        string expr = "FREE_CPU * 2 + FREE_MEM / 1024 - RUNNING_VMS * PRIORITY";
+        int    result;
+
+        for (unsigned int i = 0; i < n ; ++i)
+        {
+            char * error = 0;
+
+            host.eval_arith(expr, result, &error);
+
+            free(error);
+
+            bench_keep(result);
+        }
+    };
+
+private:
+    HostBenchXML host;
+};
+
+BENCHMARK(ObjectXMLEvalArith);
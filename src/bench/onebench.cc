@@ -0,0 +1,180 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#include <getopt.h>
+#include <time.h>
+#include <stdlib.h>
+#include <iostream>
+#include <iomanip>
+
+#include "Benchmark.h"
+#include "NebulaLog.h"
+
+using namespace std;
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+static void print_usage(ostream& str)
+{
+    str << "Usage: onebench [-h] [-l] [-t seconds] [filter]\n";
+}
+
+static void print_help()
+{
+    print_usage(cout);
+
+    cout << "\n"
+         << "SYNOPSIS\n"
+         << "  Runs the OpenNebula daemon micro-benchmarks. Only those whose\n"
+         << "  name contains filter are executed\n\n"
+         << "OPTIONS\n"
+         << "  -h, --help\tdisplay this help and exit\n"
+         << "  -l, --list\tlist the available benchmarks and exit\n"
+         << "  -t, --time\tminimum run time per benchmark (default 1s)\n";
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+static double now()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ *  Runs the benchmark doubling the number of iterations until it takes at
+ *  least min_time seconds.
+ */
+static void run_benchmark(Benchmark * bench, double min_time)
+{
+    unsigned int n = 1;
+    double elapsed = 0;
+
+    if ( bench->setup() != 0 )
+    {
+        cout << left << setw(32) << bench->get_name() << "setup failed" << endl;
+        return;
+    }
+
+    while (true)
+    {
+        double start = now();
+
+        bench->run(n);
+
+        elapsed = now() - start;
+
+        if ( elapsed >= min_time || n >= (1U << 30) )
+        {
+            break;
+        }
+
+        if ( elapsed < min_time / 100 )
+        {
+            n *= 10;
+        }
+        else
+        {
+            n *= 2;
+        }
+    }
+
+    bench->teardown();
+
+    cout << left  << setw(32) << bench->get_name()
+         << right << setw(12) << n
+         << fixed << setprecision(1)
+         << setw(14) << (elapsed * 1e9 / n) << " ns/op"
+         << setw(14) << (n / elapsed) << " ops/s" << endl;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+int main(int argc, char **argv)
+{
+    int    opt;
+    bool   list     = false;
+    double min_time = 1;
+    string filter;
+
+    vector<Benchmark *>::iterator it;
+
+    static struct option long_options[] = {
+        {"help", no_argument,       0, 'h'},
+        {"list", no_argument,       0, 'l'},
+        {"time", required_argument, 0, 't'},
+        {0,      0,                 0, 0}
+    };
+
+    int long_index = 0;
+
+    while ((opt = getopt_long(argc, argv, "hlt:",
+                    long_options, &long_index)) != -1)
+    {
+        switch(opt)
+        {
+            case 'h':
+                print_help();
+                exit(0);
+                break;
+            case 'l':
+                list = true;
+                break;
+            case 't':
+                min_time = atof(optarg);
+                break;
+            default:
+                print_usage(cerr);
+                exit(-1);
+                break;
+        }
+    }
+
+    if ( optind < argc )
+    {
+        filter = argv[optind];
+    }
+
+    NebulaLog::init_log_system(NebulaLog::STD, Log::ERROR, 0, ios_base::app,
+            "onebench");
+
+    vector<Benchmark *>& benchmarks = Benchmark::benchmarks();
+
+    for (it = benchmarks.begin(); it != benchmarks.end(); ++it)
+    {
+        if ( !filter.empty() && (*it)->get_name().find(filter) == string::npos )
+        {
+            continue;
+        }
+
+        if ( list )
+        {
+            cout << (*it)->get_name() << endl;
+        }
+        else
+        {
+            run_benchmark(*it, min_time);
+        }
+    }
+
+    return 0;
+}
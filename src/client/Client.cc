@@ -225,7 +225,7 @@ void Client::call(const std::string& method, const xmlrpc_c::paramList& plist,
 
 int Client::call(const std::string& endpoint, const std::string& method,
         const xmlrpc_c::paramList& plist, unsigned int _timeout,
-        xmlrpc_c::value * const result, std::string& error)
+        xmlrpc_c::value * const result, std::string& error, int * fault_code)
 {
     xmlrpc_c::clientXmlTransport_curl transport(
         xmlrpc_c::clientXmlTransport_curl::constrOpt().timeout(_timeout));
@@ -253,6 +253,11 @@ int Client::call(const std::string& endpoint, const std::string& method,
 
             error  = failure.getDescription();
             xml_rc = -1;
+
+            if ( fault_code != 0 )
+            {
+                *fault_code = failure.getCode();
+            }
         }
     }
     catch (exception const& e)
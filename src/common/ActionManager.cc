@@ -21,20 +21,50 @@
 /* ActionManager constructor & destructor                                   */
 /* ************************************************************************** */
 
-ActionManager::ActionManager(): listener(0)
+ActionManager::ActionManager(unsigned int num_workers): listener(0)
 {
     pthread_mutex_init(&mutex,0);
 
     pthread_cond_init(&cond,0);
+
+    for (unsigned int i = 0; num_workers > 1 && i < num_workers; i++)
+    {
+        ActionWorker * aw = new ActionWorker;
+
+        aw->am = this;
+
+        pthread_mutex_init(&(aw->mutex), 0);
+
+        pthread_cond_init(&(aw->cond), 0);
+
+        workers.push_back(aw);
+    }
 }
 
 /* -------------------------------------------------------------------------- */
 
 ActionManager::~ActionManager()
 {
+    std::vector<ActionWorker *>::iterator it;
+
     pthread_mutex_destroy(&mutex);
 
     pthread_cond_destroy(&cond);
+
+    for (it = workers.begin(); it != workers.end(); ++it)
+    {
+        while (!(*it)->actions.empty())
+        {
+            delete (*it)->actions.front();
+            (*it)->actions.pop();
+        }
+
+        pthread_mutex_destroy(&((*it)->mutex));
+
+        pthread_cond_destroy(&((*it)->cond));
+
+        delete *it;
+    }
 }
 
 /* ************************************************************************** */
@@ -43,6 +73,12 @@ ActionManager::~ActionManager()
 
 void ActionManager::trigger(const ActionRequest& ar )
 {
+    if ( !workers.empty() && ar.type() == ActionRequest::USER && ar.key() >= 0 )
+    {
+        trigger(workers[ar.key() % workers.size()], ar.clone());
+        return;
+    }
+
     lock();
 
     actions.push(ar.clone());
@@ -80,6 +116,8 @@ void ActionManager::loop(struct timespec& _tout, const ActionRequest& trequest)
 
     set_timeout(timeout, _tout);
 
+    start_workers();
+
     //Action Loop, end when a finalize action is triggered to this manager
     while (finalize == 0)
     {
@@ -103,6 +141,11 @@ void ActionManager::loop(struct timespec& _tout, const ActionRequest& trequest)
 
         unlock();
 
+        if ( action->type() == ActionRequest::FINALIZE )
+        {
+            stop_workers();
+        }
+
         listener->_do_action(*action);
 
         switch(action->type())
@@ -125,3 +168,108 @@ void ActionManager::loop(struct timespec& _tout, const ActionRequest& trequest)
 
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
+
+void ActionManager::trigger(ActionWorker * aw, ActionRequest * ar)
+{
+    pthread_mutex_lock(&(aw->mutex));
+
+    aw->actions.push(ar);
+
+    pthread_cond_signal(&(aw->cond));
+
+    pthread_mutex_unlock(&(aw->mutex));
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+extern "C" void * action_worker_loop(void *arg)
+{
+    ActionManager::ActionWorker * aw;
+
+    if ( arg == 0 )
+    {
+        return 0;
+    }
+
+    aw = static_cast<ActionManager::ActionWorker *>(arg);
+
+    aw->am->worker_loop(aw);
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void ActionManager::start_workers()
+{
+    pthread_attr_t pattr;
+
+    std::vector<ActionWorker *>::iterator it;
+
+    pthread_attr_init(&pattr);
+    pthread_attr_setdetachstate(&pattr, PTHREAD_CREATE_JOINABLE);
+
+    for (it = workers.begin(); it != workers.end(); ++it)
+    {
+        pthread_create(&((*it)->thread), &pattr, action_worker_loop,
+                (void *) *it);
+    }
+
+    pthread_attr_destroy(&pattr);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void ActionManager::stop_workers()
+{
+    std::vector<ActionWorker *>::iterator it;
+
+    for (it = workers.begin(); it != workers.end(); ++it)
+    {
+        trigger(*it, new ActionRequest(ActionRequest::FINALIZE));
+    }
+
+    for (it = workers.begin(); it != workers.end(); ++it)
+    {
+        pthread_join((*it)->thread, 0);
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+void ActionManager::worker_loop(ActionWorker * aw)
+{
+    ActionRequest * action;
+
+    bool finalize = false;
+
+    while (!finalize)
+    {
+        pthread_mutex_lock(&(aw->mutex));
+
+        while ( aw->actions.empty() == true )
+        {
+            pthread_cond_wait(&(aw->cond), &(aw->mutex));
+        }
+
+        action = aw->actions.front();
+        aw->actions.pop();
+
+        pthread_mutex_unlock(&(aw->mutex));
+
+        if ( action->type() == ActionRequest::FINALIZE )
+        {
+            finalize = true;
+        }
+        else
+        {
+            listener->_do_action(*action);
+        }
+
+        delete action;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
@@ -26,11 +26,26 @@ const int    VectorAttribute::magic_sep_size = 5;
 
 string * VectorAttribute::marshall(const char * _sep) const
 {
-    ostringstream os;
-    string *      rs;
+    if ( attribute_value.size() == 0 )
+    {
+        return 0;
+    }
+
+    string * rs = new string;
+
+    marshall(*rs, _sep);
+
+    return rs;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+void VectorAttribute::marshall(string& buffer, const char * _sep) const
+{
     const char *  my_sep;
 
-    map<string,string>::const_iterator it;
+    FlatMap<string,string>::const_iterator it;
 
     if ( _sep == 0 )
     {
@@ -41,25 +56,15 @@ string * VectorAttribute::marshall(const char * _sep) const
         my_sep = _sep;
     }
 
-    if ( attribute_value.size() == 0 )
+    for (it = attribute_value.begin(); it != attribute_value.end(); it++)
     {
-        return 0;
-    }
-
-    it = attribute_value.begin();
-
-    os << it->first << "=" << it->second;
+        if ( it != attribute_value.begin() )
+        {
+            buffer.append(my_sep);
+        }
 
-    for (++it; it != attribute_value.end(); it++)
-    {
-        os << my_sep << it->first << "=" << it->second;
+        buffer.append(it->first).append(1, '=').append(it->second);
     }
-
-    rs = new string;
-
-    *rs = os.str();
-
-    return rs;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -67,13 +72,9 @@ string * VectorAttribute::marshall(const char * _sep) const
 
 string * VectorAttribute::to_xml() const
 {
-    ostringstream oss;
-
-    to_xml(oss);
-
     string * xml = new string;
 
-    *xml = oss.str();
+    to_xml(*xml);
 
     return xml;
 }
@@ -83,9 +84,21 @@ string * VectorAttribute::to_xml() const
 
 void VectorAttribute::to_xml(ostringstream &oss) const
 {
-    map<string,string>::const_iterator    it;
+    string xml;
 
-    oss << "<" << name() << ">";
+    to_xml(xml);
+
+    oss << xml;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+void VectorAttribute::to_xml(string& buffer) const
+{
+    FlatMap<string,string>::const_iterator it;
+
+    buffer.append(1, '<').append(name()).append(1, '>');
 
     for (it=attribute_value.begin();it!=attribute_value.end();it++)
     {
@@ -94,12 +107,14 @@ void VectorAttribute::to_xml(ostringstream &oss) const
             continue;
         }
 
-        oss << "<" << it->first << ">"
-            << one_util::escape_xml(it->second)
-            << "</" << it->first << ">";
+        buffer.append(1, '<').append(it->first).append(1, '>');
+
+        buffer.append(one_util::escape_xml(it->second));
+
+        buffer.append("</").append(it->first).append(1, '>');
     }
 
-    oss << "</"<< name() << ">";
+    buffer.append("</").append(name()).append(1, '>');
 }
 
 /* -------------------------------------------------------------------------- */
@@ -161,7 +176,7 @@ void VectorAttribute::unmarshall(const string& sattr, const char * _sep)
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-void VectorAttribute::replace(const map<string,string>& attr)
+void VectorAttribute::replace(const FlatMap<string,string>& attr)
 {
     attribute_value = attr;
 }
@@ -170,10 +185,10 @@ void VectorAttribute::replace(const map<string,string>& attr)
 
 void VectorAttribute::merge(VectorAttribute* vattr, bool replace)
 {
-    map<string, string>::const_iterator it;
-    map<string, string>::iterator       jt;
+    FlatMap<string, string>::const_iterator it;
+    FlatMap<string, string>::iterator       jt;
 
-    const map<string,string>& source_values = vattr->value();
+    const FlatMap<string,string>& source_values = vattr->value();
 
     for(it=source_values.begin(); it!=source_values.end(); it++)
     {
@@ -183,12 +198,10 @@ void VectorAttribute::merge(VectorAttribute* vattr, bool replace)
         {
             if (replace)
             {
-                attribute_value.erase(jt);
-            }
-            else
-            {
-                continue;
+                jt->second = it->second;
             }
+
+            continue;
         }
 
         attribute_value.insert(make_pair(it->first,it->second));
@@ -200,16 +213,7 @@ void VectorAttribute::merge(VectorAttribute* vattr, bool replace)
 
 void VectorAttribute::replace(const string& name, const string& value)
 {
-    map<string,string>::iterator it;
-
-    it = attribute_value.find(name);
-
-    if ( it != attribute_value.end() )
-    {
-        attribute_value.erase(it);
-    }
-
-    attribute_value.insert(make_pair(name,value));
+    attribute_value[name] = value;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -217,7 +221,7 @@ void VectorAttribute::replace(const string& name, const string& value)
 
 void VectorAttribute::remove(const string& name)
 {
-    map<string,string>::iterator it;
+    FlatMap<string,string>::iterator it;
 
     it = attribute_value.find(name);
 
@@ -232,7 +236,7 @@ void VectorAttribute::remove(const string& name)
 
 string VectorAttribute::vector_value(const string& name) const
 {
-    map<string,string>::const_iterator it;
+    FlatMap<string,string>::const_iterator it;
 
     it = attribute_value.find(name);
 
@@ -251,7 +255,7 @@ string VectorAttribute::vector_value(const string& name) const
 
 int VectorAttribute::vector_value(const string& name, string& value) const
 {
-    map<string,string>::const_iterator it;
+    FlatMap<string,string>::const_iterator it;
 
     it = attribute_value.find(name);
 
@@ -270,7 +274,7 @@ int VectorAttribute::vector_value(const string& name, string& value) const
 
 int VectorAttribute::vector_value(const string& name, bool& value) const
 {
-    map<string,string>::const_iterator it;
+    FlatMap<string,string>::const_iterator it;
 
     value = false;
     it    = attribute_value.find(name);
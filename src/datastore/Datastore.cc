@@ -980,6 +980,31 @@ bool Datastore::get_avail_mb(long long &avail)
 /* ------------------------------------------------------------------------ */
 /* ------------------------------------------------------------------------ */
 
+string Datastore::get_backend_key() const
+{
+    ostringstream oss;
+
+    string pool_name;
+    string ceph_host;
+
+    obj_template->get("POOL_NAME", pool_name);
+
+    if ( pool_name.empty() )
+    {
+        return "";
+    }
+
+    obj_template->get("CEPH_HOST", ceph_host);
+
+    oss << type_to_str(type) << ":" << ds_mad << ":" << tm_mad << ":"
+        << ceph_host << ":" << pool_name;
+
+    return oss.str();
+}
+
+/* ------------------------------------------------------------------------ */
+/* ------------------------------------------------------------------------ */
+
 bool Datastore::is_persistent_only()
 {
     int rc;
@@ -88,12 +88,11 @@ int DispatchManager::import(VirtualMachine * vm, const RequestAttributes& ra)
     }
 
     time_t the_time = time(0);
-    int    cpu, mem, disk;
-    vector<VectorAttribute *> pci;
+    HostShareCapacity sr;
 
-    vm->get_requirements(cpu, mem, disk, pci);
+    vm->get_capacity(sr);
 
-    hpool->add_capacity(vm->get_hid(), vm->get_oid(), cpu, mem, disk, pci);
+    hpool->add_capacity(vm->get_hid(), sr);
 
     import_state = vm->get_import_state();
 
@@ -949,8 +948,7 @@ int DispatchManager::delete_vm(VirtualMachine * vm, const RequestAttributes& ra,
 {
     ostringstream oss;
 
-    int cpu, mem, disk;
-    vector<VectorAttribute *> pci;
+    HostShareCapacity sr;
 
     bool is_public_host = false;
     int  host_id = -1;
@@ -988,9 +986,9 @@ int DispatchManager::delete_vm(VirtualMachine * vm, const RequestAttributes& ra,
     {
         case VirtualMachine::SUSPENDED:
         case VirtualMachine::POWEROFF:
-            vm->get_requirements(cpu, mem, disk, pci);
+            vm->get_capacity(sr);
 
-            hpool->del_capacity(vm->get_hid(), vid, cpu, mem, disk, pci);
+            hpool->del_capacity(vm->get_hid(), sr);
 
             if (is_public_host)
             {
@@ -0,0 +1,555 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "HookEventBus.h"
+#include "Nebula.h"
+#include "NebulaUtil.h"
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+string& HookEvent::to_xml(string& xml) const
+{
+    ostringstream oss;
+
+    vector<pair<string, string> >::const_iterator it;
+
+    oss << "<EVENT>"
+        << "<OBJECT>"    << object    << "</OBJECT>"
+        << "<TYPE>"      << type      << "</TYPE>"
+        << "<ID>"        << oid       << "</ID>"
+        << "<TIMESTAMP>" << timestamp << "</TIMESTAMP>";
+
+    for (it = attributes.begin(); it != attributes.end(); ++it)
+    {
+        oss << "<" << it->first << ">" << one_util::escape_xml(it->second)
+            << "</" << it->first << ">";
+    }
+
+    oss << "</EVENT>";
+
+    xml = oss.str();
+
+    return xml;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+const unsigned int HookEventBus::max_events = 10000;
+
+const time_t HookEventBus::period = 1;
+
+const time_t HookEventBus::max_retry_period = 60;
+
+const unsigned int HookEventBus::max_retries = 10;
+
+const size_t HookEventBus::max_command_batch = 65536;
+
+const time_t HookEventBus::command_timeout = 300;
+
+map<string, HookEventBus *> HookEventBus::command_buses;
+
+pthread_mutex_t HookEventBus::command_buses_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* -------------------------------------------------------------------------- */
+
+extern "C" void * hook_event_bus_loop(void *arg)
+{
+    if ( arg == 0 )
+    {
+        return 0;
+    }
+
+    static_cast<HookEventBus *>(arg)->loop();
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+HookEventBus::HookEventBus(const string& _name, const string& _cmd,
+        const string& _args, const string& _socket, unsigned int _batch):
+    name(_name), cmd(_cmd), args(_args), socket_path(_socket),
+    batch_size(_batch), dropped(0), finalized(false), socket_fd(-1),
+    command_pending(false), command_success(false), command_seq(0)
+{
+    pthread_attr_t pattr;
+
+    if ( batch_size == 0 )
+    {
+        batch_size = 1;
+    }
+
+    if ( args.empty() )
+    {
+        args = "$EVENTS";
+    }
+
+    pthread_mutex_init(&mutex, 0);
+
+    if ( socket_path.empty() )
+    {
+        pthread_mutex_lock(&command_buses_mutex);
+
+        if ( !command_buses.insert(make_pair(name, this)).second )
+        {
+            NebulaLog::log("HKM", Log::WARNING, "Hook " + name + " is not "
+                "unique, the results of its commands are not checked");
+        }
+
+        pthread_mutex_unlock(&command_buses_mutex);
+    }
+
+    pthread_cond_init(&cond, 0);
+
+    pthread_attr_init(&pattr);
+    pthread_attr_setdetachstate(&pattr, PTHREAD_CREATE_JOINABLE);
+
+    pthread_create(&thread, &pattr, hook_event_bus_loop, (void *) this);
+
+    pthread_attr_destroy(&pattr);
+}
+
+/* -------------------------------------------------------------------------- */
+
+HookEventBus::~HookEventBus()
+{
+    map<string, HookEventBus *>::iterator it;
+
+    pthread_mutex_lock(&command_buses_mutex);
+
+    it = command_buses.find(name);
+
+    if ( it != command_buses.end() && it->second == this )
+    {
+        command_buses.erase(it);
+    }
+
+    pthread_mutex_unlock(&command_buses_mutex);
+
+    pthread_mutex_lock(&mutex);
+
+    finalized = true;
+
+    pthread_cond_signal(&cond);
+
+    pthread_mutex_unlock(&mutex);
+
+    pthread_join(thread, 0);
+
+    if ( socket_fd != -1 )
+    {
+        close(socket_fd);
+    }
+
+    pthread_mutex_destroy(&mutex);
+
+    pthread_cond_destroy(&cond);
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+void HookEventBus::publish(const HookEvent& event)
+{
+    string xml;
+
+    event.to_xml(xml);
+
+    pthread_mutex_lock(&mutex);
+
+    if ( events.size() >= max_events )
+    {
+        events.pop_front();
+
+        dropped++;
+    }
+
+    events.push_back(xml);
+
+    if ( events.size() == batch_size )
+    {
+        pthread_cond_signal(&cond);
+    }
+
+    pthread_mutex_unlock(&mutex);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void HookEventBus::loop()
+{
+    string batch;
+    bool   failed = false;
+
+    unsigned int retries = 0;
+    time_t       backoff = period;
+
+    pthread_mutex_lock(&mutex);
+
+    while ( !finalized )
+    {
+        if ( failed )
+        {
+            struct timespec timeout;
+
+            clock_gettime(CLOCK_REALTIME, &timeout);
+
+            timeout.tv_sec += backoff;
+
+            // New events do not wake up the retry of a failed batch
+            while ( !finalized )
+            {
+                if ( pthread_cond_timedwait(&cond,&mutex,&timeout) == ETIMEDOUT )
+                {
+                    break;
+                }
+            }
+
+            if ( finalized )
+            {
+                break;
+            }
+        }
+        else if ( events.size() < batch_size )
+        {
+            struct timespec timeout;
+
+            clock_gettime(CLOCK_REALTIME, &timeout);
+
+            timeout.tv_sec += period;
+
+            pthread_cond_timedwait(&cond, &mutex, &timeout);
+
+            if ( finalized )
+            {
+                break;
+            }
+        }
+
+        if ( dropped > 0 )
+        {
+            ostringstream oss;
+
+            oss << "Hook " << name << " event queue is full, " << dropped
+                << " events dropped";
+
+            NebulaLog::log("HKM", Log::WARNING, oss);
+
+            dropped = 0;
+        }
+
+        // A failed batch is retried before taking new events from the queue
+        if ( batch.empty() )
+        {
+            if ( events.empty() )
+            {
+                failed = false;
+                continue;
+            }
+
+            ostringstream oss;
+
+            size_t bytes = 0;
+
+            oss << "<EVENTS>";
+
+            for (unsigned int i = 0; i < batch_size && !events.empty(); ++i)
+            {
+                bytes += events.front().size();
+
+                // Command batches are also limited by size, see command_deliver
+                if ( i > 0 && socket_path.empty() && bytes > max_command_batch )
+                {
+                    break;
+                }
+
+                oss << events.front();
+
+                events.pop_front();
+            }
+
+            oss << "</EVENTS>";
+
+            batch = oss.str();
+        }
+
+        pthread_mutex_unlock(&mutex);
+
+        failed = deliver(batch) != 0;
+
+        if ( !failed )
+        {
+            batch.clear();
+
+            retries = 0;
+            backoff = period;
+        }
+        else if ( socket_path.empty() && ++retries >= max_retries )
+        {
+            // The command keeps failing with this batch, do not block the bus
+            ostringstream oss;
+
+            oss << "Hook " << name << " command failed " << retries
+                << " times, batch of " << batch.size() << " bytes dropped";
+
+            NebulaLog::log("HKM", Log::ERROR, oss);
+
+            batch.clear();
+
+            failed  = false;
+            retries = 0;
+            backoff = period;
+        }
+        else
+        {
+            backoff = min(2 * backoff, max_retry_period);
+        }
+
+        pthread_mutex_lock(&mutex);
+    }
+
+    pthread_mutex_unlock(&mutex);
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+int HookEventBus::deliver(const string& batch)
+{
+    if ( socket_path.empty() )
+    {
+        return command_deliver(batch);
+    }
+
+    return socket_deliver(batch);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int HookEventBus::socket_deliver(const string& batch)
+{
+    if ( socket_fd == -1 )
+    {
+        struct sockaddr_un addr;
+
+        if ( socket_path.size() >= sizeof(addr.sun_path) )
+        {
+            NebulaLog::log("HKM", Log::ERROR, "Hook " + name + " socket path "
+                    "is too long: " + socket_path);
+            return -1;
+        }
+
+        memset(&addr, 0, sizeof(addr));
+
+        addr.sun_family = AF_UNIX;
+
+        strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+        socket_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+        if ( socket_fd == -1 )
+        {
+            return -1;
+        }
+
+        if ( connect(socket_fd, (struct sockaddr *) &addr, sizeof(addr)) != 0 )
+        {
+            ostringstream oss;
+
+            oss << "Hook " << name << " cannot connect to " << socket_path
+                << ": " << strerror(errno);
+
+            NebulaLog::log("HKM", Log::DEBUG, oss);
+
+            close(socket_fd);
+
+            socket_fd = -1;
+
+            return -1;
+        }
+    }
+
+    string msg = batch + "\n";
+
+    const char * buffer = msg.c_str();
+    size_t       left   = msg.size();
+
+    while ( left > 0 )
+    {
+        ssize_t rc = send(socket_fd, buffer, left, MSG_NOSIGNAL);
+
+        if ( rc == -1 )
+        {
+            if ( errno == EINTR )
+            {
+                continue;
+            }
+
+            ostringstream oss;
+
+            oss << "Hook " << name << " lost connection to " << socket_path
+                << ": " << strerror(errno);
+
+            NebulaLog::log("HKM", Log::WARNING, oss);
+
+            close(socket_fd);
+
+            socket_fd = -1;
+
+            return -1;
+        }
+
+        buffer += rc;
+        left   -= rc;
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int HookEventBus::command_deliver(const string& batch)
+{
+    HookManager * hm = Nebula::instance().get_hm();
+
+    const HookManagerDriver * hmd = 0;
+
+    if ( hm != 0 )
+    {
+        hmd = hm->get();
+    }
+
+    if ( hmd == 0 )
+    {
+        return -1;
+    }
+
+    string parsed = args;
+    size_t found  = parsed.find("$EVENTS");
+
+    if ( found != string::npos )
+    {
+        string * batch64 = one_util::base64_encode(batch);
+
+        if ( batch64 == 0 )
+        {
+            return -1;
+        }
+
+        parsed.replace(found, 7, *batch64);
+
+        delete batch64;
+    }
+
+    ostringstream tag;
+
+    pthread_mutex_lock(&mutex);
+
+    command_pending = true;
+    command_success = false;
+
+    tag << name << "#" << ++command_seq;
+
+    pthread_mutex_unlock(&mutex);
+
+    hmd->execute(-1, tag.str(), cmd, parsed);
+
+    struct timespec timeout;
+
+    clock_gettime(CLOCK_REALTIME, &timeout);
+
+    timeout.tv_sec += command_timeout;
+
+    pthread_mutex_lock(&mutex);
+
+    while ( command_pending && !finalized )
+    {
+        if ( pthread_cond_timedwait(&cond, &mutex, &timeout) == ETIMEDOUT )
+        {
+            NebulaLog::log("HKM", Log::WARNING, "Hook " + name + " timeout "
+                    "waiting for the command result, batch will be retried");
+            break;
+        }
+    }
+
+    // A result received after the timeout is ignored, its sequence does not
+    // match the next command
+    command_pending = false;
+
+    int rc = command_success ? 0 : -1;
+
+    pthread_mutex_unlock(&mutex);
+
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void HookEventBus::command_result(const string& tag, bool success)
+{
+    map<string, HookEventBus *>::iterator it;
+
+    unsigned long seq;
+
+    size_t pos = tag.rfind('#');
+
+    if ( pos == string::npos )
+    {
+        return;
+    }
+
+    istringstream iss(tag.substr(pos + 1));
+
+    iss >> seq;
+
+    if ( iss.fail() )
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&command_buses_mutex);
+
+    it = command_buses.find(tag.substr(0, pos));
+
+    if ( it != command_buses.end() )
+    {
+        HookEventBus * bus = it->second;
+
+        pthread_mutex_lock(&bus->mutex);
+
+        if ( bus->command_pending && bus->command_seq == seq )
+        {
+            bus->command_pending = false;
+            bus->command_success = success;
+
+            pthread_cond_signal(&bus->cond);
+        }
+
+        pthread_mutex_unlock(&bus->mutex);
+    }
+
+    pthread_mutex_unlock(&command_buses_mutex);
+}
@@ -15,6 +15,7 @@
 /* -------------------------------------------------------------------------- */
 
 #include "HookManagerDriver.h"
+#include "HookEventBus.h"
 #include "NebulaLog.h"
 #include <sstream>
 
@@ -135,6 +136,35 @@ void HookManagerDriver::protocol(const string& message) const
         return;
     }
 
+    // Hooks not associated to an object (e.g. event batches) use -1 as id
+    if ( id == -1 )
+    {
+        string info;
+
+        getline(is, info);
+
+        if ( action == "EXECUTE" )
+        {
+            bool success = result == "SUCCESS";
+
+            ostringstream oss;
+
+            oss << (success ? "Success" : "Error") << " executing Hook: "
+                << info;
+
+            NebulaLog::log("HKM", success ? Log::INFO : Log::ERROR, oss);
+
+            HookEventBus::command_result(info.substr(0, info.find(':')),
+                    success);
+        }
+        else if ( action == "LOG" )
+        {
+            NebulaLog::log("HKM", log_type(result[0]), info.c_str());
+        }
+
+        return;
+    }
+
     vm = vmpool->get(id,true);
 
     if ( vm == 0 )
@@ -63,12 +63,13 @@ Host::~Host()
 const char * Host::table = "host_pool";
 
 const char * Host::db_names =
-    "oid, name, body, state, last_mon_time, uid, gid, owner_u, group_u, other_u, cid";
+    "oid, name, body, state, last_mon_time, uid, gid, owner_u, group_u, other_u, "
+    "cid, short_body";
 
 const char * Host::db_bootstrap = "CREATE TABLE IF NOT EXISTS host_pool ("
     "oid INTEGER PRIMARY KEY, name VARCHAR(128), body MEDIUMTEXT, state INTEGER, "
     "last_mon_time INTEGER, uid INTEGER, gid INTEGER, owner_u INTEGER, "
-    "group_u INTEGER, other_u INTEGER, cid INTEGER)";
+    "group_u INTEGER, other_u INTEGER, cid INTEGER, short_body MEDIUMTEXT)";
 
 
 const char * Host::monit_table = "host_monitoring";
@@ -78,6 +79,11 @@ const char * Host::monit_db_names = "hid, last_mon_time, body";
 const char * Host::monit_db_bootstrap = "CREATE TABLE IF NOT EXISTS "
     "host_monitoring (hid INTEGER, last_mon_time INTEGER, body MEDIUMTEXT, "
     "PRIMARY KEY(hid, last_mon_time))";
+
+const SqlIndex Host::db_indexes[] = {
+    {"host_pool_mon_idx",   "host_pool",       "last_mon_time"},
+    {"host_monit_mon_idx",  "host_monitoring", "last_mon_time"},
+    {0, 0, 0}};
 /* ------------------------------------------------------------------------ */
 /* ------------------------------------------------------------------------ */
 
@@ -87,14 +93,24 @@ int Host::insert_replace(SqlDB *db, bool replace, string& error_str)
 
     int    rc;
     string xml_body;
+    string xml_short;
+    string digest;
 
     char * sql_hostname;
     char * sql_xml;
+    char * sql_short;
 
     // Set the owner and group to oneadmin
     set_user(0, "");
     set_group(GroupPool::ONEADMIN_ID, GroupPool::ONEADMIN_NAME);
 
+    to_body(xml_body);
+
+    if ( replace && !body_changed(xml_body, digest) )
+    {
+        return update_last_mon_time(db);
+    }
+
    // Update the Host
 
     sql_hostname = db->escape_str(name.c_str());
@@ -104,18 +120,25 @@ int Host::insert_replace(SqlDB *db, bool replace, string& error_str)
         goto error_hostname;
     }
 
-    sql_xml = db->escape_str(to_xml(xml_body).c_str());
+    sql_xml = db->escape_str(xml_body.c_str());
 
     if ( sql_xml == 0 )
     {
         goto error_body;
     }
 
-    if ( validate_xml(sql_xml) != 0 )
+    if ( !one_binary::is_binary(xml_body) && validate_xml(sql_xml) != 0 )
     {
         goto error_xml;
     }
 
+    sql_short = db->escape_str(to_xml_short(xml_short).c_str());
+
+    if ( sql_short == 0 )
+    {
+        goto error_short;
+    }
+
     if(replace)
     {
         oss << "REPLACE";
@@ -123,6 +146,7 @@ int Host::insert_replace(SqlDB *db, bool replace, string& error_str)
     else
     {
         oss << "INSERT";
+        digest = digest_body(xml_body);
     }
 
     // Construct the SQL statement to Insert or Replace
@@ -138,12 +162,19 @@ int Host::insert_replace(SqlDB *db, bool replace, string& error_str)
         <<          owner_u             << ","
         <<          group_u             << ","
         <<          other_u             << ","
-        <<          cluster_id          << ")";
+        <<          cluster_id          << ","
+        << "'" <<   sql_short           << "')";
 
     rc = db->exec_wr(oss);
 
     db->free_str(sql_hostname);
     db->free_str(sql_xml);
+    db->free_str(sql_short);
+
+    if ( rc == 0 )
+    {
+        body_written(digest);
+    }
 
     return rc;
 
@@ -155,6 +186,9 @@ error_xml:
 
     goto error_common;
 
+error_short:
+    db->free_str(sql_xml);
+
 error_body:
     db->free_str(sql_hostname);
     goto error_generic;
@@ -171,6 +205,35 @@ error_common:
 /* ------------------------------------------------------------------------ */
 /* ------------------------------------------------------------------------ */
 
+const char * const Host::volatile_names[] = { "LAST_MON_TIME", 0 };
+
+/* ------------------------------------------------------------------------ */
+
+int Host::update_last_mon_time(SqlDB *db)
+{
+    ostringstream oss;
+    string        xml_short;
+
+    char * sql_short = db->escape_str(to_xml_short(xml_short).c_str());
+
+    if ( sql_short == 0 )
+    {
+        return -1;
+    }
+
+    oss << "UPDATE " << table << " SET "
+        << "last_mon_time = " << last_monitored << ", "
+        << "short_body = '"   << sql_short << "' "
+        << "WHERE oid = "     << oid;
+
+    db->free_str(sql_short);
+
+    return db->exec_wr(oss);
+}
+
+/* ------------------------------------------------------------------------ */
+/* ------------------------------------------------------------------------ */
+
 int Host::extract_ds_info(
             string          &parse_str,
             Template        &tmpl,
@@ -242,6 +305,8 @@ int Host::update_info(Template        &tmpl,
     vector<Attribute*>           vm_att;
     vector<Attribute*>           ds_att;
     vector<VectorAttribute*>     pci_att;
+    vector<VectorAttribute*>     numa_att;
+    vector<VectorAttribute*>     huge_att;
     vector<VectorAttribute*>     local_ds_att;
 
     int   rc;
@@ -455,6 +520,12 @@ int Host::update_info(Template        &tmpl,
 
     host_share.set_pci_monitorization(pci_att);
 
+    obj_template->remove("NUMA_NODE", numa_att);
+
+    obj_template->remove("HUGEPAGE", huge_att);
+
+    host_share.set_numa_monitorization(numa_att, huge_att);
+
     return 0;
 }
 
@@ -623,9 +694,40 @@ string& Host::to_xml(string& xml) const
 /* ------------------------------------------------------------------------ */
 /* ------------------------------------------------------------------------ */
 
+string& Host::to_xml_short(string& xml) const
+{
+    string share_xml;
+
+    ostringstream oss;
+
+    oss <<
+    "<HOST>"
+       "<ID>"            << oid              << "</ID>"              <<
+       "<NAME>"          << name             << "</NAME>"            <<
+       "<STATE>"         << state            << "</STATE>"           <<
+       "<IM_MAD>"        << one_util::escape_xml(im_mad_name)  << "</IM_MAD>" <<
+       "<VM_MAD>"        << one_util::escape_xml(vmm_mad_name) << "</VM_MAD>" <<
+       "<LAST_MON_TIME>" << last_monitored   << "</LAST_MON_TIME>"   <<
+       "<CLUSTER_ID>"    << cluster_id       << "</CLUSTER_ID>"      <<
+       "<CLUSTER>"       << cluster          << "</CLUSTER>"         <<
+       host_share.to_xml_short(share_xml)  <<
+    "</HOST>";
+
+    xml = oss.str();
+
+    return xml;
+}
+
+/* ------------------------------------------------------------------------ */
+/* ------------------------------------------------------------------------ */
+
 int Host::from_xml(const string& xml)
 {
-    vector<xmlNodePtr> content;
+    ObjectXMLDecoder dec;
+
+    xmlNodePtr share_node;
+    xmlNodePtr tmpl_node;
+    xmlNodePtr vms_node;
 
     int int_state;
     int rc = 0;
@@ -634,17 +736,23 @@ int Host::from_xml(const string& xml)
     update_from_str(xml);
 
     // Get class base attributes
-    rc += xpath(oid, "/HOST/ID", -1);
-    rc += xpath(name, "/HOST/NAME", "not_found");
-    rc += xpath(int_state, "/HOST/STATE", 0);
+    dec.bind("/HOST/ID", oid, -1);
+    dec.bind("/HOST/NAME", name, "not_found");
+    dec.bind("/HOST/STATE", int_state, 0);
+
+    dec.bind("/HOST/IM_MAD", im_mad_name, "not_found");
+    dec.bind("/HOST/VM_MAD", vmm_mad_name, "not_found");
+
+    dec.bind<time_t>("/HOST/LAST_MON_TIME", last_monitored, 0);
 
-    rc += xpath(im_mad_name, "/HOST/IM_MAD", "not_found");
-    rc += xpath(vmm_mad_name, "/HOST/VM_MAD", "not_found");
+    dec.bind("/HOST/CLUSTER_ID", cluster_id, -1);
+    dec.bind("/HOST/CLUSTER",    cluster,    "not_found");
 
-    rc += xpath<time_t>(last_monitored, "/HOST/LAST_MON_TIME", 0);
+    dec.bind_node("/HOST/HOST_SHARE", share_node);
+    dec.bind_node("/HOST/TEMPLATE", tmpl_node);
+    dec.bind_node("/HOST/VMS", vms_node);
 
-    rc += xpath(cluster_id, "/HOST/CLUSTER_ID", -1);
-    rc += xpath(cluster,    "/HOST/CLUSTER",    "not_found");
+    rc += decode(dec);
 
     state = static_cast<HostState>( int_state );
 
@@ -654,36 +762,127 @@ int Host::from_xml(const string& xml)
 
     // ------------ Host Share ---------------
 
-    ObjectXML::get_nodes("/HOST/HOST_SHARE", content);
+    if (share_node == 0)
+    {
+        return -1;
+    }
+
+    rc += host_share.from_xml_node(share_node);
 
-    if (content.empty())
+    // ------------ Host Template ---------------
+
+    if (tmpl_node == 0)
     {
         return -1;
     }
 
-    rc += host_share.from_xml_node( content[0] );
+    rc += obj_template->from_xml_node(tmpl_node);
+
+    // ------------ VMS collection ---------------
 
-    ObjectXML::free_nodes(content);
+    if (vms_node == 0)
+    {
+        return -1;
+    }
 
-    content.clear();
+    rc += vm_collection.from_xml_node(vms_node);
 
-    // ------------ Host Template ---------------
+    if (rc != 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+/* ------------------------------------------------------------------------ */
+/* ------------------------------------------------------------------------ */
+
+int Host::to_binary(BinaryWriter& bw) const
+{
+    const set<int>& vms = vm_collection.get_collection();
+
+    set<int>::const_iterator it;
+
+    bw.put(oid);
+    bw.put(name);
+    bw.put(static_cast<long long>(state));
+    bw.put(im_mad_name);
+    bw.put(vmm_mad_name);
+    bw.put(cluster_id);
+    bw.put(cluster);
+
+    host_share.to_binary(bw);
+
+    bw.put(static_cast<long long>(vms.size()));
+
+    for (it = vms.begin(); it != vms.end(); ++it)
+    {
+        bw.put(*it);
+    }
+
+    obj_template->to_binary(bw);
 
-    ObjectXML::get_nodes("/HOST/TEMPLATE", content);
+    bw.mark_volatile();
 
-    if( content.empty())
+    bw.put(last_monitored);
+
+    return 0;
+}
+
+/* ------------------------------------------------------------------------ */
+
+int Host::from_binary(BinaryReader& br)
+{
+    int       int_state;
+    long long num_vms;
+    int       rc = 0;
+
+    rc += br.get(oid);
+    rc += br.get(name);
+    rc += br.get(int_state);
+    rc += br.get(im_mad_name);
+    rc += br.get(vmm_mad_name);
+    rc += br.get(cluster_id);
+    rc += br.get(cluster);
+
+    if ( rc != 0 )
     {
         return -1;
     }
 
-    rc += obj_template->from_xml_node( content[0] );
+    state = static_cast<HostState>( int_state );
+
+    // Set the owner and group to oneadmin
+    set_user(0, "");
+    set_group(GroupPool::ONEADMIN_ID, GroupPool::ONEADMIN_NAME);
 
-    ObjectXML::free_nodes(content);
+    rc += host_share.from_binary(br);
 
-    content.clear();
+    rc += br.get(num_vms);
 
-    // ------------ VMS collection ---------------
-    rc += vm_collection.from_xml(this, "/HOST/");
+    if ( rc != 0 )
+    {
+        return -1;
+    }
+
+    vm_collection.clear();
+
+    for (long long i = 0; i < num_vms; ++i)
+    {
+        int vmid;
+
+        if ( br.get(vmid) != 0 )
+        {
+            return -1;
+        }
+
+        vm_collection.add(vmid);
+    }
+
+    rc += obj_template->from_binary(br);
+
+    rc += br.get(last_monitored);
 
     if (rc != 0)
     {
@@ -693,6 +892,9 @@ int Host::from_xml(const string& xml)
     return 0;
 }
 
+/* ------------------------------------------------------------------------ */
+/* ------------------------------------------------------------------------ */
+
 static void nebula_crypt(const std::string in, std::string& out)
 {
     Nebula& nd = Nebula::instance();
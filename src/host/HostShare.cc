@@ -20,6 +20,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <iomanip>
+#include <algorithm>
 
 #include "HostShare.h"
 #include "Host.h"
@@ -46,6 +47,20 @@ int HostSharePCI::from_xml_node(const xmlNodePtr node)
 
 /* ------------------------------------------------------------------------*/
 
+int HostSharePCI::from_binary(BinaryReader& br)
+{
+    if ( Template::from_binary(br) != 0 )
+    {
+        return -1;
+    }
+
+    init();
+
+    return 0;
+}
+
+/* ------------------------------------------------------------------------*/
+
 void HostSharePCI::init()
 {
     vector<VectorAttribute *> devices;
@@ -377,6 +392,680 @@ ostream& operator<<(ostream& os, const HostSharePCI& pci)
 	return os;
 }
 
+/* ************************************************************************ */
+/* HostShareNUMA                                                            */
+/* ************************************************************************ */
+
+/**
+ *  Parses a list of id:value pairs, e.g. "0:-1,1:5". Elements without value
+ *  (as reported by the monitor probes, "0,1") are set to the default value.
+ */
+template<class K, class V>
+static void parse_pairs(const string& str, V dvalue, map<K, V>& pairs)
+{
+    vector<string> elems = one_util::split(str, ',');
+    vector<string>::iterator it;
+
+    for (it = elems.begin(); it != elems.end(); ++it)
+    {
+        K key;
+        V value = dvalue;
+
+        replace(it->begin(), it->end(), ':', ' ');
+
+        istringstream iss(*it);
+
+        iss >> key;
+
+        if (iss.fail())
+        {
+            continue;
+        }
+
+        iss >> value;
+
+        if (iss.fail())
+        {
+            value = dvalue;
+        }
+
+        pairs[key] = value;
+    }
+}
+
+template<class K, class V>
+static string pairs_to_str(const map<K, V>& pairs)
+{
+    ostringstream oss;
+
+    typename map<K, V>::const_iterator it;
+
+    for (it = pairs.begin(); it != pairs.end(); ++it)
+    {
+        if (it != pairs.begin())
+        {
+            oss << ",";
+        }
+
+        oss << it->first << ":" << it->second;
+    }
+
+    return oss.str();
+}
+
+/**
+ *  Resources requested by a VM NUMA node
+ *    @param vnode the VM NUMA_NODE attribute
+ *    @param vcpus CPUs to pin, 0 if the node is not pinned
+ *    @param mem memory of the node (in KB)
+ *    @param hp_size page size (in KB), 0 if not backed by hugepages
+ *    @param hp_pages number of hugepages needed
+ */
+static void vm_node_request(const VectorAttribute * vnode, unsigned int& vcpus,
+        long long& mem, unsigned long& hp_size, unsigned long& hp_pages)
+{
+    vcpus    = 0;
+    mem      = 0;
+    hp_size  = 0;
+    hp_pages = 0;
+
+    if ( vnode->vector_value("PIN_POLICY") != "NONE" )
+    {
+        vnode->vector_value("TOTAL_CPUS", vcpus);
+    }
+
+    vnode->vector_value("MEMORY", mem);
+
+    vnode->vector_value("HUGEPAGE_SIZE", hp_size);
+
+    if ( hp_size > 0 && mem > 0 )
+    {
+        hp_pages = (mem + hp_size - 1) / hp_size;
+    }
+}
+
+/* ------------------------------------------------------------------------*/
+/* ------------------------------------------------------------------------*/
+
+HostShareNUMA::HugePage::HugePage(VectorAttribute * _attrs)
+    : size(0), pages(0), usage(0), attrs(_attrs)
+{
+    map<int, unsigned long>::iterator it;
+
+    attrs->vector_value("SIZE", size);
+    attrs->vector_value("PAGES", pages);
+
+    parse_pairs(attrs->vector_value("VMS"), 0UL, vms);
+
+    for (it = vms.begin(); it != vms.end(); ++it)
+    {
+        usage += it->second;
+    }
+
+    update_attrs();
+}
+
+/* ------------------------------------------------------------------------*/
+
+void HostShareNUMA::HugePage::update_attrs()
+{
+    attrs->replace("USAGE", usage);
+    attrs->replace("VMS", pairs_to_str(vms));
+}
+
+/* ------------------------------------------------------------------------*/
+/* ------------------------------------------------------------------------*/
+
+HostShareNUMA::NUMANode::NUMANode(VectorAttribute * _attrs)
+    : node_id(0), total_mem(0), mem_usage(0), attrs(_attrs)
+{
+    map<int, long long>::iterator it;
+
+    attrs->vector_value("NODE_ID", node_id);
+    attrs->vector_value("TOTAL_MEMORY", total_mem);
+
+    parse_pairs(attrs->vector_value("CPUS"), -1, cpus);
+    parse_pairs(attrs->vector_value("VMS_MEMORY"), 0LL, vms_mem);
+
+    for (it = vms_mem.begin(); it != vms_mem.end(); ++it)
+    {
+        mem_usage += it->second;
+    }
+
+    update_attrs();
+}
+
+/* ------------------------------------------------------------------------*/
+
+unsigned int HostShareNUMA::NUMANode::free_cpus() const
+{
+    map<unsigned int, int>::const_iterator it;
+
+    unsigned int num = 0;
+
+    for (it = cpus.begin(); it != cpus.end(); ++it)
+    {
+        if ( it->second == -1 )
+        {
+            num++;
+        }
+    }
+
+    return num;
+}
+
+/* ------------------------------------------------------------------------*/
+
+void HostShareNUMA::NUMANode::update_attrs()
+{
+    attrs->replace("CPUS", pairs_to_str(cpus));
+    attrs->replace("VMS_MEMORY", pairs_to_str(vms_mem));
+    attrs->replace("MEMORY_USAGE", mem_usage);
+}
+
+/* ------------------------------------------------------------------------*/
+/* ------------------------------------------------------------------------*/
+
+HostShareNUMA::~HostShareNUMA()
+{
+    map<unsigned int, NUMANode *>::iterator it;
+
+    for (it = nodes.begin(); it != nodes.end(); ++it)
+    {
+        delete it->second;
+    }
+}
+
+/* ------------------------------------------------------------------------*/
+
+int HostShareNUMA::from_xml_node(const xmlNodePtr node)
+{
+    int rc = Template::from_xml_node(node);
+
+    if (rc != 0)
+    {
+        return -1;
+    }
+
+    init();
+
+    return 0;
+}
+
+/* ------------------------------------------------------------------------*/
+
+int HostShareNUMA::from_binary(BinaryReader& br)
+{
+    if ( Template::from_binary(br) != 0 )
+    {
+        return -1;
+    }
+
+    init();
+
+    return 0;
+}
+
+/* ------------------------------------------------------------------------*/
+
+void HostShareNUMA::init()
+{
+    vector<VectorAttribute *> numa_nodes;
+    vector<VectorAttribute *>::iterator it;
+
+    get("NODE", numa_nodes);
+
+    for (it = numa_nodes.begin(); it != numa_nodes.end(); ++it)
+    {
+        NUMANode * node = new NUMANode(*it);
+
+        nodes.insert(make_pair(node->node_id, node));
+    }
+
+    vector<VectorAttribute *> hugepages;
+
+    get("HUGEPAGE", hugepages);
+
+    for (it = hugepages.begin(); it != hugepages.end(); ++it)
+    {
+        map<unsigned int, NUMANode *>::iterator nt;
+
+        unsigned int node_id;
+
+        if ( (*it)->vector_value("NODE_ID", node_id) != 0 ||
+             (nt = nodes.find(node_id)) == nodes.end() )
+        {
+            continue;
+        }
+
+        HugePage hp(*it);
+
+        nt->second->hugepages.insert(make_pair(hp.size, hp));
+    }
+}
+
+/* ------------------------------------------------------------------------*/
+/* ------------------------------------------------------------------------*/
+
+static bool less_free_cpus(const pair<unsigned int, unsigned int>& a,
+        const pair<unsigned int, unsigned int>& b)
+{
+    return a.first < b.first || (a.first == b.first && a.second < b.second);
+}
+
+bool HostShareNUMA::schedule(const vector<VectorAttribute *> &vm_nodes,
+        vector<NUMANode *>& placement) const
+{
+    vector<VectorAttribute *>::const_iterator it;
+    vector<pair<unsigned int, unsigned int> >::iterator jt;
+    map<unsigned int, NUMANode *>::const_iterator nt;
+
+    map<unsigned int, unsigned int> free_cpus;
+    map<unsigned int, long long>    free_mem;
+
+    // Free hugepages, <node id, page size> -> pages
+    map<pair<unsigned int, unsigned long>, unsigned long> free_pages;
+
+    // Nodes sorted by free CPUs, <free cpus, node id>
+    vector<pair<unsigned int, unsigned int> > sorted;
+
+    placement.clear();
+
+    for (nt = nodes.begin(); nt != nodes.end(); ++nt)
+    {
+        map<unsigned long, HugePage>::const_iterator ht;
+
+        free_cpus[nt->first] = nt->second->free_cpus();
+        free_mem[nt->first]  = nt->second->free_memory();
+
+        for (ht = nt->second->hugepages.begin();
+                ht != nt->second->hugepages.end(); ++ht)
+        {
+            free_pages[make_pair(nt->first, ht->first)] =
+                ht->second.free_pages();
+        }
+    }
+
+    for (it = vm_nodes.begin(); it != vm_nodes.end(); ++it)
+    {
+        unsigned int  vcpus;
+        long long     mem;
+        unsigned long hp_size;
+        unsigned long hp_pages;
+
+        vm_node_request(*it, vcpus, mem, hp_size, hp_pages);
+
+        sorted.clear();
+
+        for (nt = nodes.begin(); nt != nodes.end(); ++nt)
+        {
+            sorted.push_back(make_pair(free_cpus[nt->first], nt->first));
+        }
+
+        sort(sorted.begin(), sorted.end(), less_free_cpus);
+
+        for (jt = sorted.begin(); jt != sorted.end(); ++jt)
+        {
+            if ( jt->first < vcpus )
+            {
+                continue;
+            }
+
+            if ( hp_size > 0 )
+            {
+                if (free_pages[make_pair(jt->second, hp_size)] >= hp_pages)
+                {
+                    break;
+                }
+            }
+            else if ( free_mem[jt->second] >= mem )
+            {
+                break;
+            }
+        }
+
+        if ( jt == sorted.end() )
+        {
+            placement.clear();
+            return false;
+        }
+
+        free_cpus[jt->second] -= vcpus;
+
+        if ( hp_size > 0 )
+        {
+            free_pages[make_pair(jt->second, hp_size)] -= hp_pages;
+        }
+        else
+        {
+            free_mem[jt->second] -= mem;
+        }
+
+        placement.push_back(nodes.find(jt->second)->second);
+    }
+
+    return true;
+}
+
+/* ------------------------------------------------------------------------*/
+
+bool HostShareNUMA::test(const vector<VectorAttribute *> &vm_nodes) const
+{
+    vector<NUMANode *> placement;
+
+    if ( vm_nodes.empty() )
+    {
+        return true;
+    }
+
+    return schedule(vm_nodes, placement);
+}
+
+/* ------------------------------------------------------------------------*/
+
+int HostShareNUMA::add(vector<VectorAttribute *> &vm_nodes, int vmid)
+{
+    vector<NUMANode *> placement;
+
+    if ( !schedule(vm_nodes, placement) )
+    {
+        // Do not keep the assignment of a previous host
+        for (unsigned int i = 0; i < vm_nodes.size(); ++i)
+        {
+            vm_nodes[i]->remove("NODE_ID");
+            vm_nodes[i]->remove("CPUS");
+        }
+
+        return -1;
+    }
+
+    for (unsigned int i = 0; i < vm_nodes.size(); ++i)
+    {
+        NUMANode *    node = placement[i];
+        unsigned int  vcpus;
+        long long     mem;
+        unsigned long hp_size;
+        unsigned long hp_pages;
+
+        std::set<unsigned int> vm_cpus;
+
+        map<unsigned int, int>::iterator ct;
+
+        vm_node_request(vm_nodes[i], vcpus, mem, hp_size, hp_pages);
+
+        for (ct = node->cpus.begin(); ct != node->cpus.end() &&
+                vm_cpus.size() < vcpus; ++ct)
+        {
+            if ( ct->second == -1 )
+            {
+                ct->second = vmid;
+                vm_cpus.insert(ct->first);
+            }
+        }
+
+        if ( hp_size > 0 )
+        {
+            HugePage& hp = node->hugepages.find(hp_size)->second;
+
+            hp.vms[vmid] += hp_pages;
+            hp.usage     += hp_pages;
+
+            hp.update_attrs();
+        }
+        else
+        {
+            node->vms_mem[vmid] += mem;
+            node->mem_usage     += mem;
+        }
+
+        node->update_attrs();
+
+        vm_nodes[i]->replace("NODE_ID", node->node_id);
+
+        if ( vm_cpus.empty() )
+        {
+            vm_nodes[i]->remove("CPUS");
+        }
+        else
+        {
+            vm_nodes[i]->replace("CPUS", one_util::join(vm_cpus, ','));
+        }
+    }
+
+    return 0;
+}
+
+/* ------------------------------------------------------------------------*/
+
+void HostShareNUMA::del(int vmid)
+{
+    map<unsigned int, NUMANode *>::iterator it;
+    map<unsigned int, int>::iterator ct;
+    map<int, long long>::iterator mt;
+    map<unsigned long, HugePage>::iterator ht;
+
+    for (it = nodes.begin(); it != nodes.end(); ++it)
+    {
+        NUMANode * node = it->second;
+
+        bool update = false;
+
+        for (ct = node->cpus.begin(); ct != node->cpus.end(); ++ct)
+        {
+            if ( ct->second == vmid )
+            {
+                ct->second = -1;
+                update     = true;
+            }
+        }
+
+        mt = node->vms_mem.find(vmid);
+
+        if ( mt != node->vms_mem.end() )
+        {
+            node->mem_usage -= mt->second;
+
+            node->vms_mem.erase(mt);
+
+            update = true;
+        }
+
+        for (ht = node->hugepages.begin(); ht != node->hugepages.end(); ++ht)
+        {
+            map<int, unsigned long>::iterator pt = ht->second.vms.find(vmid);
+
+            if ( pt != ht->second.vms.end() )
+            {
+                ht->second.usage -= pt->second;
+
+                ht->second.vms.erase(pt);
+
+                ht->second.update_attrs();
+            }
+        }
+
+        if ( update )
+        {
+            node->update_attrs();
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------*/
+/* ------------------------------------------------------------------------*/
+
+void HostShareNUMA::set_monitorization(vector<VectorAttribute*> &numa_att,
+        vector<VectorAttribute*> &huge_att)
+{
+    vector<VectorAttribute*>::iterator it;
+    map<unsigned int, NUMANode *>::iterator nt;
+
+    std::set<unsigned int> missing;
+    std::set<unsigned int>::iterator jt;
+
+    for (nt = nodes.begin(); nt != nodes.end(); ++nt)
+    {
+        missing.insert(nt->first);
+    }
+
+    for (it = numa_att.begin(); it != numa_att.end(); ++it)
+    {
+        VectorAttribute * mnode = *it;
+
+        unsigned int node_id;
+
+        if ( mnode->vector_value("NODE_ID", node_id) != 0 )
+        {
+            delete mnode;
+            continue;
+        }
+
+        nt = nodes.find(node_id);
+
+        if ( nt == nodes.end() )
+        {
+            VectorAttribute * attrs = new VectorAttribute("NODE");
+
+            attrs->replace("NODE_ID", node_id);
+
+            set(attrs);
+
+            nt = nodes.insert(make_pair(node_id,new NUMANode(attrs))).first;
+        }
+        else
+        {
+            missing.erase(node_id);
+        }
+
+        NUMANode * node = nt->second;
+
+        // ----------------- Update CPUs, keep the VM assignment ---------------
+        map<unsigned int, int> mcpus;
+        map<unsigned int, int>::iterator ct;
+
+        parse_pairs(mnode->vector_value("CPUS"), -1, mcpus);
+
+        for (ct = node->cpus.begin(); ct != node->cpus.end(); ++ct)
+        {
+            if ( ct->second != -1 )
+            {
+                mcpus[ct->first] = ct->second;
+            }
+        }
+
+        node->cpus = mcpus;
+
+        // ----------------- Update memory ---------------------------------
+        mnode->vector_value("TOTAL_MEMORY", node->total_mem);
+
+        node->attrs->replace("TOTAL_MEMORY", node->total_mem);
+        node->attrs->replace("FREE_MEMORY", mnode->vector_value("FREE_MEMORY"));
+
+        node->update_attrs();
+
+        delete mnode;
+    }
+
+    // ------------------------- Hugepage pools ---------------------------
+    std::set<pair<unsigned int, unsigned long> > missing_hp;
+
+    map<unsigned long, HugePage>::iterator ht;
+
+    for (nt = nodes.begin(); nt != nodes.end(); ++nt)
+    {
+        for (ht = nt->second->hugepages.begin();
+                ht != nt->second->hugepages.end(); ++ht)
+        {
+            missing_hp.insert(make_pair(nt->first, ht->first));
+        }
+    }
+
+    for (it = huge_att.begin(); it != huge_att.end(); ++it)
+    {
+        VectorAttribute * mpage = *it;
+
+        unsigned int  node_id;
+        unsigned long size;
+
+        if ( mpage->vector_value("NODE_ID", node_id) != 0 ||
+             mpage->vector_value("SIZE", size) != 0 || size == 0 ||
+             (nt = nodes.find(node_id)) == nodes.end() )
+        {
+            delete mpage;
+            continue;
+        }
+
+        NUMANode * node = nt->second;
+
+        ht = node->hugepages.find(size);
+
+        if ( ht == node->hugepages.end() )
+        {
+            VectorAttribute * attrs = new VectorAttribute("HUGEPAGE");
+
+            attrs->replace("NODE_ID", node_id);
+            attrs->replace("SIZE", size);
+
+            set(attrs);
+
+            ht = node->hugepages.insert(make_pair(size,HugePage(attrs))).first;
+        }
+        else
+        {
+            missing_hp.erase(make_pair(node_id, size));
+        }
+
+        mpage->vector_value("PAGES", ht->second.pages);
+
+        ht->second.attrs->replace("PAGES", ht->second.pages);
+        ht->second.attrs->replace("FREE", mpage->vector_value("FREE"));
+
+        delete mpage;
+    }
+
+    std::set<pair<unsigned int, unsigned long> >::iterator mt;
+
+    for (mt = missing_hp.begin(); mt != missing_hp.end(); ++mt)
+    {
+        NUMANode * node = nodes[mt->first];
+
+        ht = node->hugepages.find(mt->second);
+
+        if ( !ht->second.vms.empty() )
+        {
+            continue;
+        }
+
+        remove(ht->second.attrs);
+
+        delete ht->second.attrs;
+
+        node->hugepages.erase(ht);
+    }
+
+    // -------------- Remove nodes not reported and not in use --------------
+    for (jt = missing.begin(); jt != missing.end(); ++jt)
+    {
+        nt = nodes.find(*jt);
+
+        NUMANode * node = nt->second;
+
+        if ( !node->vms_mem.empty() || !node->hugepages.empty() ||
+             node->free_cpus() != node->cpus.size() )
+        {
+            continue;
+        }
+
+        remove(node->attrs);
+
+        delete node->attrs;
+
+        delete node;
+
+        nodes.erase(nt);
+    }
+}
+
 /* ************************************************************************ */
 /* HostShare :: Constructor/Destructor                                      */
 /* ************************************************************************ */
@@ -413,11 +1102,45 @@ ostream& operator<<(ostream& os, HostShare& hs)
 
 string& HostShare::to_xml(string& xml) const
 {
-    string ds_xml, pci_xml;
+    string ds_xml, pci_xml, numa_xml;
     ostringstream   oss;
 
-    oss << "<HOST_SHARE>"
-          << "<DISK_USAGE>" << disk_usage << "</DISK_USAGE>"
+    oss << "<HOST_SHARE>";
+
+    counters_to_xml(oss);
+
+    oss << ds.to_xml(ds_xml)
+        << pci.to_xml(pci_xml)
+        << numa.to_xml(numa_xml)
+        << "</HOST_SHARE>";
+
+    xml = oss.str();
+
+    return xml;
+}
+
+/* ------------------------------------------------------------------------ */
+
+string& HostShare::to_xml_short(string& xml) const
+{
+    ostringstream oss;
+
+    oss << "<HOST_SHARE>";
+
+    counters_to_xml(oss);
+
+    oss << "</HOST_SHARE>";
+
+    xml = oss.str();
+
+    return xml;
+}
+
+/* ------------------------------------------------------------------------ */
+
+void HostShare::counters_to_xml(ostringstream& oss) const
+{
+    oss   << "<DISK_USAGE>" << disk_usage << "</DISK_USAGE>"
           << "<MEM_USAGE>"  << mem_usage  << "</MEM_USAGE>"
           << "<CPU_USAGE>"  << cpu_usage  << "</CPU_USAGE>"
           << "<TOTAL_MEM>"  << total_mem  << "</TOTAL_MEM>"
@@ -431,14 +1154,7 @@ string& HostShare::to_xml(string& xml) const
           << "<USED_DISK>"  << used_disk  << "</USED_DISK>"
           << "<USED_MEM>"   << used_mem   << "</USED_MEM>"
           << "<USED_CPU>"   << used_cpu   << "</USED_CPU>"
-          << "<RUNNING_VMS>"<<running_vms <<"</RUNNING_VMS>"
-          << ds.to_xml(ds_xml)
-          << pci.to_xml(pci_xml)
-        << "</HOST_SHARE>";
-
-    xml = oss.str();
-
-    return xml;
+          << "<RUNNING_VMS>"<<running_vms <<"</RUNNING_VMS>";
 }
 
 /* ------------------------------------------------------------------------ */
@@ -446,69 +1162,153 @@ string& HostShare::to_xml(string& xml) const
 
 int HostShare::from_xml_node(const xmlNodePtr node)
 {
-    vector<xmlNodePtr> content;
+    ObjectXMLDecoder dec;
+
+    xmlNodePtr ds_node;
+    xmlNodePtr pci_node;
+    xmlNodePtr numa_node;
+
     int rc = 0;
 
-    // Initialize the internal XML object
-    ObjectXML::update_from_node(node);
+    dec.bind<long long>("/HOST_SHARE/DISK_USAGE", disk_usage, -1);
+    dec.bind<long long>("/HOST_SHARE/MEM_USAGE",  mem_usage,  -1);
+    dec.bind<long long>("/HOST_SHARE/CPU_USAGE",  cpu_usage,  -1);
+
+    dec.bind<long long>("/HOST_SHARE/TOTAL_MEM",  total_mem,  -1);
+    dec.bind<long long>("/HOST_SHARE/TOTAL_CPU",  total_cpu,  -1);
 
-    rc += xpath<long long>(disk_usage, "/HOST_SHARE/DISK_USAGE", -1);
-    rc += xpath<long long>(mem_usage,  "/HOST_SHARE/MEM_USAGE",  -1);
-    rc += xpath<long long>(cpu_usage,  "/HOST_SHARE/CPU_USAGE",  -1);
+    dec.bind<long long>("/HOST_SHARE/MAX_DISK",   max_disk,   -1);
+    dec.bind<long long>("/HOST_SHARE/MAX_MEM",    max_mem,    -1);
+    dec.bind<long long>("/HOST_SHARE/MAX_CPU",    max_cpu,    -1);
 
-    rc += xpath<long long>(total_mem ,  "/HOST_SHARE/TOTAL_MEM", -1);
-    rc += xpath<long long>(total_cpu,   "/HOST_SHARE/TOTAL_CPU", -1);
+    dec.bind<long long>("/HOST_SHARE/FREE_DISK",  free_disk,  -1);
+    dec.bind<long long>("/HOST_SHARE/FREE_MEM",   free_mem,   -1);
+    dec.bind<long long>("/HOST_SHARE/FREE_CPU",   free_cpu,   -1);
 
-    rc += xpath<long long>(max_disk,   "/HOST_SHARE/MAX_DISK",   -1);
-    rc += xpath<long long>(max_mem ,   "/HOST_SHARE/MAX_MEM",    -1);
-    rc += xpath<long long>(max_cpu ,   "/HOST_SHARE/MAX_CPU",    -1);
+    dec.bind<long long>("/HOST_SHARE/USED_DISK",  used_disk,  -1);
+    dec.bind<long long>("/HOST_SHARE/USED_MEM",   used_mem,   -1);
+    dec.bind<long long>("/HOST_SHARE/USED_CPU",   used_cpu,   -1);
 
-    rc += xpath<long long>(free_disk,  "/HOST_SHARE/FREE_DISK",  -1);
-    rc += xpath<long long>(free_mem ,  "/HOST_SHARE/FREE_MEM",   -1);
-    rc += xpath<long long>(free_cpu ,  "/HOST_SHARE/FREE_CPU",   -1);
+    dec.bind<long long>("/HOST_SHARE/RUNNING_VMS",running_vms,-1);
 
-    rc += xpath<long long>(used_disk,  "/HOST_SHARE/USED_DISK",  -1);
-    rc += xpath<long long>(used_mem ,  "/HOST_SHARE/USED_MEM",   -1);
-    rc += xpath<long long>(used_cpu ,  "/HOST_SHARE/USED_CPU",   -1);
+    dec.bind_node("/HOST_SHARE/DATASTORES",  ds_node);
+    dec.bind_node("/HOST_SHARE/PCI_DEVICES", pci_node);
+    dec.bind_node("/HOST_SHARE/NUMA_NODES",  numa_node);
 
-    rc += xpath<long long>(running_vms,"/HOST_SHARE/RUNNING_VMS",-1);
+    // The node is decoded in place, it is not copied to the internal XML
+    rc += dec.decode(node);
 
     // ------------ Datastores ---------------
 
-    ObjectXML::get_nodes("/HOST_SHARE/DATASTORES", content);
+    if( ds_node == 0 )
+    {
+        return -1;
+    }
 
-    if( content.empty())
+    rc += ds.from_xml_node(ds_node);
+
+    if (rc != 0)
     {
         return -1;
     }
 
-    rc += ds.from_xml_node( content[0] );
+    // ------------ PCI Devices ---------------
 
-    ObjectXML::free_nodes(content);
+    if( pci_node == 0 )
+    {
+        return -1;
+    }
 
-    content.clear();
+    rc += pci.from_xml_node(pci_node);
 
     if (rc != 0)
     {
         return -1;
     }
 
-    // ------------ PCI Devices ---------------
+    // ------------ NUMA Nodes ---------------
 
-    ObjectXML::get_nodes("/HOST_SHARE/PCI_DEVICES", content);
+    if (numa_node != 0)
+    {
+        rc += numa.from_xml_node(numa_node);
+    }
 
-    if( content.empty())
+    if (rc != 0)
     {
         return -1;
     }
 
-    rc += pci.from_xml_node( content[0] );
+    return 0;
+}
 
-    ObjectXML::free_nodes(content);
+/* ------------------------------------------------------------------------ */
+/* ------------------------------------------------------------------------ */
 
-    content.clear();
+void HostShare::to_binary(BinaryWriter& bw) const
+{
+    bw.put(disk_usage);
+    bw.put(mem_usage);
+    bw.put(cpu_usage);
 
-    if (rc != 0)
+    bw.put(total_mem);
+    bw.put(total_cpu);
+
+    bw.put(max_disk);
+    bw.put(max_mem);
+    bw.put(max_cpu);
+
+    bw.put(free_disk);
+    bw.put(free_mem);
+    bw.put(free_cpu);
+
+    bw.put(used_disk);
+    bw.put(used_mem);
+    bw.put(used_cpu);
+
+    bw.put(running_vms);
+
+    ds.to_binary(bw);
+    pci.to_binary(bw);
+    numa.to_binary(bw);
+}
+
+/* ------------------------------------------------------------------------ */
+
+int HostShare::from_binary(BinaryReader& br)
+{
+    int rc = 0;
+
+    rc += br.get(disk_usage);
+    rc += br.get(mem_usage);
+    rc += br.get(cpu_usage);
+
+    rc += br.get(total_mem);
+    rc += br.get(total_cpu);
+
+    rc += br.get(max_disk);
+    rc += br.get(max_mem);
+    rc += br.get(max_cpu);
+
+    rc += br.get(free_disk);
+    rc += br.get(free_mem);
+    rc += br.get(free_cpu);
+
+    rc += br.get(used_disk);
+    rc += br.get(used_mem);
+    rc += br.get(used_cpu);
+
+    rc += br.get(running_vms);
+
+    if ( rc != 0 )
+    {
+        return -1;
+    }
+
+    rc += ds.from_binary(br);
+    rc += pci.from_binary(br);
+    rc += numa.from_binary(br);
+
+    if ( rc != 0 )
     {
         return -1;
     }
@@ -516,7 +1316,6 @@ int HostShare::from_xml_node(const xmlNodePtr node)
     return 0;
 }
 
-
 /* ------------------------------------------------------------------------ */
 /* ------------------------------------------------------------------------ */
 
@@ -16,33 +16,73 @@
 
 #include "ListenerThread.h"
 
+#include <sstream>
+
 #include <unistd.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
 #include <sys/socket.h>
 
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-const size_t ListenerThread::MESSAGE_SIZE = 100000;
-const size_t ListenerThread::BUFFER_SIZE  = 100;
+const size_t ListenerThread::MESSAGE_SIZE = 65536;
+const size_t ListenerThread::BATCH_SIZE   = 16;
 
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-void ListenerThread::flush_buffer(int fd)
+void ListenerThread::flush_buffer(std::map<int, MonitorMessage>& hosts,
+        std::vector<std::string>& others, unsigned long long& _received,
+        unsigned long long& _coalesced, unsigned long long& _dropped)
 {
-    lock();
+    std::map<int, MonitorMessage>::iterator it;
+    std::vector<std::string>::iterator      jt;
 
-    std::vector<std::string>::iterator it;
+    lock();
 
-    for(it = monitor_data.begin() ; it != monitor_data.end(); ++it)
+    for(it = host_data.begin() ; it != host_data.end(); ++it)
     {
-        size_t size = (*it).size();
-        const char * message = (*it).c_str();
+        std::map<int, MonitorMessage>::iterator ht = hosts.find(it->first);
+
+        if ( ht == hosts.end() )
+        {
+            MonitorMessage& mm = hosts[it->first];
+
+            mm.time = it->second.time;
+            mm.data.swap(it->second.data);
+
+            continue;
+        }
+
+        // Received by other listener, keep the latest one
+        if ( it->second.time > ht->second.time )
+        {
+            ht->second.time = it->second.time;
+            ht->second.data.swap(it->second.data);
+        }
 
-        write(fd, message, size);
+        _coalesced++;
     }
 
-    monitor_data.clear();
+    for(jt = other_data.begin() ; jt != other_data.end(); ++jt)
+    {
+        others.push_back(std::string());
+        others.back().swap(*jt);
+    }
+
+    host_data.clear();
+
+    other_data.clear();
+
+    _received  += received;
+    _coalesced += coalesced;
+    _dropped   += dropped;
+
+    received  = 0;
+    coalesced = 0;
+    dropped   = 0;
 
     unlock();
 }
@@ -50,28 +90,117 @@ void ListenerThread::flush_buffer(int fd)
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+void ListenerThread::add_message(const char * msg, size_t size,
+        unsigned long long time)
+{
+    int hid;
+
+    std::string message(msg, size);
+
+    // Messages are "MONITOR <result> <host_id> <monitor data>"
+    if ( sscanf(message.c_str(), "MONITOR %*s %d", &hid) != 1 )
+    {
+        other_data.push_back(std::string());
+        other_data.back().swap(message);
+
+        return;
+    }
+
+    std::map<int, MonitorMessage>::iterator it = host_data.find(hid);
+
+    if ( it != host_data.end() )
+    {
+        coalesced++;
+    }
+    else
+    {
+        it = host_data.insert(std::make_pair(hid, MonitorMessage())).first;
+    }
+
+    it->second.time = time;
+    it->second.data.swap(message);
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 void ListenerThread::monitor_loop()
 {
-    char   buffer[MESSAGE_SIZE];
-    size_t rc;
+    std::vector<char> buffer(BATCH_SIZE * MESSAGE_SIZE);
+
+    // Kernel receive timestamps to order messages read by different threads
+    const size_t CONTROL_SIZE = CMSG_SPACE(sizeof(struct timespec));
+
+    std::vector<char> control(BATCH_SIZE * CONTROL_SIZE);
+
+    std::vector<struct mmsghdr> msgs(BATCH_SIZE);
+    std::vector<struct iovec>   iovs(BATCH_SIZE);
+
+    for (size_t i = 0; i < BATCH_SIZE; i++)
+    {
+        iovs[i].iov_base = &buffer[i * MESSAGE_SIZE];
+        iovs[i].iov_len  = MESSAGE_SIZE;
+
+        memset(&msgs[i], 0, sizeof(struct mmsghdr));
 
-    struct sockaddr addr;
-    socklen_t addr_size = sizeof(struct sockaddr);
+        msgs[i].msg_hdr.msg_iov    = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
 
     while(true)
     {
-        rc = recvfrom(socket, buffer, MESSAGE_SIZE, 0, &addr, &addr_size);
+        for (size_t i = 0; i < BATCH_SIZE; i++)
+        {
+            msgs[i].msg_hdr.msg_control    = &control[i * CONTROL_SIZE];
+            msgs[i].msg_hdr.msg_controllen = CONTROL_SIZE;
+        }
 
-        if (rc > 0 && rc < MESSAGE_SIZE)
+        int rc = recvmmsg(socket, &msgs[0], BATCH_SIZE, MSG_WAITFORONE, 0);
+
+        if (rc <= 0)
         {
-            std::string message(buffer, rc);
+            continue;
+        }
+
+        struct timespec now;
 
-            lock();
+        clock_gettime(CLOCK_REALTIME, &now);
 
-            monitor_data.push_back(message);
+        lock();
 
-            unlock();
+        for (int i = 0; i < rc; i++)
+        {
+            size_t size = msgs[i].msg_len;
+
+            struct timespec ts = now;
+
+            received++;
+
+            if ( size == 0 || (msgs[i].msg_hdr.msg_flags & MSG_TRUNC) )
+            {
+                dropped++;
+                continue;
+            }
+
+            struct msghdr * hdr = &(msgs[i].msg_hdr);
+
+            for (struct cmsghdr * cm = CMSG_FIRSTHDR(hdr); cm != 0;
+                    cm = CMSG_NXTHDR(hdr, cm))
+            {
+#ifdef SCM_TIMESTAMPNS
+                if (cm->cmsg_level == SOL_SOCKET &&
+                    cm->cmsg_type == SCM_TIMESTAMPNS)
+                {
+                    memcpy(&ts, CMSG_DATA(cm), sizeof(struct timespec));
+                }
+#endif
+            }
+
+            add_message(static_cast<const char *>(iovs[i].iov_base), size,
+                    ts.tv_sec * 1000000000ULL + ts.tv_nsec);
         }
+
+        unlock();
     }
 }
 
@@ -90,13 +219,43 @@ extern "C" void * listener_main(void *arg)
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+ListenerPool::ListenerPool(int fd, const std::vector<int>& socks, size_t num)
+    :started(false), out_fd(fd), sockets(socks), received(0), coalesced(0),
+    dropped(0), queued(0)
+{
+    for (size_t i = 0; i < num; i++)
+    {
+        listeners.push_back(new ListenerThread(sockets[i % sockets.size()]));
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
 ListenerPool::~ListenerPool()
 {
-    std::vector<ListenerThread>::iterator it;
+    std::vector<ListenerThread *>::iterator it;
+    std::vector<int>::iterator              jt;
+
+    for(it = listeners.begin() ; started && it != listeners.end(); ++it)
+    {
+        pthread_cancel((*it)->thread_id());
+    }
 
     for(it = listeners.begin() ; it != listeners.end(); ++it)
     {
-        pthread_cancel((*it).thread_id());
+        if ( started )
+        {
+            pthread_join((*it)->thread_id(), 0);
+        }
+
+        delete *it;
+    }
+
+    listeners.clear();
+
+    for(jt = sockets.begin() ; jt != sockets.end(); ++jt)
+    {
+        close(*jt);
     }
 };
 
@@ -108,19 +267,22 @@ void ListenerPool::start_pool()
     pthread_attr_t attr;
     pthread_t id;
 
-    std::vector<ListenerThread>::iterator it;
+    std::vector<ListenerThread *>::iterator it;
 
+    // Listeners are joinable, they are joined and freed by the destructor
     pthread_attr_init(&attr);
-    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
 
     for(it = listeners.begin() ; it != listeners.end(); ++it)
     {
-        pthread_create(&id, &attr, listener_main, (void *)&(*it));
+        pthread_create(&id, &attr, listener_main, (void *)(*it));
 
-        (*it).thread_id(id);
+        (*it)->thread_id(id);
     }
 
     pthread_attr_destroy(&attr);
+
+    started = true;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -128,10 +290,40 @@ void ListenerPool::start_pool()
 
 void ListenerPool::flush_pool()
 {
-    std::vector<ListenerThread>::iterator it;
+    std::map<int, MonitorMessage> hosts;
+    std::vector<std::string>      others;
+
+    std::vector<ListenerThread *>::iterator it;
+    std::map<int, MonitorMessage>::iterator ht;
+    std::vector<std::string>::iterator      ot;
 
     for(it = listeners.begin() ; it != listeners.end(); ++it)
     {
-        (*it).flush_buffer(out_fd);
+        (*it)->flush_buffer(hosts, others, received, coalesced, dropped);
+    }
+
+    for(ht = hosts.begin() ; ht != hosts.end(); ++ht)
+    {
+        write(out_fd, ht->second.data.c_str(), ht->second.data.size());
+    }
+
+    for(ot = others.begin() ; ot != others.end(); ++ot)
+    {
+        write(out_fd, (*ot).c_str(), (*ot).size());
     }
+
+    queued = hosts.size() + others.size();
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+void ListenerPool::stats(std::ostringstream& oss)
+{
+    oss << "received: "  << received  << ", coalesced: " << coalesced
+        << ", dropped: " << dropped   << ", last flush: " << queued;
+
+    received  = 0;
+    coalesced = 0;
+    dropped   = 0;
 }
@@ -16,17 +16,28 @@
 
 #include <string>
 #include <vector>
+#include <map>
 
 #include <pthread.h>
 
+/**
+ *  Monitor message received from a host, with its arrival time (ns)
+ */
+struct MonitorMessage
+{
+    unsigned long long time;
+
+    std::string        data;
+};
+
 /**
  *  This class implements a listener thread for the IM collector. It receives
- *  messages from a UDP port and stores it in a BUFFER. The class is controlled
- *  by two parameters
- *    - BUFFER_SIZE the number of pre-allocated capacity to store monitor
- *      messages. It should be roughly equal to the number of hosts per thread
- *    - MESSAGE_SIZE the size of each monitor message (100K by default). Each VM
- *      needs ~100bytes so ~1000VMs per host
+ *  messages from a UDP port and stores the latest one of each host in a
+ *  BUFFER. The class is controlled by two parameters
+ *    - BATCH_SIZE the number of messages read from the socket on each system
+ *      call (recvmmsg)
+ *    - MESSAGE_SIZE the size of each monitor message (64K, the maximum UDP
+ *      payload). Each VM needs ~100bytes so ~600VMs per host
  */
 class ListenerThread
 {
@@ -34,11 +45,10 @@ public:
     /**
      *  @param _socket descriptor to listen for messages
      */
-    ListenerThread(int _socket):socket(_socket)
+    ListenerThread(int _socket):socket(_socket), received(0), coalesced(0),
+        dropped(0)
     {
         pthread_mutex_init(&mutex,0);
-
-        monitor_data.reserve(BUFFER_SIZE);
     };
 
     ~ListenerThread()
@@ -47,11 +57,17 @@ public:
     };
 
     /**
-     *  Write the contents of the message buffer to a descriptor. Buffer is
-     *  cleared
-     *    @param fd file descriptor to send monitor data.
+     *  Moves the contents of the message buffer to the given containers.
+     *  Buffer is cleared
+     *    @param hosts latest message of each host, older messages are replaced
+     *    @param others messages without a host ID, forwarded as they are
+     *    @param _received number of messages received since last flush
+     *    @param _coalesced number of messages replaced by a newer one
+     *    @param _dropped number of messages discarded (e.g. truncated)
      */
-    void flush_buffer(int fd);
+    void flush_buffer(std::map<int, MonitorMessage>& hosts,
+        std::vector<std::string>& others, unsigned long long& _received,
+        unsigned long long& _coalesced, unsigned long long& _dropped);
 
     /**
      *  Waits for UDP messages in a loop and store them in a buffer
@@ -76,15 +92,21 @@ public:
 
 private:
     static const size_t MESSAGE_SIZE; /**< Monitor message size */
-    static const size_t BUFFER_SIZE;  /**< Pre-allocated capacoty */
+    static const size_t BATCH_SIZE;   /**< Messages read per system call */
 
     pthread_mutex_t mutex;
     pthread_t       _thread_id;
 
-    std::vector<std::string> monitor_data;
+    std::map<int, MonitorMessage> host_data;
+
+    std::vector<std::string> other_data;
 
     int socket;
 
+    unsigned long long received;
+    unsigned long long coalesced;
+    unsigned long long dropped;
+
     void lock()
     {
         pthread_mutex_lock(&mutex);
@@ -94,6 +116,12 @@ private:
     {
         pthread_mutex_unlock(&mutex);
     }
+
+    /**
+     *  Stores a message in the buffer, replacing any previous message from
+     *  the same host. Must be called with the mutex locked.
+     */
+    void add_message(const char * msg, size_t size, unsigned long long time);
 };
 
 /* -------------------------------------------------------------------------- */
@@ -106,18 +134,18 @@ extern "C" void * listener_main(void *arg);
 
 /**
  *  Represents a pool of listener threads, it should be periodically flushed to
- *  a file descriptor
+ *  a file descriptor. Only the latest message of each host is sent.
  */
 class ListenerPool
 {
 public:
     /**
      *  @param fd descriptor to flush the data
-     *  @param sock socket for the UDP connections
+     *  @param socks sockets for the UDP connections, bound to the same port
+     *  (SO_REUSEPORT). They are assigned to the threads in a round-robin way
      *  @param num number of threads in the pool
      */
-    ListenerPool(int fd, int sock, size_t num)
-        :listeners(num, ListenerThread(sock)), out_fd(fd), socket(sock){};
+    ListenerPool(int fd, const std::vector<int>& socks, size_t num);
 
     ~ListenerPool();
 
@@ -125,9 +153,26 @@ public:
 
     void flush_pool();
 
+    /**
+     *  Prints the counters of the pool and resets them
+     *    @param oss stream to print the counters
+     */
+    void stats(std::ostringstream& oss);
+
 private:
-    std::vector<ListenerThread> listeners;
+    std::vector<ListenerThread *> listeners;
+
+    /**
+     *  True if the listener threads have been started
+     */
+    bool started;
 
     int out_fd;
-    int socket;
+
+    std::vector<int> sockets;
+
+    unsigned long long received;
+    unsigned long long coalesced;
+    unsigned long long dropped;
+    unsigned long long queued;
 };
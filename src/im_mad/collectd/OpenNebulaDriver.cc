@@ -25,6 +25,8 @@
 #include <errno.h>
 #include <string.h>
 
+#include <vector>
+
 #include "OpenNebulaDriver.h"
 #include "ListenerThread.h"
 
@@ -114,7 +116,7 @@ void OpenNebulaDriver::driver_loop()
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-int IMCollectorDriver::init_collector()
+int IMCollectorDriver::init_socket()
 {
     struct sockaddr_in im_server;
     int rc;
@@ -127,6 +129,23 @@ int IMCollectorDriver::init_collector()
         return -1;
     }
 
+#ifdef SO_REUSEPORT
+    int on = 1;
+
+    if (setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) < 0)
+    {
+        std::cerr << strerror(errno);
+        close(sock);
+        return -1;
+    }
+#endif
+
+#ifdef SO_TIMESTAMPNS
+    int ts_on = 1;
+
+    setsockopt(sock, SOL_SOCKET, SO_TIMESTAMPNS, &ts_on, sizeof(ts_on));
+#endif
+
     im_server.sin_family = AF_INET;
     im_server.sin_port   = htons(_port);
 
@@ -137,6 +156,7 @@ int IMCollectorDriver::init_collector()
     else if (inet_pton(AF_INET,_address.c_str(),&im_server.sin_addr.s_addr) < 0)
     {
         std::cerr << strerror(errno);
+        close(sock);
         return -1;
     }
 
@@ -145,10 +165,45 @@ int IMCollectorDriver::init_collector()
     if ( rc < 0 )
     {
         std::cerr << strerror(errno);
+        close(sock);
         return -1;
     }
 
-    pool = new ListenerPool(1, sock, _threads);
+    return sock;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int IMCollectorDriver::init_collector()
+{
+    std::vector<int> socks;
+
+    int num_socks = 1;
+
+#ifdef SO_REUSEPORT
+    // One socket per listener, the kernel balances the datagrams among them
+    num_socks = _threads;
+#endif
+
+    for (int i = 0; i < num_socks; i++)
+    {
+        int sock = init_socket();
+
+        if ( sock < 0 )
+        {
+            for (std::vector<int>::iterator it = socks.begin();
+                    it != socks.end(); ++it)
+            {
+                close(*it);
+            }
+
+            return -1;
+        }
+
+        socks.push_back(sock);
+    }
+
+    pool = new ListenerPool(1, socks, _threads);
 
     return 0;
 }
@@ -191,10 +246,29 @@ extern "C" void * flush_thread(void *arg)
 
 void IMCollectorDriver::flush_loop()
 {
+    int mark = 0;
+
     while(true)
     {
         sleep(_flush_period);
 
         pool->flush_pool();
+
+        mark = mark + _flush_period;
+
+        if ( mark >= 600 )
+        {
+            std::ostringstream oss;
+
+            oss << "LOG I -1 collectd ";
+
+            pool->stats(oss);
+
+            oss << "\n";
+
+            write2one(oss.str());
+
+            mark = 0;
+        }
     }
 };
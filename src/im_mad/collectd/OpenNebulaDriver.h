@@ -94,6 +94,12 @@ public:
 private:
     void driver_action(const std::string& action, std::istringstream &is){};
 
+    /**
+     *  Creates an UDP socket bound to the collector address and port
+     *    @return the socket descriptor or -1 on error
+     */
+    int init_socket();
+
     std::string _address;
 
     int _port;
@@ -0,0 +1,61 @@
+#!/bin/sh
+
+# -------------------------------------------------------------------------- #
+# Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                #
+#                                                                            #
+# Licensed under the Apache License, Version 2.0 (the "License"); you may    #
+# not use this file except in compliance with the License. You may obtain    #
+# a copy of the License at                                                   #
+#                                                                            #
+# http://www.apache.org/licenses/LICENSE-2.0                                 #
+#                                                                            #
+# Unless required by applicable law or agreed to in writing, software        #
+# distributed under the License is distributed on an "AS IS" BASIS,          #
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   #
+# See the License for the specific language governing permissions and        #
+# limitations under the License.                                             #
+#--------------------------------------------------------------------------- #
+
+# Reports the NUMA nodes of the host, with their CPUs and memory (in KB):
+#   NUMA_NODE = [ NODE_ID = "0", CPUS = "0,1,2,3", TOTAL_MEMORY = "16318784",
+#                 FREE_MEMORY = "12318784" ]
+# and the hugepage pools of each node (SIZE in KB):
+#   HUGEPAGE = [ NODE_ID = "0", SIZE = "2048", PAGES = "1024", FREE = "512" ]
+
+NODES_PATH=/sys/devices/system/node
+
+[ -d "$NODES_PATH" ] || exit 0
+
+for NODE in $NODES_PATH/node[0-9]*; do
+    NODE_ID=${NODE##*/node}
+
+    CPUS=$(awk -F, '{
+        for (i = 1; i <= NF; i++) {
+            n = split($i, r, "-");
+            last = (n == 2) ? r[2] : r[1];
+            for (c = r[1]; c <= last; c++) {
+                printf("%s%d", sep, c);
+                sep = ",";
+            }
+        }
+    }' $NODE/cpulist)
+
+    TOTAL_MEMORY=$(awk '/MemTotal:/ { print $4 }' $NODE/meminfo)
+    FREE_MEMORY=$(awk '/MemFree:/ { print $4 }' $NODE/meminfo)
+
+    echo "NUMA_NODE = [ NODE_ID = \"$NODE_ID\", CPUS = \"$CPUS\"," \
+         "TOTAL_MEMORY = \"$TOTAL_MEMORY\", FREE_MEMORY = \"$FREE_MEMORY\" ]"
+
+    for HP in $NODE/hugepages/hugepages-*kB; do
+        [ -d "$HP" ] || continue
+
+        SIZE=${HP##*/hugepages-}
+        SIZE=${SIZE%kB}
+
+        PAGES=$(cat $HP/nr_hugepages)
+        FREE=$(cat $HP/free_hugepages)
+
+        echo "HUGEPAGE = [ NODE_ID = \"$NODE_ID\", SIZE = \"$SIZE\"," \
+             "PAGES = \"$PAGES\", FREE = \"$FREE\" ]"
+    done
+done
@@ -87,12 +87,17 @@ Image::~Image()
 const char * Image::table = "image_pool";
 
 const char * Image::db_names =
-        "oid, name, body, uid, gid, owner_u, group_u, other_u";
+        "oid, name, body, uid, gid, owner_u, group_u, other_u, short_body";
 
 const char * Image::db_bootstrap = "CREATE TABLE IF NOT EXISTS image_pool ("
     "oid INTEGER PRIMARY KEY, name VARCHAR(128), body MEDIUMTEXT, uid INTEGER, "
     "gid INTEGER, owner_u INTEGER, group_u INTEGER, other_u INTEGER, "
-    "UNIQUE(name,uid) )";
+    "short_body MEDIUMTEXT, UNIQUE(name,uid) )";
+
+const SqlIndex Image::db_indexes[] = {
+    {"image_pool_uid_idx",  "image_pool", "uid"},
+    {"image_pool_gid_idx",  "image_pool", "gid"},
+    {0, 0, 0}};
 
 /* ------------------------------------------------------------------------ */
 /* ------------------------------------------------------------------------ */
@@ -245,9 +250,11 @@ int Image::insert_replace(SqlDB *db, bool replace, string& error_str)
     int    rc;
 
     string xml_body;
+    string xml_short;
 
     char * sql_name;
     char * sql_xml;
+    char * sql_short;
 
     // Update the Image
 
@@ -270,6 +277,13 @@ int Image::insert_replace(SqlDB *db, bool replace, string& error_str)
         goto error_xml;
     }
 
+    sql_short = db->escape_str(to_xml_short(xml_short).c_str());
+
+    if ( sql_short == 0 )
+    {
+        goto error_short;
+    }
+
     if(replace)
     {
         oss << "REPLACE";
@@ -289,12 +303,14 @@ int Image::insert_replace(SqlDB *db, bool replace, string& error_str)
         <<          gid             << ","
         <<          owner_u         << ","
         <<          group_u         << ","
-        <<          other_u         << ")";
+        <<          other_u         << ","
+        << "'" <<   sql_short       << "')";
 
     rc = db->exec_wr(oss);
 
     db->free_str(sql_name);
     db->free_str(sql_xml);
+    db->free_str(sql_short);
 
     return rc;
 
@@ -306,6 +322,9 @@ error_xml:
 
     goto error_common;
 
+error_short:
+    db->free_str(sql_xml);
+
 error_body:
     db->free_str(sql_name);
     goto error_generic;
@@ -372,6 +391,39 @@ string& Image::to_xml(string& xml) const
 /* ------------------------------------------------------------------------ */
 /* ------------------------------------------------------------------------ */
 
+string& Image::to_xml_short(string& xml) const
+{
+    string        perms_xml;
+    ostringstream oss;
+
+    oss <<
+        "<IMAGE>" <<
+            "<ID>"             << oid             << "</ID>"          <<
+            "<UID>"            << uid             << "</UID>"         <<
+            "<GID>"            << gid             << "</GID>"         <<
+            "<UNAME>"          << uname           << "</UNAME>"       <<
+            "<GNAME>"          << gname           << "</GNAME>"       <<
+            "<NAME>"           << name            << "</NAME>"        <<
+            perms_to_xml(perms_xml)                                   <<
+            "<TYPE>"           << type            << "</TYPE>"        <<
+            "<DISK_TYPE>"      << disk_type       << "</DISK_TYPE>"   <<
+            "<PERSISTENT>"     << persistent_img  << "</PERSISTENT>"  <<
+            "<REGTIME>"        << regtime         << "</REGTIME>"     <<
+            "<SIZE>"           << size_mb         << "</SIZE>"        <<
+            "<STATE>"          << state           << "</STATE>"       <<
+            "<RUNNING_VMS>"    << running_vms     << "</RUNNING_VMS>" <<
+            "<DATASTORE_ID>"   << ds_id           << "</DATASTORE_ID>"<<
+            "<DATASTORE>"      << ds_name         << "</DATASTORE>"   <<
+        "</IMAGE>";
+
+    xml = oss.str();
+
+    return xml;
+}
+
+/* ------------------------------------------------------------------------ */
+/* ------------------------------------------------------------------------ */
+
 int Image::from_xml(const string& xml)
 {
     vector<xmlNodePtr> content;
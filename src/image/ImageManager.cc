@@ -68,6 +68,12 @@ int ImageManager::load_mads(int uid)
 
     VectorAttribute image_conf("IMAGE_MAD",vattr->value());
 
+    unsigned int concurrency = 0;
+
+    vattr->vector_value("MONITOR_CONCURRENCY", concurrency);
+
+    ds_monitor.set_limits(concurrency, monitor_period);
+
     image_conf.replace("NAME",image_driver_name);
 
     imagem_mad= new ImageManagerDriver(0,image_conf.value(),false,ipool,dspool);
@@ -139,8 +145,10 @@ void ImageManager::timer_action(const ActionRequest& ar)
     vector<int>           datastores;
     vector<int>::iterator it;
 
+    map<string, vector<int> >           backends;
+    map<string, vector<int> >::iterator bt;
+
     Nebula& nd             = Nebula::instance();
-    DatastorePool * dspool = nd.get_dspool();
     RaftManager * raftm    = nd.get_raftm();
 
     if ( !raftm->is_leader() && !raftm->is_solo() )
@@ -155,19 +163,80 @@ void ImageManager::timer_action(const ActionRequest& ar)
         return;
     }
 
+    // Datastores using the same backend are monitored once
     for(it = datastores.begin() ; it != datastores.end(); it++)
     {
-        monitor_datastore(*it);
+        Datastore * ds = dspool->get(*it, true);
+
+        if ( ds == 0 )
+        {
+            continue;
+        }
+
+        string key = ds->get_backend_key();
+
+        ds->unlock();
+
+        if ( key.empty() )
+        {
+            ds_monitor.push(*it, vector<int>());
+        }
+        else
+        {
+            backends[key].push_back(*it);
+        }
     }
 
+    for (bt = backends.begin(); bt != backends.end(); ++bt)
+    {
+        int leader = bt->second.front();
+
+        bt->second.erase(bt->second.begin());
+
+        ds_monitor.push(leader, bt->second);
+    }
+
+    dispatch_monitor();
+
     return;
 }
 
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+void ImageManager::dispatch_monitor()
+{
+    vector<int> ids;
+    vector<int> group;
+
+    vector<int>::iterator it;
+
+    bool sent;
+
+    do
+    {
+        ids.clear();
+
+        ds_monitor.pop(ids);
+
+        sent = true;
+
+        for (it = ids.begin(); it != ids.end(); ++it)
+        {
+            if ( monitor_datastore(*it) != 0 )
+            {
+                ds_monitor.done(*it, group);
+
+                sent = false;
+            }
+        }
+    } while (!sent);
+}
 
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-void ImageManager::monitor_datastore(int ds_id)
+int ImageManager::monitor_datastore(int ds_id)
 {
     string  ds_data, ds_location, ds_name;
     string* drv_msg;
@@ -188,14 +257,14 @@ void ImageManager::monitor_datastore(int ds_id)
         oss << "Error getting ImageManagerDriver";
 
         NebulaLog::log("InM", Log::ERROR, oss);
-        return;
+        return -1;
     }
 
     Datastore * ds = dspool->get(ds_id, true);
 
     if ( ds == 0 )
     {
-        return;
+        return -1;
     }
 
     ds->to_xml(ds_data);
@@ -213,7 +282,7 @@ void ImageManager::monitor_datastore(int ds_id)
         case Datastore::SYSTEM_DS:
             if ( !shared )
             {
-                return;
+                return -1;
             }
 
             nd.get_ds_location(ds_location);
@@ -240,4 +309,6 @@ void ImageManager::monitor_datastore(int ds_id)
     imd->monitor(ds_id, *drv_msg);
 
     delete drv_msg;
+
+    return 0;
 }
@@ -611,6 +611,11 @@ static void monitor_action(istringstream& is,
 
     ostringstream oss;
 
+    vector<int> group;
+    vector<int>::iterator gt;
+
+    Nebula::instance().get_imagem()->monitor_done(id, group);
+
     getline (is, dsinfo64);
 
     if (is.fail())
@@ -684,12 +689,31 @@ static void monitor_action(istringstream& is,
 
     ds_name = ds->get_name();
 
-    ds->update_monitor(total, free, used);
-
-    dspool->update(ds);
+    if ( ds->update_monitor(total, free, used) )
+    {
+        dspool->update(ds);
+    }
 
     ds->unlock();
 
+    // Datastores sharing the backend with this one
+    for ( gt = group.begin(); gt != group.end(); ++gt )
+    {
+        ds = dspool->get(*gt, true);
+
+        if ( ds == 0 )
+        {
+            continue;
+        }
+
+        if ( ds->update_monitor(total, free, used) )
+        {
+            dspool->update(ds);
+        }
+
+        ds->unlock();
+    }
+
     vector<VectorAttribute *> vm_disk_info;
     vector<VectorAttribute *>::iterator it;
 
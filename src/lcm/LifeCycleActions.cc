@@ -37,8 +37,8 @@ void  LifeCycleManager::deploy_action(const LCMAction& la)
     if ( vm->get_state() == VirtualMachine::ACTIVE )
     {
         time_t thetime = time(0);
-        int    cpu, mem, disk, rc;
-        vector<VectorAttribute *> pci;
+        int    rc;
+        HostShareCapacity sr;
 
         VirtualMachine::LcmState vm_state;
         TMAction::Actions tm_action;
@@ -47,7 +47,7 @@ void  LifeCycleManager::deploy_action(const LCMAction& la)
         //                 PROLOG STATE
         //----------------------------------------------------
 
-        vm->get_requirements(cpu, mem, disk, pci);
+        vm->get_capacity(sr);
 
         vm_state  = VirtualMachine::PROLOG;
         tm_action = TMAction::PROLOG;
@@ -69,7 +69,7 @@ void  LifeCycleManager::deploy_action(const LCMAction& la)
 
         vm->set_state(vm_state);
 
-        rc = hpool->add_capacity(vm->get_hid(),vm->get_oid(),cpu,mem,disk,pci);
+        rc = hpool->add_capacity(vm->get_hid(), sr);
 
         vm->set_stime(thetime);
 
@@ -81,7 +81,8 @@ void  LifeCycleManager::deploy_action(const LCMAction& la)
 
         if ( rc == -1)
         {
-            //The host has been deleted, move VM to FAILURE
+            //The host has been deleted or the VM NUMA nodes do not fit in it,
+            //move VM to FAILURE
             this->trigger(LCMAction::PROLOG_FAILURE, vid);
         }
         else
@@ -214,11 +215,12 @@ void  LifeCycleManager::stop_action(const LCMAction& la)
 
 void  LifeCycleManager::migrate_action(const LCMAction& la)
 {
-    int    cpu, mem, disk;
-    vector<VectorAttribute *> pci;
+    HostShareCapacity sr;
 
     time_t the_time = time(0);
 
+    int rc;
+
     int vid = la.vm_id();
 
     VirtualMachine * vm = vmpool->get(vid, true);
@@ -239,9 +241,11 @@ void  LifeCycleManager::migrate_action(const LCMAction& la)
 
         vm->set_resched(false);
 
-        vm->get_requirements(cpu, mem, disk, pci);
+        vm->save_numa_pinning();
+
+        vm->get_capacity(sr);
 
-        hpool->add_capacity(vm->get_hid(), vm->get_oid(), cpu, mem, disk, pci);
+        rc = hpool->add_capacity(vm->get_hid(), sr);
 
         vm->set_stime(the_time);
 
@@ -258,7 +262,15 @@ void  LifeCycleManager::migrate_action(const LCMAction& la)
 
         //----------------------------------------------------
 
-        vmm->trigger(VMMAction::SAVE,vid);
+        if ( rc == -1 )
+        {
+            //The VM keeps running in the previous host
+            trigger(LCMAction::SAVE_FAILURE, vid);
+        }
+        else
+        {
+            vmm->trigger(VMMAction::SAVE,vid);
+        }
     }
     else if (vm->get_state() == VirtualMachine::POWEROFF ||
              vm->get_state() == VirtualMachine::SUSPENDED ||
@@ -308,12 +320,11 @@ void  LifeCycleManager::migrate_action(const LCMAction& la)
 
         vm->reset_info();
 
-        vm->get_requirements(cpu, mem, disk, pci);
+        vm->get_capacity(sr);
 
-        hpool->add_capacity(vm->get_hid(), vm->get_oid(), cpu, mem, disk, pci);
+        rc = hpool->add_capacity(vm->get_hid(), sr);
 
-        hpool->del_capacity(vm->get_previous_hid(), vm->get_oid(), cpu, mem,
-            disk, pci);
+        hpool->del_capacity(vm->get_previous_hid(), sr);
 
         vm->set_stime(the_time);
 
@@ -325,7 +336,14 @@ void  LifeCycleManager::migrate_action(const LCMAction& la)
 
         //----------------------------------------------------
 
-        tm->trigger(TMAction::PROLOG_MIGR,vid);
+        if ( rc == -1 )
+        {
+            trigger(LCMAction::PROLOG_FAILURE, vid);
+        }
+        else
+        {
+            tm->trigger(TMAction::PROLOG_MIGR,vid);
+        }
     }
     else
     {
@@ -356,8 +374,9 @@ void  LifeCycleManager::live_migrate_action(const LCMAction& la)
     if (vm->get_state()     == VirtualMachine::ACTIVE &&
         vm->get_lcm_state() == VirtualMachine::RUNNING)
     {
-        int cpu, mem, disk;
-        vector<VectorAttribute *> pci;
+        HostShareCapacity sr;
+
+        int rc;
 
         //----------------------------------------------------
         //                   MIGRATE STATE
@@ -367,9 +386,11 @@ void  LifeCycleManager::live_migrate_action(const LCMAction& la)
 
         vm->set_resched(false);
 
-        vm->get_requirements(cpu, mem, disk, pci);
+        vm->save_numa_pinning();
+
+        vm->get_capacity(sr);
 
-        hpool->add_capacity(vm->get_hid(), vm->get_oid(), cpu, mem, disk, pci);
+        rc = hpool->add_capacity(vm->get_hid(), sr);
 
         vm->set_stime(time(0));
 
@@ -387,7 +408,22 @@ void  LifeCycleManager::live_migrate_action(const LCMAction& la)
 
         //----------------------------------------------------
 
-        vmm->trigger(VMMAction::MIGRATE,vid);
+        if ( rc == -1 )
+        {
+            //The VM keeps running in the previous host
+            trigger(LCMAction::DEPLOY_FAILURE, vid);
+        }
+        else
+        {
+            if ( !sr.nodes.empty() )
+            {
+                vm->log("LCM", Log::WARNING, "Live migration keeps the NUMA "
+                    "pinning of the previous host, the new pinning will be "
+                    "applied when the VM is deployed again.");
+            }
+
+            vmm->trigger(VMMAction::MIGRATE,vid);
+        }
     }
     else
     {
@@ -918,10 +954,9 @@ void LifeCycleManager::delete_recreate_action(const LCMAction& la)
 void LifeCycleManager::clean_up_vm(VirtualMachine * vm, bool dispose,
         int& image_id, const LCMAction& la)
 {
-    int cpu, mem, disk;
     unsigned int port;
 
-    vector<VectorAttribute *> pci;
+    HostShareCapacity sr;
     time_t the_time = time(0);
 
     VirtualMachine::LcmState state = vm->get_lcm_state();
@@ -951,9 +986,9 @@ void LifeCycleManager::clean_up_vm(VirtualMachine * vm, bool dispose,
     vm->set_etime(the_time);
     vm->set_vm_info();
 
-    vm->get_requirements(cpu, mem, disk, pci);
+    vm->get_capacity(sr);
 
-    hpool->del_capacity(vm->get_hid(), vm->get_oid(), cpu, mem, disk, pci);
+    hpool->del_capacity(vm->get_hid(), sr);
 
     const VectorAttribute * graphics = vm->get_template_attribute("GRAPHICS");
 
@@ -1090,8 +1125,7 @@ void LifeCycleManager::clean_up_vm(VirtualMachine * vm, bool dispose,
             vm->set_previous_vm_info();
             vm->set_previous_running_etime(the_time);
 
-            hpool->del_capacity(vm->get_previous_hid(), vm->get_oid(), cpu,
-                    mem, disk, pci);
+            hpool->del_capacity(vm->get_previous_hid(), sr);
 
             vmpool->update_previous_history(vm);
 
@@ -1114,8 +1148,7 @@ void LifeCycleManager::clean_up_vm(VirtualMachine * vm, bool dispose,
             vm->set_previous_vm_info();
             vm->set_previous_running_etime(the_time);
 
-            hpool->del_capacity(vm->get_previous_hid(), vm->get_oid(), cpu,
-                    mem, disk, pci);
+            hpool->del_capacity(vm->get_previous_hid(), sr);
 
             vmpool->update_previous_history(vm);
 
@@ -37,8 +37,7 @@ void  LifeCycleManager::save_success_action(int vid)
 
     if ( vm->get_lcm_state() == VirtualMachine::SAVE_MIGRATE )
     {
-        int    cpu, mem, disk;
-        vector<VectorAttribute *> pci;
+        HostShareCapacity sr;
 
         time_t the_time = time(0);
 
@@ -55,6 +54,8 @@ void  LifeCycleManager::save_success_action(int vid)
 
         vm->reset_info();
 
+        vm->clear_numa_pinning(false);
+
         vm->set_previous_etime(the_time);
 
         vm->set_previous_vm_info();
@@ -69,9 +70,9 @@ void  LifeCycleManager::save_success_action(int vid)
 
         vmpool->update(vm);
 
-        vm->get_requirements(cpu, mem, disk, pci);
+        vm->get_capacity(sr);
 
-        hpool->del_capacity(vm->get_previous_hid(),vm->get_oid(),cpu,mem,disk,pci);
+        hpool->del_capacity(vm->get_previous_hid(), sr);
 
         //----------------------------------------------------
 
@@ -159,8 +160,7 @@ void  LifeCycleManager::save_failure_action(int vid)
 
     if ( vm->get_lcm_state() == VirtualMachine::SAVE_MIGRATE )
     {
-        int    cpu, mem, disk;
-        vector<VectorAttribute *> pci;
+        HostShareCapacity sr;
 
         time_t the_time = time(0);
 
@@ -176,9 +176,11 @@ void  LifeCycleManager::save_failure_action(int vid)
 
         vmpool->update_history(vm);
 
-        vm->get_requirements(cpu, mem, disk, pci);
+        vm->get_capacity(sr);
+
+        hpool->del_capacity(vm->get_hid(), sr);
 
-        hpool->del_capacity(vm->get_hid(), vm->get_oid(), cpu, mem, disk, pci);
+        vm->clear_numa_pinning(true);
 
         vm->set_previous_etime(the_time);
 
@@ -259,8 +261,7 @@ void  LifeCycleManager::deploy_success_action(int vid)
 
     if ( vm->get_lcm_state() == VirtualMachine::MIGRATE )
     {
-        int    cpu,mem,disk;
-        vector<VectorAttribute *> pci;
+        HostShareCapacity sr;
 
         time_t the_time = time(0);
 
@@ -278,9 +279,11 @@ void  LifeCycleManager::deploy_success_action(int vid)
 
         vmpool->update_previous_history(vm);
 
-        vm->get_requirements(cpu, mem, disk, pci);
+        vm->get_capacity(sr);
 
-        hpool->del_capacity(vm->get_previous_hid(),vm->get_oid(),cpu,mem,disk,pci);
+        hpool->del_capacity(vm->get_previous_hid(), sr);
+
+        vm->clear_numa_pinning(false);
 
         vm->set_state(VirtualMachine::RUNNING);
 
@@ -338,8 +341,7 @@ void  LifeCycleManager::deploy_failure_action(int vid)
 
     if ( vm->get_lcm_state() == VirtualMachine::MIGRATE )
     {
-        int    cpu, mem, disk;
-        vector<VectorAttribute *> pci;
+        HostShareCapacity sr;
 
         time_t the_time = time(0);
 
@@ -363,9 +365,11 @@ void  LifeCycleManager::deploy_failure_action(int vid)
 
         vmpool->update_previous_history(vm);
 
-        vm->get_requirements(cpu, mem, disk, pci);
+        vm->get_capacity(sr);
+
+        hpool->del_capacity(vm->get_hid(), sr);
 
-        hpool->del_capacity(vm->get_hid(), vm->get_oid(), cpu, mem, disk, pci);
+        vm->clear_numa_pinning(true);
 
         // --- Add new record by copying the previous one
 
@@ -733,8 +737,7 @@ void LifeCycleManager::prolog_success_action(int vid)
 
 void  LifeCycleManager::prolog_failure_action(int vid)
 {
-    int cpu, mem, disk;
-    vector<VectorAttribute *> pci;
+    HostShareCapacity sr;
 
     time_t t = time(0);
 
@@ -814,9 +817,9 @@ void  LifeCycleManager::prolog_failure_action(int vid)
                     break;
             }
 
-            vm->get_requirements(cpu, mem, disk, pci);
+            vm->get_capacity(sr);
 
-            hpool->del_capacity(vm->get_hid(), vm->get_oid(), cpu,mem,disk,pci);
+            hpool->del_capacity(vm->get_hid(), sr);
 
             // Clone previous history record into a new one
             vm->cp_previous_history();
@@ -825,7 +828,7 @@ void  LifeCycleManager::prolog_failure_action(int vid)
             vm->set_prolog_stime(t);
             vm->set_last_poll(0);
 
-            hpool->add_capacity(vm->get_hid(),vm->get_oid(),cpu,mem,disk,pci);
+            hpool->add_capacity(vm->get_hid(), sr);
 
             vmpool->update_history(vm);
 
@@ -855,10 +858,9 @@ void  LifeCycleManager::prolog_failure_action(int vid)
 void  LifeCycleManager::epilog_success_action(int vid)
 {
     VirtualMachine *    vm;
-    vector<VectorAttribute *> pci;
+    HostShareCapacity sr;
 
     time_t the_time = time(0);
-    int    cpu,mem,disk;
     unsigned int port;
 
     VirtualMachine::LcmState state;
@@ -929,9 +931,9 @@ void  LifeCycleManager::epilog_success_action(int vid)
 
     vmpool->update(vm);
 
-    vm->get_requirements(cpu, mem, disk, pci);
+    vm->get_capacity(sr);
 
-    hpool->del_capacity(vm->get_hid(), vm->get_oid(), cpu, mem, disk, pci);
+    hpool->del_capacity(vm->get_hid(), sr);
 
     const VectorAttribute * graphics = vm->get_template_attribute("GRAPHICS");
 
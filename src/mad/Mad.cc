@@ -25,12 +25,15 @@
 
 #include "Mad.h"
 #include "NebulaLog.h"
+#include "NebulaUtil.h"
 
 #include "Nebula.h"
 
 #include <cerrno>
 
 
+const size_t Mad::FRAME_ZLIB_SIZE = 262144;
+
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
@@ -40,6 +43,8 @@ Mad::~Mad()
     int     status;
     pid_t   rp;
 
+    pthread_mutex_destroy(&write_mutex);
+
     if ( pid==-1)
     {
         return;
@@ -226,6 +231,19 @@ int Mad::start()
             {
                 goto error_mad_result;
             }
+
+            istringstream is(info);
+            string        option;
+
+            framed = false;
+
+            while ( is >> option )
+            {
+                if ( option == "FRAMED" )
+                {
+                    framed = true;
+                }
+            }
         }
         else
         {
@@ -290,6 +308,8 @@ int Mad::reload()
     int     rc;
     pid_t   rp;
 
+    pthread_mutex_lock(&write_mutex);
+
     // Finish the driver
     ::write(nebula_mad_pipe, buf, strlen(buf));
 
@@ -308,9 +328,87 @@ int Mad::reload()
 
     rc = start();
 
+    pthread_mutex_unlock(&write_mutex);
+
     return rc;
 }
 
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+int Mad::write_pipe(const char * buffer, size_t size) const
+{
+    while ( size > 0 )
+    {
+        ssize_t rc = ::write(nebula_mad_pipe, buffer, size);
+
+        if ( rc == -1 )
+        {
+            if ( errno == EINTR )
+            {
+                continue;
+            }
+
+            return -1;
+        }
+
+        buffer += rc;
+        size   -= rc;
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+void Mad::write(ostringstream& os, const string& payload) const
+{
+    if ( !framed )
+    {
+        string * payload64 = one_util::base64_encode(payload);
+
+        os << " " << *payload64 << endl;
+
+        delete payload64;
+
+        write(os);
+
+        return;
+    }
+
+    const string * data  = &payload;
+    string *       zdata = 0;
+
+    os << " @";
+
+    if ( payload.size() >= FRAME_ZLIB_SIZE )
+    {
+        zdata = one_util::zlib_compress(payload, false);
+
+        if ( zdata != 0 )
+        {
+            data = zdata;
+
+            os << "z";
+        }
+    }
+
+    os << data->size() << "\n";
+
+    pthread_mutex_lock(&write_mutex);
+
+    frame_buffer.assign(os.str());
+    frame_buffer.append(*data);
+
+    write_pipe(frame_buffer.data(), frame_buffer.size());
+
+    if ( frame_buffer.capacity() > 4 * FRAME_ZLIB_SIZE )
+    {
+        string().swap(frame_buffer);
+    }
+
+    pthread_mutex_unlock(&write_mutex);
+
+    delete zdata;
+}
@@ -19,6 +19,7 @@ require "CommandManager"
 
 require "DriverExecHelper"
 require 'base64'
+require 'zlib'
 
 # This class provides basic messaging and logging functionality
 # to implement OpenNebula Drivers. A driver is a program that
@@ -48,13 +49,16 @@ class OpenNebulaDriver < ActionManager
     # @option options [Hash] :local_actions ({}) hash with the actions
     #   executed locally and the name of the script if it differs from the
     #   default one. This hash can be constructed using {parse_actions_list}
+    # @option options [Boolean] :framed (false) the driver accepts framed
+    #   payloads, that are received as is instead of base64 encoded
     def initialize(directory, options={})
         @options={
             :concurrency => 10,
             :threaded    => true,
             :retries     => 0,
             :local_actions => {},
-            :timeout     => nil
+            :timeout     => nil,
+            :framed      => false
         }.merge!(options)
 
         super(@options[:concurrency], @options[:threaded])
@@ -181,7 +185,28 @@ class OpenNebulaDriver < ActionManager
 private
 
     def init
-        send_message("INIT",RESULT[:success])
+        if @options[:framed]
+            send_message("INIT",RESULT[:success],"-","FRAMED")
+        else
+            send_message("INIT",RESULT[:success])
+        end
+    end
+
+    # Reads the payload of a framed message: "ACTION ID ... @[z]<length>"
+    # followed by <length> bytes, zlib compressed if the z flag is set
+    def read_frame(header)
+        m = header.match(/\A@(z?)(\d+)\z/)
+
+        return nil if !m
+
+        size    = m[2].to_i
+        payload = STDIN.read(size)
+
+        exit(-1) if payload.nil? || payload.bytesize != size
+
+        payload = Zlib::Inflate.inflate(payload) if m[1] == "z"
+
+        payload.force_encoding(Encoding::UTF_8)
     end
 
     def loop
@@ -194,6 +219,9 @@ private
             args   = str.split(/\s+/)
             next if args.length == 0
 
+            payload = read_frame(args.last)
+            args[-1] = payload if payload
+
             if args.first.empty?
                 STDERR.puts "Malformed message: #{str.inspect}"
                 next
@@ -98,17 +98,33 @@ class VirtualMachineDriver < OpenNebulaDriver
         register_action(ACTION[:update_sg].to_sym, method("update_sg"))
     end
 
-    # Decodes the encoded XML driver message received from the core
+    # Decodes the encoded XML driver message received from the core. Framed
+    # messages are received as plain XML
     #
     # @param [String] drv_message the driver message
     # @return [REXML::Element] the root element of the decoded XML message
     def decode(drv_message)
-        message = Base64.decode64(drv_message)
+        if drv_message.start_with?('<')
+            message = drv_message
+        else
+            message = Base64.decode64(drv_message)
+        end
+
         xml_doc = REXML::Document.new(message)
 
         xml_doc.root
     end
 
+    # Encodes the driver message in base64 to pass it to the action scripts
+    #
+    # @param [String] drv_message the driver message
+    # @return [String] the base64 encoded driver message
+    def encode(drv_message)
+        return drv_message if !drv_message.start_with?('<')
+
+        Base64.encode64(drv_message).delete("\n")
+    end
+
     # Execute a command associated to an action and id in a remote host.
     def remotes_action(command, id, host, action, remote_dir, std_in=nil)
         super(command,id,host,ACTION[action],remote_dir,std_in)
@@ -413,11 +413,17 @@ int MarketPlace::post_update_template(std::string& error)
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-void MarketPlace::update_monitor(const Template& data)
+bool MarketPlace::update_monitor(const Template& data)
 {
+    long long total = total_mb;
+    long long free  = free_mb;
+    long long used  = used_mb;
+
     data.get("TOTAL_MB", total_mb);
     data.get("FREE_MB",  free_mb);
     data.get("USED_MB",  used_mb);
+
+    return total != total_mb || free != free_mb || used != used_mb;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -94,6 +94,12 @@ int MarketPlaceManager::load_mads(int uid)
 
     VectorAttribute market_conf("MARKET_MAD", vattr->value());
 
+    unsigned int concurrency = 0;
+
+    vattr->vector_value("MONITOR_CONCURRENCY", concurrency);
+
+    mp_monitor.set_limits(concurrency, monitor_period);
+
     market_conf.replace("NAME", market_driver_name);
 
     marketm_mad= new MarketPlaceManagerDriver(0, market_conf.value(), false,
@@ -211,16 +217,50 @@ void MarketPlaceManager::timer_action(const ActionRequest& ar)
 
     for(it = markets.begin() ; it != markets.end(); it++)
     {
-        monitor_market(*it);
+        mp_monitor.push(*it, std::vector<int>());
     }
 
+    dispatch_monitor();
+
     return;
 }
 
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-void MarketPlaceManager::monitor_market(int mp_id)
+void MarketPlaceManager::dispatch_monitor()
+{
+    std::vector<int> ids;
+    std::vector<int> group;
+
+    std::vector<int>::iterator it;
+
+    bool sent;
+
+    do
+    {
+        ids.clear();
+
+        mp_monitor.pop(ids);
+
+        sent = true;
+
+        for (it = ids.begin(); it != ids.end(); ++it)
+        {
+            if ( monitor_market(*it) != 0 )
+            {
+                mp_monitor.done(*it, group);
+
+                sent = false;
+            }
+        }
+    } while (!sent);
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+int MarketPlaceManager::monitor_market(int mp_id)
 {
     std::string  mp_data;
     std::string  mp_name;
@@ -235,14 +275,14 @@ void MarketPlaceManager::monitor_market(int mp_id)
         oss << "Error getting MarketPlaceManagerDriver";
 
         NebulaLog::log("MKP", Log::ERROR, oss);
-        return;
+        return -1;
     }
 
     MarketPlace * mp = mppool->get(mp_id, true);
 
     if ( mp == 0 )
     {
-        return;
+        return -1;
     }
 
     mp_name = mp->get_name();
@@ -254,13 +294,13 @@ void MarketPlaceManager::monitor_market(int mp_id)
 
         mp->unlock();
 
-        return;
+        return -1;
     }
 
     if ( mp->get_zone_id() != Nebula::instance().get_zone_id() )
     {
         mp->unlock();
-        return;
+        return -1;
     }
 
     mp->to_xml(mp_data);
@@ -276,4 +316,6 @@ void MarketPlaceManager::monitor_market(int mp_id)
     mpmd->monitor(mp_id, *drv_msg);
 
     delete drv_msg;
+
+    return 0;
 }
@@ -70,6 +70,8 @@ static void monitor_action(
 
     std::ostringstream oss;
 
+    marketm->monitor_done(id);
+
     getline (is, info64);
 
     if (is.fail())
@@ -130,9 +132,10 @@ static void monitor_action(
 
     name    = market->get_name();
 
-    market->update_monitor(monitor_data);
-
-    marketpool->update(market);
+    if ( market->update_monitor(monitor_data) )
+    {
+        marketpool->update(market);
+    }
 
     market->unlock();
 
@@ -168,6 +168,8 @@ void Nebula::start(bool bootstrap_only)
     server_id          = -1;
     master_oned        = "";
 
+    unsigned int fed_window = 256;
+
     const VectorAttribute * vatt = nebula_configuration->get("FEDERATION");
 
     if (vatt != 0)
@@ -221,6 +223,11 @@ void Nebula::start(bool bootstrap_only)
             server_id = -1;
         }
 
+        if ( vatt->vector_value("REPLICA_WINDOW", fed_window) != 0 )
+        {
+            fed_window = 256;
+        }
+
     }
 
     vatt = nebula_configuration->get("RAFT");
@@ -301,6 +308,10 @@ void Nebula::start(bool bootstrap_only)
                     db_name = value;
                 }
             }
+
+            value = _db->vector_value("BODY_FORMAT");
+
+            PoolObjectSQL::set_binary_body(one_util::toupper(value) == "BINARY");
         }
 
         if ( db_is_sqlite )
@@ -423,6 +434,25 @@ void Nebula::start(bool bootstrap_only)
         {
             throw runtime_error("Error bootstrapping database.");
         }
+
+        // ---------------------------------------------------------------------
+        // Check the secondary indexes, DBs upgraded from previous versions or
+        // restored from a backup may not include them. Indexes are not
+        // replicated, so each server checks its own DB.
+        // ---------------------------------------------------------------------
+        NebulaLog::log("ONE",Log::INFO,"Checking database indexes.");
+
+        rc  = VirtualMachinePool::bootstrap_indexes(db_backend);
+        rc += HostPool::bootstrap_indexes(db_backend);
+        rc += VirtualNetworkPool::bootstrap_indexes(db_backend);
+        rc += ImagePool::bootstrap_indexes(db_backend);
+        rc += VMTemplatePool::bootstrap_indexes(db_backend);
+
+        if ( rc != 0 )
+        {
+            NebulaLog::log("ONE",Log::WARNING, "Could not create all database "
+                    "indexes, DB queries may be slower. Check oned.log.");
+        }
     }
     catch (exception&)
     {
@@ -481,9 +511,16 @@ void Nebula::start(bool bootstrap_only)
 
     time_t timer_period;
     time_t monitor_period;
+    int    manager_threads;
 
     nebula_configuration->get("MANAGER_TIMER", timer_period);
     nebula_configuration->get("MONITORING_INTERVAL", monitor_period);
+    nebula_configuration->get("MANAGER_THREADS", manager_threads);
+
+    if ( manager_threads < 1 )
+    {
+        manager_threads = 1;
+    }
 
     // ---- ACL Manager ----
     try
@@ -570,6 +607,13 @@ void Nebula::start(bool bootstrap_only)
         hpool  = new HostPool(logdb, host_hooks, hook_location, remotes_location,
             host_expiration);
 
+        // Followers get the bodies in the leader format through the log
+        if ( solo && hpool->migrate_bodies() != 0 )
+        {
+            NebulaLog::log("ONE", Log::WARNING, "Could not migrate all Host "
+                    "bodies to the configured DB body format");
+        }
+
         /* --------------------- VirtualRouter Pool ------------------------- */
         vector<const VectorAttribute *> vrouter_hooks;
 
@@ -743,7 +787,8 @@ void Nebula::start(bool bootstrap_only)
     // ---- FedReplica Manager ----
     try
     {
-        frm = new FedReplicaManager(timer_period,log_purge,logdb,log_retention);
+        frm = new FedReplicaManager(timer_period, log_purge, logdb,
+                log_retention, fed_window);
     }
     catch (bad_alloc&)
     {
@@ -786,7 +831,8 @@ void Nebula::start(bool bootstrap_only)
             poll_period,
             do_poll,
             vm_limit,
-            vmm_mads);
+            vmm_mads,
+            manager_threads);
     }
     catch (bad_alloc&)
     {
@@ -803,7 +849,7 @@ void Nebula::start(bool bootstrap_only)
     // ---- Life-cycle Manager ----
     try
     {
-        lcm = new LifeCycleManager();
+        lcm = new LifeCycleManager(manager_threads);
     }
     catch (bad_alloc&)
     {
@@ -859,7 +905,7 @@ void Nebula::start(bool bootstrap_only)
 
         nebula_configuration->get("TM_MAD", tm_mads);
 
-        tm = new TransferManager(vmpool, hpool, tm_mads);
+        tm = new TransferManager(vmpool, hpool, tm_mads, manager_threads);
     }
     catch (bad_alloc&)
     {
@@ -876,7 +922,7 @@ void Nebula::start(bool bootstrap_only)
     // ---- Dispatch Manager ----
     try
     {
-        dm = new DispatchManager();
+        dm = new DispatchManager(manager_threads);
     }
     catch (bad_alloc&)
     {
@@ -35,7 +35,9 @@ int NebulaTemplate::load_configuration()
     string      aname;
     Attribute * attr;
 
-    map<string, Attribute *>::iterator  iter, j, prev;
+    map<string, Attribute *>::iterator  iter, prev;
+
+    FlatMultiMap<string, Attribute *>::iterator j;
 
     set_conf_default();
 
@@ -368,6 +370,7 @@ void OpenNebulaTemplate::set_conf_default()
 # Daemon configuration attributes
 #-------------------------------------------------------------------------------
 #  MANAGER_TIMER
+#  MANAGER_THREADS
 #  MONITORING_INTERVAL
 #  MONITORING_THREADS
 #  HOST_PER_INTERVAL
@@ -384,6 +387,7 @@ void OpenNebulaTemplate::set_conf_default()
 #*******************************************************************************
 */
     set_conf_single("MANAGER_TIMER", "15");
+    set_conf_single("MANAGER_THREADS", "8");
     set_conf_single("MONITORING_INTERVAL", "60");
     set_conf_single("MONITORING_THREADS", "50");
     set_conf_single("HOST_PER_INTERVAL", "15");
@@ -427,6 +431,7 @@ void OpenNebulaTemplate::set_conf_default()
 #   ZONE_ID
 #   SERVER_ID
 #   MASTER_ONED
+#   REPLICA_WINDOW
 #
 #  RAFT
 #   LOG_RETENTION
@@ -442,6 +447,7 @@ void OpenNebulaTemplate::set_conf_default()
     vvalue.insert(make_pair("ZONE_ID","0"));
     vvalue.insert(make_pair("SERVER_ID","-1"));
     vvalue.insert(make_pair("MASTER_ONED",""));
+    vvalue.insert(make_pair("REPLICA_WINDOW","256"));
 
     vattribute = new VectorAttribute("FEDERATION",vvalue);
     conf_default.insert(make_pair(vattribute->name(),vattribute));
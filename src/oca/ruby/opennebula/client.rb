@@ -86,6 +86,10 @@ module OpenNebula
         attr_accessor :one_auth
         attr_reader   :one_endpoint
 
+        # Last log index returned by a write call. It is sent to the info
+        # calls, so followers of a HA cluster serve them after applying it.
+        attr_accessor :read_index
+
         begin
             require 'xmlparser'
             XMLPARSER=true
@@ -93,6 +97,12 @@ module OpenNebula
             XMLPARSER=false
         end
 
+        # Object and pool info methods, they accept a {READ_INDEX} struct as
+        # their last parameter
+        READ_INDEX_METHODS = /^(vm|template|host|group|vn|user|image|
+            datastore|cluster|document|zone|secgroup|vmgroup|vdc|vrouter|
+            market|marketapp)(pool)?\.info$/x
+
         # Creates a new client object that will be used to call OpenNebula
         # functions.
         #
@@ -188,6 +198,10 @@ module OpenNebula
         end
 
         def call(action, *args)
+            if @read_index && action.match(READ_INDEX_METHODS)
+                args << { "READ_INDEX" => @read_index }
+            end
+
             begin
                 if @async
                     response = @server.call_async("one."+action, @one_auth, *args)
@@ -198,6 +212,11 @@ module OpenNebula
                 if response[0] == false
                     Error.new(response[1], response[2])
                 else
+                    if response[3] && (@read_index.nil? ||
+                                       response[3] > @read_index)
+                        @read_index = response[3]
+                    end
+
                     response[1] #response[1..-1]
                 end
             rescue Exception => e
@@ -26,6 +26,7 @@ module OpenNebula
 
         HOST_POOL_METHODS = {
             :info       => "hostpool.info",
+            :summary    => "hostpool.summary",
             :monitoring => "hostpool.monitoring"
         }
 
@@ -55,6 +56,13 @@ module OpenNebula
 
         alias_method :info!, :info
 
+        # Retrieves a summary of the Hosts: ID, name, state, drivers, cluster
+        # and capacity. Host templates, VMs, datastores and PCI devices are
+        # not included.
+        def info_summary()
+            return xmlrpc_info(HOST_POOL_METHODS[:summary])
+        end
+
         # Retrieves the monitoring data for all the Hosts in the pool
         #
         # @param [Array<String>] xpath_expressions Elements to retrieve.
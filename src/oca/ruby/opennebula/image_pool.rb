@@ -24,7 +24,8 @@ module OpenNebula
         #######################################################################
 
         IMAGE_POOL_METHODS = {
-            :info => "imagepool.info"
+            :info    => "imagepool.info",
+            :summary => "imagepool.summary"
         }
 
         #######################################################################
@@ -70,6 +71,16 @@ module OpenNebula
             return super(IMAGE_POOL_METHODS[:info])
         end
 
+        # Retrieves a summary of the Images, without templates, snapshots
+        # and the VMs using them.
+        # [filter_flag, start_id, end_id]
+        def info_summary(filter_flag=INFO_ALL, start_id=-1, end_id=-1)
+            return info_filter(IMAGE_POOL_METHODS[:summary],
+                               filter_flag,
+                               start_id,
+                               end_id)
+        end
+
         alias_method :info!, :info
         alias_method :info_all!, :info_all
         alias_method :info_mine!, :info_mine
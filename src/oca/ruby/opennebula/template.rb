@@ -27,6 +27,7 @@ module OpenNebula
         TEMPLATE_METHODS = {
             :allocate    => "template.allocate",
             :instantiate => "template.instantiate",
+            :instantiate_bulk => "template.instantiatebulk",
             :info        => "template.info",
             :update      => "template.update",
             :delete      => "template.delete",
@@ -134,6 +135,36 @@ module OpenNebula
             return rc
         end
 
+        # Creates a set of VM instances from a Template
+        #
+        # @param count [Integer] Number of VMs
+        # @param name [String] Name for the VM instances, "%i" is replaced by
+        #   the index of each VM. If it is an empty string OpenNebula will set
+        #   a default name
+        # @param hold [true,false] false to create the VMs in pending state,
+        #   true to create them on hold
+        # @param template [String] User provided Template to merge with the
+        #   one being instantiated
+        # @param vm_templates [Array<String>] User provided Templates to merge
+        #   with the template of each VM
+        #
+        # @return [Array<Integer>, OpenNebula::Error] The new VM ids, Error
+        #   otherwise
+        def instantiate_bulk(count, name="", hold=false, template="",
+                             vm_templates=[])
+            return Error.new('ID not defined') if !@pe_id
+
+            name ||= ""
+            hold = false if hold.nil?
+            template ||= ""
+            vm_templates ||= []
+
+            rc = @client.call(TEMPLATE_METHODS[:instantiate_bulk], @pe_id,
+                name, count, hold, template, vm_templates)
+
+            return rc
+        end
+
         # Replaces the template contents
         #
         # @param new_template [String] New template contents
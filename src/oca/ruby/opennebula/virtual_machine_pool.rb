@@ -26,10 +26,13 @@ module OpenNebula
 
         VM_POOL_METHODS = {
             :info               => "vmpool.info",
+            :summary            => "vmpool.summary",
+            :archive            => "vmpool.archive",
             :monitoring         => "vmpool.monitoring",
             :accounting         => "vmpool.accounting",
             :showback           => "vmpool.showback",
-            :calculate_showback => "vmpool.calculateshowback"
+            :calculate_showback => "vmpool.calculateshowback",
+            :action             => "vm.actionbulk"
         }
 
         # Constants for info queries (include/RequestManagerPoolInfoFilter.h)
@@ -115,6 +118,27 @@ module OpenNebula
                                INFO_NOT_DONE)
         end
 
+        # Retrieves the archived (DONE) VirtualMachines
+        # [filter_flag, start_id, end_id]
+        def info_archive(filter_flag=INFO_ALL, start_id=-1, end_id=-1)
+            return info_filter(VM_POOL_METHODS[:archive],
+                               filter_flag,
+                               start_id,
+                               end_id)
+        end
+
+        # Retrieves a summary of the VirtualMachines: ID, owner, name, state,
+        # host and capacity. Templates and full history are not included.
+        # [filter_flag, start_id, end_id, state]
+        def info_summary(filter_flag=INFO_ALL, start_id=-1, end_id=-1,
+                         state=INFO_NOT_DONE)
+            return info_filter(VM_POOL_METHODS[:summary],
+                               filter_flag,
+                               start_id,
+                               end_id,
+                               state)
+        end
+
         alias_method :info!, :info
         alias_method :info_all!, :info_all
         alias_method :info_mine!, :info_mine
@@ -155,6 +179,18 @@ module OpenNebula
                 'VM', 'LAST_POLL', xpath_expressions, filter_flag)
         end
 
+        # Performs an action on a set of VMs in a single call
+        #
+        # @param [String] action name of the action, as in VirtualMachine
+        #   (e.g. "terminate-hard", "poweroff", "resume")
+        # @param [Array<Integer>] ids of the VMs
+        #
+        # @return [Array<Array>, OpenNebula::Error] For each VM an Array with
+        #   its ID, true if the action succeeded and the error message
+        def action(action, ids)
+            return @client.call(VM_POOL_METHODS[:action], action, ids)
+        end
+
         # Retrieves the monitoring data for all the VMs in the pool, in XML
         #
         # @param [Integer] filter_flag Optional filter flag to retrieve all or
@@ -51,11 +51,21 @@ class OneDBBacKEnd
             host_pool: "oid INTEGER PRIMARY KEY, name VARCHAR(128), " <<
                 "body MEDIUMTEXT, state INTEGER, last_mon_time INTEGER, " <<
                 "uid INTEGER, gid INTEGER, owner_u INTEGER, " <<
-                "group_u INTEGER, other_u INTEGER, cid INTEGER",
+                "group_u INTEGER, other_u INTEGER, cid INTEGER, " <<
+                "short_body MEDIUMTEXT",
+            image_pool: "oid INTEGER PRIMARY KEY, name VARCHAR(128), " <<
+                "body MEDIUMTEXT, uid INTEGER, gid INTEGER, owner_u INTEGER, " <<
+                "group_u INTEGER, other_u INTEGER, short_body MEDIUMTEXT, " <<
+                "UNIQUE(name,uid)",
             vm_pool: "oid INTEGER PRIMARY KEY, name VARCHAR(128), " <<
                 "body MEDIUMTEXT, uid INTEGER, gid INTEGER, " <<
                 "last_poll INTEGER, state INTEGER, lcm_state INTEGER, " <<
-                "owner_u INTEGER, group_u INTEGER, other_u INTEGER",
+                "owner_u INTEGER, group_u INTEGER, other_u INTEGER, " <<
+                "short_body MEDIUMTEXT",
+            vm_pool_archive: "oid INTEGER PRIMARY KEY, name VARCHAR(128), " <<
+                "body MEDIUMTEXT, uid INTEGER, gid INTEGER, etime INTEGER, " <<
+                "owner_u INTEGER, group_u INTEGER, other_u INTEGER, " <<
+                "short_body MEDIUMTEXT",
             logdb: "log_index INTEGER PRIMARY KEY, term INTEGER, " <<
                 "sqlcmd MEDIUMTEXT, timestamp INTEGER",
             fed_logdb: "log_index INTEGER PRIMARY KEY, sqlcmd MEDIUMTEXT",
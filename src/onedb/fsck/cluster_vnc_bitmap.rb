@@ -1,4 +1,3 @@
-
 module OneDBFsck
     def check_cluster_vnc_bitmap
         fixes = @fixes_cluster_vnc_bitmap = {}
@@ -9,22 +8,14 @@ module OneDBFsck
         @db.fetch("SELECT * FROM cluster_pool") do |row|
             cluster_id = row[:oid]
 
-            if cluster_vnc[cluster_id]
-                map = ""
-                vnc_pool_size.times.each do |i|
-                    map << (cluster_vnc[cluster_id].include?(vnc_pool_size - 1 - i) ? "1" : "0")
-                end
-
-                map_encoded = Base64::strict_encode64(Zlib::Deflate.deflate(map))
-            else
-                map_encoded = "eJztwYEAAAAAgCCl/ekWqQoAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABqFo8C0Q=="
-            end
+            ports = cluster_vnc[cluster_id] || Set.new
 
             old_map_encoded = @db[:cluster_vnc_bitmap].first(:id => cluster_id)[:map] rescue nil
+            old_ports       = decode_vnc_bitmap(old_map_encoded, vnc_pool_size)
 
-            if old_map_encoded != map_encoded
+            if old_ports != ports
                 log_error("Cluster #{cluster_id} has not the proper reserved VNC ports")
-                fixes[cluster_id] = map_encoded
+                fixes[cluster_id] = encode_vnc_bitmap(ports)
             end
         end
     end
@@ -36,5 +27,47 @@ module OneDBFsck
             end
         end
     end
-end
 
+    # Bitmaps are stored as a range list prefixed by 'R' ("R5900:5910,6000"),
+    # or as the legacy string of size bits ('0'/'1', highest bit first)
+    def decode_vnc_bitmap(map_encoded, size)
+        map = Zlib::Inflate.inflate(Base64::decode64(map_encoded)) rescue nil
+
+        return nil if map.nil?
+
+        ports = Set.new
+
+        if map.start_with?('R')
+            map[1..-1].split(',').each do |range|
+                first, last = range.split(':').map {|b| b.to_i }
+                (first..(last || first)).each {|b| ports << b }
+            end
+        elsif map.size == size
+            map.each_char.with_index do |c, i|
+                ports << size - 1 - i if c == '1'
+            end
+        else
+            return nil
+        end
+
+        ports
+    end
+
+    def encode_vnc_bitmap(ports)
+        ranges = []
+
+        ports.to_a.sort.each do |p|
+            if ranges.last && ranges.last[1] == p - 1
+                ranges.last[1] = p
+            else
+                ranges << [p, p]
+            end
+        end
+
+        map = 'R' + ranges.map do |first, last|
+            first == last ? first.to_s : "#{first}:#{last}"
+        end.join(',')
+
+        Base64::strict_encode64(Zlib::Deflate.deflate(map))
+    end
+end
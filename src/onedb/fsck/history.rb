@@ -33,7 +33,7 @@ module OneDBFsck
         #   - etime = 0
         #   - is last seq
         #   - VM is DONE
-        @db.fetch("SELECT * FROM history WHERE (etime = 0 AND vid IN (SELECT oid FROM vm_pool WHERE state=6) AND seq = (SELECT MAX(seq) FROM history AS subhistory WHERE history.vid=subhistory.vid))") do |row|
+        @db.fetch("SELECT * FROM history WHERE (etime = 0 AND vid IN (SELECT oid FROM vm_pool WHERE state=6 UNION SELECT oid FROM vm_pool_archive) AND seq = (SELECT MAX(seq) FROM history AS subhistory WHERE history.vid=subhistory.vid))") do |row|
             log_error("History record for VM #{row[:vid]} seq # #{row[:seq]} is not closed (etime = 0), but the VM is in state DONE")
 
             etime = 0
@@ -44,6 +44,10 @@ module OneDBFsck
                 etime = vm_doc.root.at_xpath("ETIME").text.to_i
             end
 
+            @db.fetch("SELECT etime FROM vm_pool_archive WHERE oid=#{row[:vid]}") do |vm_row|
+                etime = vm_row[:etime].to_i
+            end
+
             history_doc = nokogiri_doc(row[:body])
 
             ["RETIME", "ESTIME", "EETIME", "ETIME"].each do |att|
@@ -49,6 +49,13 @@ module Migrator
         bug_3705()
 
         feature_4809()
+
+        feature_summary()
+
+        feature_vm_archive()
+
+        feature_indexes()
+
         log_time()
 
         return true
@@ -298,4 +305,140 @@ module Migrator
         @db.run "DROP TABLE old_zone_pool;"
 
     end
+
+    ############################################################################
+    # Pool summaries (short_body) for the vm, host and image pools. They have
+    # the same elements as the to_xml_short methods of the oned objects.
+    ############################################################################
+    SUMMARY = {
+        :vm_pool => ["ID", "UID", "GID", "UNAME", "GNAME", "NAME",
+            "PERMISSIONS", "LAST_POLL", "STATE", "LCM_STATE", "RESCHED",
+            "STIME", "ETIME", "DEPLOY_ID", "MONITORING/CPU",
+            "MONITORING/MEMORY", "TEMPLATE/CPU", "TEMPLATE/VCPU",
+            "TEMPLATE/MEMORY", "HISTORY_RECORDS/HISTORY[last()]/SEQ",
+            "HISTORY_RECORDS/HISTORY[last()]/HOSTNAME",
+            "HISTORY_RECORDS/HISTORY[last()]/HID",
+            "HISTORY_RECORDS/HISTORY[last()]/CID",
+            "HISTORY_RECORDS/HISTORY[last()]/DS_ID"],
+        :host_pool => ["ID", "NAME", "STATE", "IM_MAD", "VM_MAD",
+            "LAST_MON_TIME", "CLUSTER_ID", "CLUSTER", "HOST_SHARE/DISK_USAGE",
+            "HOST_SHARE/MEM_USAGE", "HOST_SHARE/CPU_USAGE",
+            "HOST_SHARE/TOTAL_MEM", "HOST_SHARE/TOTAL_CPU",
+            "HOST_SHARE/MAX_DISK", "HOST_SHARE/MAX_MEM", "HOST_SHARE/MAX_CPU",
+            "HOST_SHARE/FREE_DISK", "HOST_SHARE/FREE_MEM",
+            "HOST_SHARE/FREE_CPU", "HOST_SHARE/USED_DISK",
+            "HOST_SHARE/USED_MEM", "HOST_SHARE/USED_CPU",
+            "HOST_SHARE/RUNNING_VMS"],
+        :image_pool => ["ID", "UID", "GID", "UNAME", "GNAME", "NAME",
+            "PERMISSIONS", "TYPE", "DISK_TYPE", "PERSISTENT", "REGTIME",
+            "SIZE", "STATE", "RUNNING_VMS", "DATASTORE_ID", "DATASTORE"]
+    }
+
+    def short_body(doc, paths)
+        sdoc = Nokogiri::XML::Document.new
+        sdoc.root = sdoc.create_element(doc.root.name)
+
+        paths.each do |path|
+            node = doc.root.at_xpath(path)
+
+            next if node.nil?
+
+            parent = sdoc.root
+
+            path.split("/")[0..-2].each do |elem|
+                name  = elem.sub(/\[.*\]/, "")
+                child = parent.at_xpath(name)
+
+                child = parent.add_child(sdoc.create_element(name)) if child.nil?
+
+                parent = child
+            end
+
+            parent.add_child(node.dup)
+        end
+
+        sdoc.root.to_s
+    end
+
+    def feature_summary
+        SUMMARY.each do |table, paths|
+            if !@db[table].columns.include?(:short_body)
+                @db.run "ALTER TABLE #{table} ADD COLUMN short_body MEDIUMTEXT;"
+            end
+
+            @db.transaction do
+                @db.fetch("SELECT oid, body FROM #{table}") do |row|
+                    doc = Nokogiri::XML(row[:body], nil, NOKOGIRI_ENCODING) { |c|
+                        c.default_xml.noblanks
+                    }
+
+                    @db[table].where(:oid => row[:oid]).update(
+                        :short_body => short_body(doc, paths))
+                end
+            end
+        end
+    end
+
+    ############################################################################
+    # Move DONE VMs out of vm_pool to the compressed vm_pool_archive table
+    ############################################################################
+    def feature_vm_archive
+        create_table(:vm_pool_archive)
+
+        @db.transaction do
+            @db.fetch("SELECT * FROM vm_pool WHERE state = 6") do |row|
+                doc = Nokogiri::XML(row[:body], nil, NOKOGIRI_ENCODING) { |c|
+                    c.default_xml.noblanks
+                }
+
+                body = Base64.strict_encode64(Zlib::Deflate.deflate(row[:body]))
+
+                @db[:vm_pool_archive].insert(
+                    :oid     => row[:oid],
+                    :name    => row[:name],
+                    :body    => body,
+                    :uid     => row[:uid],
+                    :gid     => row[:gid],
+                    :etime   => xpath(doc, "ETIME").to_i,
+                    :owner_u => row[:owner_u],
+                    :group_u => row[:group_u],
+                    :other_u => row[:other_u],
+                    :short_body => row[:short_body])
+            end
+
+            @db.run "DELETE FROM vm_pool WHERE state = 6"
+        end
+    end
+
+    ############################################################################
+    # Secondary indexes for the queries of the monitoring loops and the
+    # owner/group filters. oned also creates them at start up if missing.
+    ############################################################################
+    INDEXES = [
+        [:vm_pool_state_idx,     :vm_pool,         [:state, :lcm_state, :last_poll]],
+        [:vm_pool_uid_idx,       :vm_pool,         [:uid]],
+        [:vm_pool_gid_idx,       :vm_pool,         [:gid]],
+        [:vm_pool_other_idx,     :vm_pool,         [:other_u]],
+        [:vm_monit_poll_idx,     :vm_monitoring,   [:last_poll]],
+        [:history_etime_idx,     :history,         [:etime]],
+        [:history_stime_idx,     :history,         [:stime]],
+        [:vm_archive_uid_idx,    :vm_pool_archive, [:uid]],
+        [:vm_archive_gid_idx,    :vm_pool_archive, [:gid]],
+        [:host_pool_mon_idx,     :host_pool,       [:last_mon_time]],
+        [:host_monit_mon_idx,    :host_monitoring, [:last_mon_time]],
+        [:image_pool_uid_idx,    :image_pool,      [:uid]],
+        [:image_pool_gid_idx,    :image_pool,      [:gid]],
+        [:template_pool_uid_idx, :template_pool,   [:uid]],
+        [:template_pool_gid_idx, :template_pool,   [:gid]],
+        [:network_pool_uid_idx,  :network_pool,    [:uid]],
+        [:network_pool_gid_idx,  :network_pool,    [:gid]]
+    ]
+
+    def feature_indexes
+        INDEXES.each do |name, table, columns|
+            next if @db.indexes(table).has_key?(name)
+
+            @db.add_index(table, columns, :name => name)
+        end
+    end
 end
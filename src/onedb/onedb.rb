@@ -135,6 +135,8 @@ class OneDB
     def upgrade(max_version, ops)
         one_not_running()
 
+        xml_bodies()
+
         db_version = @backend.read_db_version
 
         if ops[:verbose]
@@ -262,6 +264,8 @@ class OneDB
 
             one_not_running()
 
+            xml_bodies()
+
             load(file)
             @backend.extend OneDBFsck
 
@@ -664,6 +668,23 @@ is preserved.
         end
     end
 
+    # Migrators and fsck parse object bodies as XML, oned may store host
+    # bodies in binary format (BODY_FORMAT = binary in oned.conf)
+    def xml_bodies()
+        count = 0
+
+        @backend.db.fetch("SELECT COUNT(*) AS hosts FROM host_pool " <<
+                          "WHERE body LIKE 'OBIN:%'") do |row|
+            count = row[:hosts].to_i
+        end
+
+        if count > 0
+            raise "Found #{count} hosts with binary bodies. Set BODY_FORMAT "<<
+                  "to xml in DB section of oned.conf and restart oned to " <<
+                  "convert them back to XML"
+        end
+    end
+
     def pretty_print_db_version(db_version)
         puts "Version read:"
         puts "Shared tables #{db_version[:version]} : #{db_version[:comment]}"
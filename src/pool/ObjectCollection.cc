@@ -21,38 +21,31 @@
 
 int ObjectCollection::from_xml_node(const xmlNodePtr node)
 {
-   istringstream iss;
-   int           id;
-   int           rc = 0;
-   ostringstream oss;
-
-   vector<string>::iterator it;
-   vector<string> ids;
-
-   ObjectXML oxml(node);
-
-   oss << "/" << collection_name << "/ID";
-
-   oxml.xpaths(ids, oss.str().c_str());
-
-   for (it = ids.begin(); it != ids.end(); it++)
-   {
-       iss.clear();
-       iss.str(*it);
-       iss >> dec >> id;
-
-       if ( iss.fail() )
-       {
-           rc = -1;
-           break;
-       }
-       else
-       {
-           collection_set.insert(id);
-       }
-   }
-
-    return rc;
+    int id;
+
+    if ( node == 0 )
+    {
+        return -1;
+    }
+
+    // The IDs are direct children of the collection node
+    for (xmlNodePtr cur = node->children; cur != 0; cur = cur->next)
+    {
+        if ( cur->type != XML_ELEMENT_NODE ||
+             xmlStrcmp(cur->name, reinterpret_cast<const xmlChar *>("ID")) != 0 )
+        {
+            continue;
+        }
+
+        if ( ObjectXMLDecoder::node_value(cur, id) != 0 )
+        {
+            return -1;
+        }
+
+        collection_set.insert(id);
+    }
+
+    return 0;
 };
 
 /* -------------------------------------------------------------------------- */
@@ -60,22 +53,21 @@ int ObjectCollection::from_xml_node(const xmlNodePtr node)
 
 int ObjectCollection::from_xml(const ObjectXML* xml, const string& xpath_prefix)
 {
-    int                 rc;
-    vector<xmlNodePtr>  content;
-    ostringstream       oss;
+    ObjectXMLDecoder dec;
+    xmlNodePtr       node;
+
+    string path = xpath_prefix + collection_name;
 
-    xml->get_nodes(xpath_prefix + collection_name, content);
+    dec.bind_node(path.c_str(), node);
 
-    if (content.empty())
+    xml->decode(dec);
+
+    if (node == 0)
     {
         return -1;
     }
 
-    rc = from_xml_node(content[0]);
-
-    xml->free_nodes(content);
-
-    return rc;
+    return from_xml_node(node);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -24,6 +24,10 @@ const string PoolObjectSQL::INVALID_NAME_CHARS = "&|:\\\";/'#{}$<>";
 
 const int PoolObjectSQL::LOCK_DB_EXPIRATION = 120;
 
+const int PoolObjectSQL::BODY_REFRESH = 600;
+
+bool PoolObjectSQL::binary_body = false;
+
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
@@ -45,6 +49,142 @@ string& PoolObjectSQL::to_xml64(string &xml64)
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+string& PoolObjectSQL::to_body(string& body) const
+{
+    BinaryWriter bw;
+
+    if ( binary_body && to_binary(bw) == 0 &&
+         one_binary::to_body(bw, body) == 0 )
+    {
+        return body;
+    }
+
+    return to_xml(body);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int PoolObjectSQL::from_body(const string& body)
+{
+    int rc;
+
+    if ( one_binary::is_binary(body) )
+    {
+        string fields;
+        string stable;
+
+        if ( one_binary::from_body(body, fields, stable) != 0 )
+        {
+            return -1;
+        }
+
+        BinaryReader br(fields);
+
+        rc = from_binary(br);
+
+        if ( rc == 0 )
+        {
+            body_digest = one_util::sha1_digest(stable);
+        }
+    }
+    else
+    {
+        rc = from_xml(body);
+
+        if ( rc == 0 )
+        {
+            body_digest = digest_body(body);
+        }
+    }
+
+    if ( rc == 0 )
+    {
+        body_time = volatile_time();
+    }
+
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+string PoolObjectSQL::digest_body(const string& body) const
+{
+    const char * const * elements = volatile_elements();
+
+    // Volatile fields are at the end of binary bodies, not in the stable part
+    if ( one_binary::is_binary(body) )
+    {
+        string fields;
+        string stable;
+
+        one_binary::from_body(body, fields, stable);
+
+        return one_util::sha1_digest(stable);
+    }
+
+    if ( elements == 0 )
+    {
+        return one_util::sha1_digest(body);
+    }
+
+    string stable = body;
+
+    for (; *elements != 0; ++elements)
+    {
+        string stag = string("<")  + *elements + ">";
+        string etag = string("</") + *elements + ">";
+
+        size_t start = stable.find(stag);
+
+        if ( start == string::npos )
+        {
+            continue;
+        }
+
+        size_t end = stable.find(etag, start);
+
+        if ( end == string::npos )
+        {
+            continue;
+        }
+
+        stable.erase(start, end + etag.size() - start);
+    }
+
+    return one_util::sha1_digest(stable);
+}
+
+/* -------------------------------------------------------------------------- */
+
+bool PoolObjectSQL::body_changed(const string& body, string& digest) const
+{
+    time_t vtime = volatile_time();
+
+    digest = digest_body(body);
+
+    if ( digest != body_digest )
+    {
+        return true;
+    }
+
+    if ( vtime == body_time )
+    {
+        return false;
+    }
+
+    // First poll or reset (e.g. LAST_POLL = 0) are always written
+    if ( vtime == 0 || body_time == 0 || vtime < body_time )
+    {
+        return true;
+    }
+
+    return vtime >= body_time + BODY_REFRESH;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 int PoolObjectSQL::select(SqlDB *db)
 {
     ostringstream   oss;
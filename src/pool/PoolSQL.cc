@@ -54,43 +54,94 @@ int PoolSQL::get_lastOID()
 {
     int _last_oid;
 
-    lock();
+    pthread_mutex_lock(&oid_mutex);
 
     _last_oid = _get_lastOID(db, table);
 
-    unlock();
+    pthread_mutex_unlock(&oid_mutex);
 
     return _last_oid;
 }
 
 /* -------------------------------------------------------------------------- */
 
-static void _set_lastOID(int _last_oid, SqlDB * db, const string& table)
+static int _set_lastOID(int _last_oid, SqlDB * db, const string& table)
 {
     ostringstream oss;
 
     oss << "REPLACE INTO pool_control (tablename, last_oid) VALUES ('" << table
         << "'," << _last_oid << ")";
 
-    db->exec_wr(oss);
+    return db->exec_wr(oss);
 }
 
 void PoolSQL::set_lastOID(int _last_oid)
 {
-    lock();
+    pthread_mutex_lock(&oid_mutex);
 
     _set_lastOID(_last_oid, db, table);
 
-    unlock();
+    next_oid = -1;
+
+    pthread_mutex_unlock(&oid_mutex);
+}
+
+/* -------------------------------------------------------------------------- */
+
+const int PoolSQL::OID_BLOCK = 100;
+
+int PoolSQL::reserve_oids(int count)
+{
+    int oid;
+
+    pthread_mutex_lock(&oid_mutex);
+
+    if ( next_oid == -1 || count > reserved_oid - next_oid + 1 )
+    {
+        // Other servers may have reserved OIDs after this block (HA)
+        int last_oid = _get_lastOID(db, table);
+        int block    = count > OID_BLOCK ? count : OID_BLOCK;
+
+        if ( next_oid <= last_oid )
+        {
+            next_oid = last_oid + 1;
+        }
+
+        if ( next_oid > INT_MAX - block )
+        {
+            next_oid = 0;
+        }
+
+        if ( _set_lastOID(next_oid + block - 1, db, table) != 0 )
+        {
+            next_oid = -1;
+
+            pthread_mutex_unlock(&oid_mutex);
+
+            return -1;
+        }
+
+        reserved_oid = next_oid + block - 1;
+    }
+
+    oid = next_oid;
+
+    next_oid += count;
+
+    pthread_mutex_unlock(&oid_mutex);
+
+    return oid;
 }
 
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
 PoolSQL::PoolSQL(SqlDB * _db, const char * _table):
-    db(_db), table(_table)
+    db(_db), table(_table), next_oid(-1), reserved_oid(-1)
 {
     pthread_mutex_init(&mutex,0);
+
+    pthread_mutex_init(&oid_mutex,0);
 };
 
 /* -------------------------------------------------------------------------- */
@@ -112,6 +163,8 @@ PoolSQL::~PoolSQL()
     pthread_mutex_unlock(&mutex);
 
     pthread_mutex_destroy(&mutex);
+
+    pthread_mutex_destroy(&oid_mutex);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -122,20 +175,20 @@ PoolSQL::~PoolSQL()
 int PoolSQL::allocate(PoolObjectSQL *objsql, string& error_str)
 {
     int rc;
-    int lastOID;
-
-    lock();
+    int oid = reserve_oids(1);
 
-    lastOID = _get_lastOID(db, table);
+    objsql->lock();
 
-    if (lastOID == INT_MAX)
+    if ( oid == -1 )
     {
-        lastOID = -1;
-    }
+        error_str = "Cannot reserve a new object id.";
 
-    objsql->lock();
+        delete objsql;
 
-    objsql->oid = ++lastOID;
+        return -1;
+    }
+
+    objsql->oid = oid;
 
     rc = objsql->insert(db, error_str);
 
@@ -145,18 +198,62 @@ int PoolSQL::allocate(PoolObjectSQL *objsql, string& error_str)
     }
     else
     {
-        rc = lastOID;
+        rc = oid;
         do_hooks(objsql, Hook::ALLOCATE);
     }
 
     delete objsql;
 
-    if( rc != -1 )
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+int PoolSQL::allocate(vector<PoolObjectSQL *>& objs, vector<int>& oids,
+        string& error_str)
+{
+    vector<PoolObjectSQL *>::iterator it;
+
+    int rc  = 0;
+    int oid = -1;
+
+    if ( objs.empty() )
     {
-        _set_lastOID(lastOID, db, table);
+        return 0;
     }
 
-    unlock();
+    oid = reserve_oids(objs.size());
+
+    if ( oid == -1 )
+    {
+        error_str = "Cannot reserve a new object id.";
+        rc = -1;
+    }
+
+    for (it = objs.begin(); it != objs.end(); ++it)
+    {
+        (*it)->lock();
+
+        if ( rc == 0 )
+        {
+            (*it)->oid = oid;
+
+            if ( (*it)->insert(db, error_str) != 0 )
+            {
+                rc = -1;
+            }
+            else
+            {
+                oids.push_back(oid++);
+                do_hooks(*it, Hook::ALLOCATE);
+            }
+        }
+
+        delete *it;
+    }
+
+    objs.clear();
 
     return rc;
 }
@@ -339,18 +436,40 @@ int PoolSQL::dump_cb(void * _oss, int num, char **values, char **names)
         return -1;
     }
 
+    // Binary bodies are rendered in XML for the API
+    if ( one_binary::is_binary(values[0]) )
+    {
+        PoolObjectSQL * object = create();
+
+        string xml;
+
+        int rc = object->from_body(values[0]);
+
+        if ( rc == 0 )
+        {
+            *oss << object->to_xml(xml);
+        }
+
+        object->lock();
+
+        delete object;
+
+        return rc;
+    }
+
     *oss << values[0];
     return 0;
 }
 
 /* -------------------------------------------------------------------------- */
 
-int PoolSQL::dump(ostringstream& oss, const string& elem_name, const char* table,
-    const string& where, const string& limit)
+int PoolSQL::dump(ostringstream& oss, const string& elem_name,
+    const char * column, const char* table, const string& where,
+    const string& limit)
 {
     ostringstream   cmd;
 
-    cmd << "SELECT body FROM " << table;
+    cmd << "SELECT " << column << " FROM " << table;
 
     if ( !where.empty() )
     {
@@ -394,6 +513,65 @@ int PoolSQL::dump(ostringstream& oss, const string& root_elem_name,
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+int PoolSQL::migrate_bodies()
+{
+    vector<int> oids;
+    vector<int>::iterator it;
+
+    string where;
+    int    rc = 0;
+
+    if ( PoolObjectSQL::is_binary_body() )
+    {
+        where = "body NOT LIKE 'OBIN:%'";
+    }
+    else
+    {
+        where = "body LIKE 'OBIN:%'";
+    }
+
+    if ( search(oids, table.c_str(), where) != 0 )
+    {
+        return -1;
+    }
+
+    for (it = oids.begin(); it != oids.end(); ++it)
+    {
+        PoolObjectSQL * object = get(*it, true);
+
+        if ( object == 0 )
+        {
+            continue;
+        }
+
+        string body;
+
+        // Objects without binary format keep their XML body
+        if ( one_binary::is_binary(object->to_body(body)) ||
+             !PoolObjectSQL::is_binary_body() )
+        {
+            rc += object->update(db);
+        }
+
+        object->unlock();
+    }
+
+    if ( !oids.empty() )
+    {
+        ostringstream oss;
+
+        oss << "Migrated " << oids.size() << " object bodies in " << table
+            << " to " << (PoolObjectSQL::is_binary_body() ? "binary" : "XML");
+
+        NebulaLog::log("ONE", Log::INFO, oss);
+    }
+
+    return rc == 0 ? 0 : -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 int PoolSQL:: search_cb(void * _oids, int num, char **values, char **names)
 {
     vector<int> *  oids;
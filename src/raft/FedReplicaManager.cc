@@ -14,6 +14,10 @@
 /* limitations under the License.                                             */
 /* -------------------------------------------------------------------------- */
 
+#include <algorithm>
+#include <string.h>
+#include <stdlib.h>
+
 #include "FedReplicaManager.h"
 #include "ReplicaThread.h"
 #include "Nebula.h"
@@ -35,9 +39,14 @@ const time_t FedReplicaManager::xmlrpc_timeout_ms = 10000;
 /* -------------------------------------------------------------------------- */
 
 FedReplicaManager::FedReplicaManager(time_t _t, time_t _p, SqlDB * d,
-    unsigned int l): ReplicaManager(), timer_period(_t), purge_period(_p),
-    last_index(-1), logdb(d), log_retention(l)
+    unsigned int l, unsigned int w): ReplicaManager(), timer_period(_t),
+    purge_period(_p), max_window(w), last_index(-1), logdb(d), log_retention(l)
 {
+    if ( max_window == 0 )
+    {
+        max_window = 1;
+    }
+
     pthread_mutex_init(&mutex, 0);
 
     am.addListener(this);
@@ -123,6 +132,55 @@ int FedReplicaManager::apply_log_record(int index, const std::string& sql)
     return 0;
 }
 
+/* -------------------------------------------------------------------------- */
+
+int FedReplicaManager::apply_log_records(int index, const std::string& records,
+        std::string& error)
+{
+    std::vector<std::string> sqls;
+    std::vector<std::string>::iterator it;
+
+    int rc;
+
+    if ( unpack_records(records, sqls) != 0 || sqls.empty() )
+    {
+        error = "Malformed federation log batch";
+        return -1;
+    }
+
+    pthread_mutex_lock(&mutex);
+
+    if ( (unsigned int) index != last_index + 1 )
+    {
+        rc = last_index;
+
+        pthread_mutex_unlock(&mutex);
+
+        return rc;
+    }
+
+    for ( it = sqls.begin() ; it != sqls.end() ; ++it )
+    {
+        if ( insert_log_record(last_index + 1, *it) != 0 )
+        {
+            pthread_mutex_unlock(&mutex);
+
+            error = "Error writing federation log record";
+            return -1;
+        }
+
+        last_index++;
+
+        std::ostringstream oss(*it);
+
+        logdb->exec_wr(oss);
+    }
+
+    pthread_mutex_unlock(&mutex);
+
+    return 0;
+}
+
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
@@ -297,7 +355,24 @@ void FedReplicaManager::timer_action(const ActionRequest& ar)
     // Thread heartbeat
     if ( (mark_tics * timer_period) >= 600 )
     {
-        NebulaLog::log("FRM",Log::INFO,"--Mark--");
+        std::ostringstream oss;
+
+        std::map<int, ZoneServers *>::iterator it;
+
+        oss << "--Mark--";
+
+        pthread_mutex_lock(&mutex);
+
+        for ( it = zones.begin() ; it != zones.end() ; ++it )
+        {
+            oss << " zone " << it->first << " lag: "
+                << last_index + 1 - it->second->next;
+        }
+
+        pthread_mutex_unlock(&mutex);
+
+        NebulaLog::log("FRM", Log::INFO, oss);
+
         mark_tics = 0;
     }
 
@@ -336,9 +411,12 @@ void FedReplicaManager::timer_action(const ActionRequest& ar)
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-int FedReplicaManager::get_next_record(int zone_id, int& index, std::string& sql,
-        std::map<int, std::string>& zservers)
+int FedReplicaManager::get_next_records(int zone_id, int& index,
+        std::string& records, int& count, std::map<int, std::string>& zservers,
+        bool& batch)
 {
+    unsigned int window;
+
     pthread_mutex_lock(&mutex);
 
     std::map<int, ZoneServers *>::iterator it = zones.find(zone_id);
@@ -350,32 +428,157 @@ int FedReplicaManager::get_next_record(int zone_id, int& index, std::string& sql
     }
 
     index    = it->second->next;
+    window   = it->second->window;
     zservers = it->second->servers;
-
-    int rc   = get_log_record(index, sql);
+    batch    = it->second->batch;
 
     pthread_mutex_unlock(&mutex);
 
-    return rc;
+    return get_log_records(index, window, batch, records, count);
 }
 
 /* -------------------------------------------------------------------------- */
 
-int FedReplicaManager::get_log_record(int index, std::string& sql)
+/**
+ *  Batch of records being read from the log
+ *    - packed records, "<length> <sqlcmd>" for each record
+ *    - next expected index, the batch ends at the first gap
+ *    - pack, false to store the sqlcmd of a single record as is
+ */
+struct FedLogBatch
+{
+    std::ostringstream packed;
+
+    int next;
+
+    bool pack;
+};
+
+int FedReplicaManager::get_log_records(int index, unsigned int num, bool pack,
+        std::string& records, int& count)
 {
     ostringstream oss;
+    FedLogBatch   batch;
 
-    single_cb<std::string> cb;
+    if ( !pack )
+    {
+        num = 1;
+    }
 
-    oss << "SELECT sqlcmd FROM fed_logdb WHERE log_index = " << index;
+    oss << "SELECT log_index, sqlcmd FROM fed_logdb WHERE log_index >= "
+        << index << " AND log_index < " << index + num
+        << " ORDER BY log_index";
 
-    cb.set_callback(&sql);
+    batch.next = index;
+    batch.pack = pack;
 
-    int rc = logdb->exec_rd(oss, &cb);
+    set_callback(static_cast<Callbackable::Callback>(
+                &FedReplicaManager::select_records_cb), &batch);
 
-    cb.unset_callback();
+    int rc = logdb->exec_rd(oss, this);
 
-    return rc;
+    unset_callback();
+
+    count = batch.next - index;
+
+    if ( rc != 0 || count == 0 )
+    {
+        return -1;
+    }
+
+    if ( !pack )
+    {
+        records = batch.packed.str();
+
+        return 0;
+    }
+
+    std::string * zrecords = one_util::zlib_compress(batch.packed.str(), true);
+
+    if ( zrecords == 0 )
+    {
+        return -1;
+    }
+
+    records = *zrecords;
+
+    delete zrecords;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int FedReplicaManager::select_records_cb(void *_batch, int num, char **values,
+        char **names)
+{
+    FedLogBatch * batch = static_cast<FedLogBatch *>(_batch);
+
+    if ( values == 0 || values[0] == 0 || values[1] == 0 || num != 2 )
+    {
+        return -1;
+    }
+
+    if ( atoi(values[0]) != batch->next )
+    {
+        return 0;
+    }
+
+    if ( batch->pack )
+    {
+        batch->packed << strlen(values[1]) << ' ';
+    }
+
+    batch->packed << values[1];
+
+    batch->next++;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int FedReplicaManager::unpack_records(const std::string& records,
+        std::vector<std::string>& sqls)
+{
+    std::string * packed = one_util::zlib_decompress(records, true);
+
+    std::string::size_type pos = 0;
+    std::string::size_type len, space;
+
+    if ( packed == 0 )
+    {
+        return -1;
+    }
+
+    while ( pos < packed->size() )
+    {
+        space = packed->find(' ', pos);
+
+        if ( space == std::string::npos )
+        {
+            break;
+        }
+
+        std::istringstream iss(packed->substr(pos, space - pos));
+
+        iss >> len;
+
+        if ( iss.fail() || len > packed->size() - space - 1 )
+        {
+            break;
+        }
+
+        sqls.push_back(packed->substr(space + 1, len));
+
+        pos = space + 1 + len;
+    }
+
+    bool malformed = pos != packed->size();
+
+    delete packed;
+
+    return malformed ? -1 : 0;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -439,7 +642,7 @@ int FedReplicaManager::bootstrap(SqlDB *_db)
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-void FedReplicaManager::replicate_success(int zone_id)
+void FedReplicaManager::replicate_success(int zone_id, int zone_last)
 {
     pthread_mutex_lock(&mutex);
 
@@ -453,7 +656,14 @@ void FedReplicaManager::replicate_success(int zone_id)
 
     ZoneServers * zs = it->second;
 
-    zs->next++;
+    zs->next = zone_last + 1;
+
+    zs->last_success = time(0);
+
+    if ( zs->window < max_window )
+    {
+        zs->window = std::min(2 * zs->window, max_window);
+    }
 
     if ( last_index >= zs->next )
     {
@@ -475,6 +685,8 @@ void FedReplicaManager::replicate_failure(int zone_id, int last_zone)
     {
         ZoneServers * zs = it->second;
 
+        zs->window = 1;
+
         if ( last_zone >= 0 )
         {
             zs->next = last_zone + 1;
@@ -493,19 +705,23 @@ void FedReplicaManager::replicate_failure(int zone_id, int last_zone)
 int FedReplicaManager::xmlrpc_replicate_log(int zone_id, bool& success,
         int& last, std::string& error)
 {
-    static const std::string replica_method = "one.zone.fedreplicate";
+    static const std::string batch_method  = "one.zone.fedreplicatebatch";
+    static const std::string record_method = "one.zone.fedreplicate";
 
-    int index;
-    std::string sql, secret;
+    int index, count;
+    std::string records, zsecret;
 
     std::map<int, std::string> zservers;
     std::map<int, std::string>::iterator it;
 
-	int xml_rc = 0;
+    bool batch;
+
+    int xml_rc     = 0;
+    int fault_code = 0;
 
-    if ( get_next_record(zone_id, index, sql, zservers) != 0 )
+    if (get_next_records(zone_id, index, records, count, zservers, batch) != 0)
     {
-        error = "Failed to load federation log record";
+        error = "Failed to load federation log records";
         return -1;
     }
 
@@ -518,17 +734,34 @@ int FedReplicaManager::xmlrpc_replicate_log(int zone_id, bool& success,
     // -------------------------------------------------------------------------
     // Get parameters to call append entries on follower
     // -------------------------------------------------------------------------
-    if ( Client::read_oneauth(secret, error) == -1 )
+    pthread_mutex_lock(&mutex);
+
+    if ( secret.empty() && Client::read_oneauth(secret, error) == -1 )
     {
+        secret.clear();
+
+        pthread_mutex_unlock(&mutex);
         return -1;
     }
 
+    zsecret = secret;
+
+    pthread_mutex_unlock(&mutex);
+
     xmlrpc_c::value result;
     xmlrpc_c::paramList replica_params;
 
-    replica_params.add(xmlrpc_c::value_string(secret));
+    const std::string& replica_method = batch ? batch_method : record_method;
+
+    replica_params.add(xmlrpc_c::value_string(zsecret));
     replica_params.add(xmlrpc_c::value_int(index));
-    replica_params.add(xmlrpc_c::value_string(sql));
+
+    if ( batch )
+    {
+        replica_params.add(xmlrpc_c::value_int(count));
+    }
+
+    replica_params.add(xmlrpc_c::value_string(records));
 
     // -------------------------------------------------------------------------
     // Do the XML-RPC call
@@ -536,7 +769,7 @@ int FedReplicaManager::xmlrpc_replicate_log(int zone_id, bool& success,
     for (it=zservers.begin(); it != zservers.end(); ++it)
     {
         xml_rc = Client::client()->call(it->second, replica_method,
-            replica_params, xmlrpc_timeout_ms, &result, error);
+            replica_params, xmlrpc_timeout_ms, &result, error, &fault_code);
 
         if ( xml_rc == 0 )
         {
@@ -561,14 +794,89 @@ int FedReplicaManager::xmlrpc_replicate_log(int zone_id, bool& success,
         {
             std::ostringstream ess;
 
-            ess << "Error replicating log entry " << index << " on zone server "
-                << it->second << ": " << error;
+            ess << "Error replicating log entries " << index << "-"
+                << index + count - 1 << " on zone server " << it->second
+                << ": " << error;
 
             NebulaLog::log("FRM", Log::ERROR, error);
 
             error = ess.str();
+
+            if ( batch && fault_code == xmlrpc_c::fault::CODE_NO_SUCH_METHOD )
+            {
+                break;
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Zones running an older version do not implement the batch method, use
+    // one.zone.fedreplicate for them
+    // -------------------------------------------------------------------------
+    if ( xml_rc != 0 && batch &&
+            fault_code == xmlrpc_c::fault::CODE_NO_SUCH_METHOD )
+    {
+        std::ostringstream oss;
+
+        pthread_mutex_lock(&mutex);
+
+        std::map<int, ZoneServers *>::iterator zit = zones.find(zone_id);
+
+        if ( zit != zones.end() )
+        {
+            zit->second->batch = false;
         }
+
+        pthread_mutex_unlock(&mutex);
+
+        oss << "Zone " << zone_id << " does not support " << batch_method
+            << ", replicating log records with " << record_method;
+
+        NebulaLog::log("FRM", Log::WARNING, oss);
+
+        return xmlrpc_replicate_log(zone_id, success, last, error);
+    }
+
+    // -------------------------------------------------------------------------
+    // Reload credentials on failure
+    // -------------------------------------------------------------------------
+    if ( xml_rc != 0 || !success )
+    {
+        pthread_mutex_lock(&mutex);
+
+        secret.clear();
+
+        pthread_mutex_unlock(&mutex);
     }
 
     return xml_rc;
 }
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+void FedReplicaManager::zones_to_xml(std::ostringstream& oss)
+{
+    std::map<int, ZoneServers *>::iterator it;
+
+    pthread_mutex_lock(&mutex);
+
+    oss << "<FEDLOG_ZONES>";
+
+    for ( it = zones.begin() ; it != zones.end() ; ++it )
+    {
+        ZoneServers * zs = it->second;
+
+        oss << "<ZONE>"
+            << "<ID>"           << zs->zone_id              << "</ID>"
+            << "<NEXT_INDEX>"   << zs->next                 << "</NEXT_INDEX>"
+            << "<LAG>"          << last_index + 1 - zs->next << "</LAG>"
+            << "<WINDOW>"       << zs->window               << "</WINDOW>"
+            << "<LAST_SUCCESS>" << zs->last_success         << "</LAST_SUCCESS>"
+            << "</ZONE>";
+    }
+
+    oss << "</FEDLOG_ZONES>";
+
+    pthread_mutex_unlock(&mutex);
+}
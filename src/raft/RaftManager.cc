@@ -22,11 +22,15 @@
 #include "Client.h"
 
 #include <cstdlib>
+#include <fstream>
+#include <unistd.h>
 
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 const time_t RaftManager::timer_period_ms = 50;
 
+const time_t RaftManager::snapshot_timeout_ms = 600000;
+
 static void set_timeout(long long ms, struct timespec& timeout)
 {
     std::lldiv_t d;
@@ -49,7 +53,8 @@ RaftManager::RaftManager(int id, const VectorAttribute * leader_hook_mad,
         const VectorAttribute * follower_hook_mad, time_t log_purge,
         long long bcast, long long elect, time_t xmlrpc,
         const string& remotes_location):server_id(id), term(0), num_servers(0),
-        commit(0), leader_hook(0), follower_hook(0)
+        commit(0), snapshot_chunk(0), snapshot_leader(-1), snapshot_lterm(0),
+        snapshot_index(0), leader_hook(0), follower_hook(0)
 {
     Nebula& nd    = Nebula::instance();
     LogDB * logdb = nd.get_logdb();
@@ -625,7 +630,7 @@ void RaftManager::replicate_success(int follower_id)
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-void RaftManager::replicate_failure(int follower_id)
+void RaftManager::replicate_failure(int follower_id, int flast)
 {
     std::map<int, unsigned int>::iterator next_it;
 
@@ -635,7 +640,11 @@ void RaftManager::replicate_failure(int follower_id)
 
     if ( next_it != next.end() )
     {
-        if ( next_it->second > 0 )
+        if ( flast >= 0 && next_it->second > (unsigned int) flast + 1 )
+        {
+            next_it->second = flast + 1;
+        }
+        else if ( next_it->second > 0 )
         {
             next_it->second = next_it->second - 1;
         }
@@ -649,6 +658,171 @@ void RaftManager::replicate_failure(int follower_id)
     pthread_mutex_unlock(&mutex);
 }
 
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+void RaftManager::snapshot_success(int follower_id, unsigned int index)
+{
+    std::map<int, unsigned int>::iterator next_it;
+    std::map<int, unsigned int>::iterator match_it;
+
+    unsigned int db_last_index, db_last_term;
+
+    Nebula& nd    = Nebula::instance();
+    LogDB * logdb = nd.get_logdb();
+
+    logdb->get_last_record_index(db_last_index, db_last_term);
+
+    pthread_mutex_lock(&mutex);
+
+    next_it  = next.find(follower_id);
+    match_it = match.find(follower_id);
+
+    if ( next_it == next.end() || match_it == match.end() )
+    {
+        pthread_mutex_unlock(&mutex);
+        return;
+    }
+
+    match_it->second = index;
+    next_it->second  = index + 1;
+
+    if ((db_last_index > index) && (state == LEADER))
+    {
+        replica_manager.replicate(follower_id);
+    }
+
+    pthread_mutex_unlock(&mutex);
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+int RaftManager::receive_snapshot(int leader_id, unsigned int leader_term,
+        unsigned int sindex, unsigned int sterm, int chunk,
+        const std::string& data, bool last, std::string& error)
+{
+    Nebula& nd    = Nebula::instance();
+    LogDB * logdb = nd.get_logdb();
+
+    std::string file = nd.get_var_location() + "raft_snapshot";
+    std::ofstream ofs;
+
+    std::ostringstream oss;
+
+    pthread_mutex_lock(&mutex);
+
+    // The follower already has the records of the snapshot (e.g. a transfer
+    // retried after the install). It is not installed, that would roll back
+    // the DB, the leader continues replicating after its index.
+    if ( sindex <= commit )
+    {
+        if ( chunk == 0 )
+        {
+            oss << "Ignoring DB snapshot at index " << sindex
+                << ", records committed up to " << commit;
+
+            NebulaLog::log("RCM", Log::INFO, oss);
+        }
+
+        pthread_mutex_unlock(&mutex);
+        return 0;
+    }
+
+    if ( chunk == 0 )
+    {
+        snapshot_leader = leader_id;
+        snapshot_lterm  = leader_term;
+        snapshot_index  = sindex;
+
+        ofs.open(file.c_str(), std::ios::out|std::ios::binary|std::ios::trunc);
+    }
+    else if ( chunk == snapshot_chunk && leader_id == snapshot_leader &&
+              leader_term == snapshot_lterm && sindex == snapshot_index )
+    {
+        ofs.open(file.c_str(), std::ios::out|std::ios::binary|std::ios::app);
+    }
+    else
+    {
+        oss << "Unexpected snapshot chunk " << chunk << " (index " << sindex
+            << ") from leader " << leader_id << ", expecting " << snapshot_chunk
+            << " (index " << snapshot_index << ") from leader "
+            << snapshot_leader;
+
+        error = oss.str();
+
+        pthread_mutex_unlock(&mutex);
+        return -1;
+    }
+
+    std::string * bin = one_util::base64_decode(data);
+
+    if ( !ofs.is_open() || bin == 0 )
+    {
+        error = "Cannot write snapshot file " + file;
+
+        snapshot_chunk = 0;
+
+        delete bin;
+
+        pthread_mutex_unlock(&mutex);
+        return -1;
+    }
+
+    ofs.write(bin->c_str(), bin->size());
+
+    ofs.close();
+
+    delete bin;
+
+    snapshot_chunk = chunk + 1;
+
+    if ( last )
+    {
+        // Chunks received while installing are not part of this transfer
+        snapshot_chunk  = 0;
+        snapshot_leader = -1;
+    }
+
+    pthread_mutex_unlock(&mutex);
+
+    if ( !last )
+    {
+        return 0;
+    }
+
+    // -------------------------------------------------------------------------
+    // Last chunk, install the snapshot and commit up to its index
+    // -------------------------------------------------------------------------
+    oss << "Installing DB snapshot at index " << sindex << ", term " << sterm;
+
+    NebulaLog::log("RCM", Log::INFO, oss);
+
+    int rc = logdb->install_snapshot(file, sindex, sterm);
+
+    unlink(file.c_str());
+
+    pthread_mutex_lock(&mutex);
+
+    if ( rc == 0 && commit < sindex )
+    {
+        commit = sindex;
+    }
+
+    pthread_mutex_unlock(&mutex);
+
+    if ( rc != 0 )
+    {
+        oss.str("");
+
+        oss << "Error installing DB snapshot at index " << sindex;
+
+        error = oss.str();
+    }
+
+    return rc;
+}
+
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 /* Raft state interface                                                       */
@@ -983,7 +1157,7 @@ void RaftManager::request_vote()
 /* -------------------------------------------------------------------------- */
 
 int RaftManager::xmlrpc_replicate_log(int follower_id, LogDBRecord * lr,
-		bool& success, unsigned int& fterm, std::string& error)
+		bool& success, unsigned int& fterm, int& flast, std::string& error)
 {
 	int _server_id;
 	int _commit;
@@ -998,6 +1172,8 @@ int RaftManager::xmlrpc_replicate_log(int follower_id, LogDBRecord * lr,
 
 	int xml_rc = 0;
 
+    flast = -1;
+
 	pthread_mutex_lock(&mutex);
 
     it = servers.find(follower_id);
@@ -1061,6 +1237,11 @@ int RaftManager::xmlrpc_replicate_log(int follower_id, LogDBRecord * lr,
         {
             error = xmlrpc_c::value_string(values[1]);
             fterm = xmlrpc_c::value_int(values[3]);
+
+            if ( values.size() > 4 )
+            {
+                flast = xmlrpc_c::value_int(values[4]);
+            }
         }
     }
     else
@@ -1079,6 +1260,95 @@ int RaftManager::xmlrpc_replicate_log(int follower_id, LogDBRecord * lr,
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+int RaftManager::xmlrpc_install_snapshot(int follower_id, unsigned int sindex,
+        unsigned int sterm, int chunk, const std::string& data, bool last,
+        bool& success, unsigned int& fterm, std::string& error)
+{
+    int _server_id;
+    int _term;
+
+    static const std::string snapshot_method = "one.zone.installsnapshot";
+
+    std::string secret;
+    std::string follower_edp;
+
+    std::map<int, std::string>::iterator it;
+
+    int xml_rc = 0;
+
+    pthread_mutex_lock(&mutex);
+
+    it = servers.find(follower_id);
+
+    if ( it == servers.end() )
+    {
+        error = "Cannot find follower end point";
+        pthread_mutex_unlock(&mutex);
+
+        return -1;
+    }
+
+    follower_edp = it->second;
+
+    _term      = term;
+    _server_id = server_id;
+
+    pthread_mutex_unlock(&mutex);
+
+    if ( Client::read_oneauth(secret, error) == -1 )
+    {
+        NebulaLog::log("RRM", Log::ERROR, error);
+        return -1;
+    }
+
+    xmlrpc_c::value result;
+    xmlrpc_c::paramList snapshot_params;
+
+    snapshot_params.add(xmlrpc_c::value_string(secret));
+    snapshot_params.add(xmlrpc_c::value_int(_server_id));
+    snapshot_params.add(xmlrpc_c::value_int(_term));
+    snapshot_params.add(xmlrpc_c::value_int(sindex));
+    snapshot_params.add(xmlrpc_c::value_int(sterm));
+    snapshot_params.add(xmlrpc_c::value_int(chunk));
+    snapshot_params.add(xmlrpc_c::value_string(data));
+    snapshot_params.add(xmlrpc_c::value_boolean(last));
+
+    xml_rc = Client::call(follower_edp, snapshot_method, snapshot_params,
+            snapshot_timeout_ms, &result, error);
+
+    if ( xml_rc == 0 )
+    {
+        vector<xmlrpc_c::value> values;
+
+        values  = xmlrpc_c::value_array(result).vectorValueValue();
+        success = xmlrpc_c::value_boolean(values[0]);
+
+        if ( success )
+        {
+            fterm = xmlrpc_c::value_int(values[1]);
+        }
+        else
+        {
+            error = xmlrpc_c::value_string(values[1]);
+            fterm = xmlrpc_c::value_int(values[3]);
+        }
+    }
+    else
+    {
+        std::ostringstream ess;
+
+        ess << "Error sending snapshot chunk " << chunk << " to follower "
+            << follower_id << ": " << error;
+
+        error = ess.str();
+    }
+
+    return xml_rc;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 int RaftManager::xmlrpc_request_vote(int follower_id, unsigned int lindex,
         unsigned int lterm, bool& success, unsigned int& fterm,
         std::string& error)
@@ -1181,9 +1451,15 @@ std::string& RaftManager::to_xml(std::string& raft_xml)
     unsigned int lindex, lterm;
 
     std::ostringstream oss;
+    std::ostringstream zones_oss;
 
     logdb->get_last_record_index(lindex, lterm);
 
+    if ( nd.is_federation_master() )
+    {
+        frm->zones_to_xml(zones_oss);
+    }
+
 	pthread_mutex_lock(&mutex);
 
     oss << "<RAFT>"
@@ -1213,6 +1489,8 @@ std::string& RaftManager::to_xml(std::string& raft_xml)
         oss << "<FEDLOG_INDEX>-1</FEDLOG_INDEX>";
     }
 
+    oss << zones_oss.str();
+
     oss << "</RAFT>";
 
 	pthread_mutex_unlock(&mutex);
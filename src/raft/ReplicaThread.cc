@@ -16,6 +16,9 @@
 
 #include <errno.h>
 #include <string>
+#include <fstream>
+#include <vector>
+#include <unistd.h>
 
 #include "LogDB.h"
 #include "RaftManager.h"
@@ -186,8 +189,20 @@ int RaftReplicaThread::replicate()
 
     int next_index = raftm->get_next_index(follower_id);
 
+    int follower_last = -1;
+
     if ( logdb->get_log_record(next_index, lr) != 0 )
     {
+        unsigned int last_index, last_term;
+
+        logdb->get_last_record_index(last_index, last_term);
+
+        // Record purged from the log, the follower needs a snapshot
+        if ( next_index >= 0 && (unsigned int) next_index <= last_index )
+        {
+            return install_snapshot();
+        }
+
         ostringstream ess;
 
         ess << "Failed to load log record at index: " << next_index;
@@ -197,8 +212,13 @@ int RaftReplicaThread::replicate()
         return -1;
     }
 
+    if ( lr.sql == LogDB::snapshot_sql )
+    {
+        return install_snapshot();
+    }
+
     if ( raftm->xmlrpc_replicate_log(follower_id, &lr, success, follower_term,
-                error) != 0 )
+                follower_last, error) != 0 )
     {
         return -1;
     }
@@ -222,7 +242,7 @@ int RaftReplicaThread::replicate()
         }
         else
         {
-            raftm->replicate_failure(follower_id);
+            raftm->replicate_failure(follower_id, follower_last);
         }
     }
 
@@ -232,6 +252,108 @@ int RaftReplicaThread::replicate()
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 
+const size_t RaftReplicaThread::snapshot_chunk_size = 1048576;
+
+int RaftReplicaThread::install_snapshot()
+{
+    std::ostringstream oss;
+    std::string error;
+
+    unsigned int index, term;
+
+    unsigned int follower_term = -1;
+    unsigned int current_term  = raftm->get_term();
+
+    bool success = false;
+    bool last    = false;
+
+    oss << Nebula::instance().get_var_location() << "raft_snapshot."
+        << follower_id;
+
+    std::string file = oss.str();
+
+    if ( logdb->create_snapshot(file, index, term) != 0 )
+    {
+        NebulaLog::log("RCM", Log::ERROR, "Failed to create DB snapshot");
+
+        unlink(file.c_str());
+        return -1;
+    }
+
+    oss.str("");
+
+    oss << "Sending DB snapshot at index " << index << " to follower "
+        << follower_id;
+
+    NebulaLog::log("RCM", Log::INFO, oss);
+
+    std::ifstream ifs(file.c_str(), std::ios::in | std::ios::binary);
+    std::vector<char> buffer(snapshot_chunk_size);
+
+    int rc = 0;
+
+    for (int chunk = 0; !last && rc == 0; ++chunk)
+    {
+        ifs.read(&buffer[0], snapshot_chunk_size);
+
+        std::string data(&buffer[0], ifs.gcount());
+
+        last = ifs.peek() == std::ifstream::traits_type::eof();
+
+        std::string * data64 = one_util::base64_encode(data);
+
+        if ( data64 == 0 )
+        {
+            rc = -1;
+            break;
+        }
+
+        rc = raftm->xmlrpc_install_snapshot(follower_id, index, term, chunk,
+                *data64, last, success, follower_term, error);
+
+        delete data64;
+
+        if ( rc != 0 )
+        {
+            NebulaLog::log("RCM", Log::ERROR, error);
+        }
+        else if ( !success )
+        {
+            if ( follower_term > current_term )
+            {
+                oss.str("");
+
+                oss << "Follower " << follower_id << " term (" << follower_term
+                    << ") is higher than current (" << current_term << ")";
+
+                NebulaLog::log("RCM", Log::INFO, oss);
+
+                raftm->follower(follower_term);
+            }
+            else
+            {
+                NebulaLog::log("RCM", Log::ERROR, error);
+            }
+
+            rc = -1;
+        }
+    }
+
+    ifs.close();
+
+    unlink(file.c_str());
+
+    if ( rc == 0 )
+    {
+        raftm->snapshot_success(follower_id, index);
+    }
+
+    return rc;
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+
 FedReplicaThread::FedReplicaThread(int zone_id):ReplicaThread(zone_id)
 {
     Nebula& nd = Nebula::instance();
@@ -258,7 +380,7 @@ int FedReplicaThread::replicate()
 
     if ( success )
     {
-        frm->replicate_success(follower_id);
+        frm->replicate_success(follower_id, last);
     }
     else
     {
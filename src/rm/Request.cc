@@ -258,6 +258,28 @@ void Request::log_xmlrpc_value(const xmlrpc_c::value& v, std::ostringstream& oss
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+/**
+ *  @return true if the last parameter is a READ_INDEX struct. A struct is
+ *  used so it is not mistaken for the optional parameters of info methods.
+ */
+static bool has_read_index(xmlrpc_c::paramList const& paramList)
+{
+    size_t num_params = paramList.size();
+
+    if ( num_params < 2 ||
+         paramList[num_params - 1].type() != xmlrpc_c::value::TYPE_STRUCT )
+    {
+        return false;
+    }
+
+    map<string, xmlrpc_c::value> index_st =
+        xmlrpc_c::value_struct(paramList[num_params - 1]);
+
+    return index_st.find("READ_INDEX") != index_st.end();
+}
+
+/* -------------------------------------------------------------------------- */
+
 string Request::format_str;
 
 const long long Request::xmlrpc_timeout = 10000;
@@ -329,9 +351,23 @@ void Request::execute(
         att.resp_msg = "Cannot process request, oned cluster in election mode";
         failure_response(INTERNAL, att);
     }
+    else if ( read_index && has_read_index(_paramList) )
+    {
+        xmlrpc_c::paramList paramList;
+
+        if ( wait_read_index(_paramList, paramList, att) )
+        {
+            request_execute(paramList, att);
+        }
+    }
     else //leader or solo or !leader_only
     {
         request_execute(_paramList, att);
+
+        if ( leader_only )
+        {
+            add_log_index(att);
+        }
     }
 
     if ( log_method_call )
@@ -343,6 +379,82 @@ void Request::execute(
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+bool Request::wait_read_index(xmlrpc_c::paramList const& _paramList,
+        xmlrpc_c::paramList& paramList, RequestAttributes& att)
+{
+    size_t num_params = _paramList.size() - 1;
+
+    for (size_t i = 0; i < num_params; ++i)
+    {
+        paramList.add(_paramList[i]);
+    }
+
+    Nebula& nd = Nebula::instance();
+
+    if ( nd.get_raftm()->is_solo() )
+    {
+        return true;
+    }
+
+    map<string, xmlrpc_c::value> index_st =
+        xmlrpc_c::value_struct(_paramList[num_params]);
+
+    xmlrpc_c::value index_v = index_st["READ_INDEX"];
+
+    if ( index_v.type() != xmlrpc_c::value::TYPE_INT )
+    {
+        att.resp_msg = "Wrong type for READ_INDEX, it must be an int";
+        failure_response(XML_RPC_API, att);
+
+        return false;
+    }
+
+    int index = xmlrpc_c::value_int(index_v);
+
+    if ( index > 0 && nd.get_logdb()->wait_applied(index, xmlrpc_timeout) != 0 )
+    {
+        ostringstream oss;
+
+        oss << "Cannot process request, log index " << index
+            << " not applied yet";
+
+        att.resp_msg = oss.str();
+        failure_response(INTERNAL, att);
+
+        return false;
+    }
+
+    return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void Request::add_log_index(RequestAttributes& att)
+{
+    Nebula& nd = Nebula::instance();
+
+    if ( nd.get_raftm()->is_solo() ||
+         att.retval->type() != xmlrpc_c::value::TYPE_ARRAY )
+    {
+        return;
+    }
+
+    vector<xmlrpc_c::value> values =
+        xmlrpc_c::value_array(*(att.retval)).vectorValueValue();
+
+    if ( values.size() != 3 || !xmlrpc_c::value_boolean(values[0]) )
+    {
+        return;
+    }
+
+    values.push_back(xmlrpc_c::value_int(nd.get_logdb()->get_last_applied()));
+
+    *(att.retval) = xmlrpc_c::value_array(values);
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 bool Request::basic_authorization(int oid,
                                   AuthRequest::Operation op,
                                   RequestAttributes& att)
@@ -782,6 +894,47 @@ void Request::success_response(bool val, RequestAttributes& att)
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+void Request::success_response(const vector<int>& val, RequestAttributes& att)
+{
+    vector<xmlrpc_c::value> arrayData;
+    vector<xmlrpc_c::value> ids;
+
+    vector<int>::const_iterator it;
+
+    for (it = val.begin(); it != val.end(); ++it)
+    {
+        ids.push_back(xmlrpc_c::value_int(*it));
+    }
+
+    arrayData.push_back(xmlrpc_c::value_boolean(true));
+    arrayData.push_back(xmlrpc_c::value_array(ids));
+    arrayData.push_back(xmlrpc_c::value_int(SUCCESS));
+
+    xmlrpc_c::value_array arrayresult(arrayData);
+
+    *(att.retval) = arrayresult;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+void Request::success_response(const xmlrpc_c::value_array& val,
+        RequestAttributes& att)
+{
+    vector<xmlrpc_c::value> arrayData;
+
+    arrayData.push_back(xmlrpc_c::value_boolean(true));
+    arrayData.push_back(val);
+    arrayData.push_back(xmlrpc_c::value_int(SUCCESS));
+
+    xmlrpc_c::value_array arrayresult(arrayData);
+
+    *(att.retval) = arrayresult;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 int Request::get_info(
         PoolSQL *                 pool,
         int                       id,
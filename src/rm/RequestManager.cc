@@ -286,11 +286,13 @@ void RequestManager::register_xml_methods()
 
     // VMTemplate Methods
     xmlrpc_c::methodPtr template_instantiate(new VMTemplateInstantiate());
+    xmlrpc_c::methodPtr template_instantiate_bulk(new VMTemplateInstantiateBulk());
 
     // VirtualMachine Methods
     xmlrpc_c::methodPtr vm_deploy(new VirtualMachineDeploy());
     xmlrpc_c::methodPtr vm_migrate(new VirtualMachineMigrate());
     xmlrpc_c::methodPtr vm_action(new VirtualMachineAction());
+    xmlrpc_c::methodPtr vm_action_bulk(new VirtualMachineActionBulk());
     xmlrpc_c::methodPtr vm_monitoring(new VirtualMachineMonitoring());
     xmlrpc_c::methodPtr vm_attach(new VirtualMachineAttach());
     xmlrpc_c::methodPtr vm_detach(new VirtualMachineDetach());
@@ -310,6 +312,7 @@ void RequestManager::register_xml_methods()
 
     xmlrpc_c::methodPtr vm_pool_acct(new VirtualMachinePoolAccounting());
     xmlrpc_c::methodPtr vm_pool_monitoring(new VirtualMachinePoolMonitoring());
+    xmlrpc_c::methodPtr vm_pool_archive(new VirtualMachinePoolArchive());
 
     xmlrpc_c::methodPtr vm_pool_showback(new VirtualMachinePoolShowback());
     xmlrpc_c::methodPtr vm_pool_calculate_showback(new VirtualMachinePoolCalculateShowback());
@@ -385,11 +388,14 @@ void RequestManager::register_xml_methods()
 
     // PoolInfo Methods
     xmlrpc_c::methodPtr hostpool_info(new HostPoolInfo());
+    xmlrpc_c::methodPtr hostpool_summary(new HostPoolSummary());
     xmlrpc_c::methodPtr datastorepool_info(new DatastorePoolInfo());
     xmlrpc_c::methodPtr vm_pool_info(new VirtualMachinePoolInfo());
+    xmlrpc_c::methodPtr vm_pool_summary(new VirtualMachinePoolSummary());
     xmlrpc_c::methodPtr template_pool_info(new TemplatePoolInfo());
     xmlrpc_c::methodPtr vnpool_info(new VirtualNetworkPoolInfo());
     xmlrpc_c::methodPtr imagepool_info(new ImagePoolInfo());
+    xmlrpc_c::methodPtr imagepool_summary(new ImagePoolSummary());
     xmlrpc_c::methodPtr clusterpool_info(new ClusterPoolInfo());
     xmlrpc_c::methodPtr docpool_info(new DocumentPoolInfo());
     xmlrpc_c::methodPtr secgpool_info(new SecurityGroupPoolInfo());
@@ -472,6 +478,7 @@ void RequestManager::register_xml_methods()
     /* VM related methods  */
     RequestManagerRegistry.addMethod("one.vm.deploy", vm_deploy);
     RequestManagerRegistry.addMethod("one.vm.action", vm_action);
+    RequestManagerRegistry.addMethod("one.vm.actionbulk", vm_action_bulk);
     RequestManagerRegistry.addMethod("one.vm.migrate", vm_migrate);
     RequestManagerRegistry.addMethod("one.vm.allocate", vm_allocate);
     RequestManagerRegistry.addMethod("one.vm.info", vm_info);
@@ -497,14 +504,17 @@ void RequestManager::register_xml_methods()
     RequestManagerRegistry.addMethod("one.vm.diskresize", vm_disk_resize);
 
     RequestManagerRegistry.addMethod("one.vmpool.info", vm_pool_info);
+    RequestManagerRegistry.addMethod("one.vmpool.summary", vm_pool_summary);
     RequestManagerRegistry.addMethod("one.vmpool.accounting", vm_pool_acct);
     RequestManagerRegistry.addMethod("one.vmpool.monitoring", vm_pool_monitoring);
+    RequestManagerRegistry.addMethod("one.vmpool.archive", vm_pool_archive);
     RequestManagerRegistry.addMethod("one.vmpool.showback", vm_pool_showback);
     RequestManagerRegistry.addMethod("one.vmpool.calculateshowback", vm_pool_calculate_showback);
 
     /* VM Template related methods*/
     RequestManagerRegistry.addMethod("one.template.update", template_update);
     RequestManagerRegistry.addMethod("one.template.instantiate",template_instantiate);
+    RequestManagerRegistry.addMethod("one.template.instantiatebulk",template_instantiate_bulk);
     RequestManagerRegistry.addMethod("one.template.allocate",template_allocate);
     RequestManagerRegistry.addMethod("one.template.delete", template_delete);
     RequestManagerRegistry.addMethod("one.template.info", template_info);
@@ -525,6 +535,7 @@ void RequestManager::register_xml_methods()
     RequestManagerRegistry.addMethod("one.host.rename", host_rename);
 
     RequestManagerRegistry.addMethod("one.hostpool.info", hostpool_info);
+    RequestManagerRegistry.addMethod("one.hostpool.summary", hostpool_summary);
     RequestManagerRegistry.addMethod("one.hostpool.monitoring", host_pool_monitoring);
 
     /* Group related methods */
@@ -686,6 +697,7 @@ void RequestManager::register_xml_methods()
     RequestManagerRegistry.addMethod("one.image.snapshotflatten", image_snap_flatten);
 
     RequestManagerRegistry.addMethod("one.imagepool.info", imagepool_info);
+    RequestManagerRegistry.addMethod("one.imagepool.summary", imagepool_summary);
 
     /* ACL related methods */
 
@@ -787,9 +799,11 @@ void RequestManager::register_xml_methods()
     xmlrpc_c::methodPtr zone_addserver(new ZoneAddServer());
     xmlrpc_c::methodPtr zone_delserver(new ZoneDeleteServer());
     xmlrpc_c::methodPtr zone_replicatelog(new ZoneReplicateLog());
+    xmlrpc_c::methodPtr zone_installsnapshot(new ZoneInstallSnapshot());
     xmlrpc_c::methodPtr zone_voterequest(new ZoneVoteRequest());
     xmlrpc_c::methodPtr zone_raftstatus(new ZoneRaftStatus());
     xmlrpc_c::methodPtr zone_fedreplicatelog(new ZoneReplicateFedLog());
+    xmlrpc_c::methodPtr zone_fedreplicatebatch(new ZoneReplicateFedLogBatch());
 
     xmlrpc_c::methodPtr zone_info(new ZoneInfo());
     xmlrpc_c::methodPtr zonepool_info(new ZonePoolInfo());
@@ -800,7 +814,9 @@ void RequestManager::register_xml_methods()
     RequestManagerRegistry.addMethod("one.zone.info",     zone_info);
     RequestManagerRegistry.addMethod("one.zone.rename",   zone_rename);
     RequestManagerRegistry.addMethod("one.zone.replicate",zone_replicatelog);
+    RequestManagerRegistry.addMethod("one.zone.installsnapshot",zone_installsnapshot);
     RequestManagerRegistry.addMethod("one.zone.fedreplicate",zone_fedreplicatelog);
+    RequestManagerRegistry.addMethod("one.zone.fedreplicatebatch",zone_fedreplicatebatch);
     RequestManagerRegistry.addMethod("one.zone.voterequest",zone_voterequest);
     RequestManagerRegistry.addMethod("one.zone.raftstatus", zone_raftstatus);
 
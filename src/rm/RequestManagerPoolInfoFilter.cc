@@ -120,7 +120,86 @@ void VirtualMachinePoolInfo::request_execute(
             break;
     }
 
-    dump(att, filter_flag, start_id, end_id, state_filter.str(), "");
+    if ( state != VirtualMachinePoolInfo::ALL_VM && state != VirtualMachine::DONE )
+    {
+        dump(att, filter_flag, start_id, end_id, state_filter.str(), "");
+        return;
+    }
+
+    // -------------------------------------------------------------------------
+    // DONE VMs are in the archive table, VMs not yet archived are also
+    // looked up in the VM table
+    // -------------------------------------------------------------------------
+    ostringstream oss;
+    string        where, archive_where, limit_clause;
+    int           rc;
+
+    if ( filter_flag < GROUP )
+    {
+        att.resp_msg = "Incorrect filter_flag";
+        failure_response(XML_RPC_API, att);
+        return;
+    }
+
+    where_filter(att, filter_flag, start_id, end_id, state_filter.str(), "",
+        false, false, false, where);
+
+    where_filter(att, filter_flag, start_id, end_id, "", "", false, false,
+        false, archive_where);
+
+    limit_filter(start_id, end_id, limit_clause);
+
+    rc = (static_cast<VirtualMachinePool *>(pool))->dump(oss, where,
+            archive_where, limit_clause, summary);
+
+    if ( rc != 0 )
+    {
+        att.resp_msg = "Internal error";
+        failure_response(INTERNAL, att);
+        return;
+    }
+
+    success_response(oss.str(), att);
+}
+
+/* ------------------------------------------------------------------------- */
+/* ------------------------------------------------------------------------- */
+
+void VirtualMachinePoolArchive::request_execute(
+        xmlrpc_c::paramList const& paramList,
+        RequestAttributes& att)
+{
+    int filter_flag = xmlrpc_c::value_int(paramList.getInt(1));
+    int start_id    = xmlrpc_c::value_int(paramList.getInt(2));
+    int end_id      = xmlrpc_c::value_int(paramList.getInt(3));
+
+    ostringstream oss;
+    string        where, limit_clause;
+    int           rc;
+
+    if ( filter_flag < GROUP )
+    {
+        att.resp_msg = "Incorrect filter_flag";
+        failure_response(XML_RPC_API, att);
+        return;
+    }
+
+    where_filter(att, filter_flag, start_id, end_id, "", "", false, false,
+        false, where);
+
+    limit_filter(start_id, end_id, limit_clause);
+
+    rc = (static_cast<VirtualMachinePool *>(pool))->dump_archive(oss, where,
+            limit_clause);
+
+    if ( rc != 0 )
+    {
+        att.resp_msg = "Internal error";
+        failure_response(INTERNAL, att);
+        return;
+    }
+
+    success_response(oss.str(), att);
 }
 
 /* ------------------------------------------------------------------------- */
@@ -459,14 +538,16 @@ void RequestManagerPoolInfoFilter::dump(
                  false,
                  where_string);
 
-    if ( end_id < -1 )
+    limit_filter(start_id, end_id, limit_clause);
+
+    if ( summary )
     {
-        oss << start_id << "," << -end_id;
-        limit_clause = oss.str();
-        oss.str("");
+        rc = pool->dump_summary(oss, where_string, limit_clause);
+    }
+    else
+    {
+        rc = pool->dump(oss, where_string, limit_clause);
     }
-
-    rc = pool->dump(oss, where_string, limit_clause);
 
     if ( rc != 0 )
     {
@@ -286,3 +286,340 @@ Request::ErrorCode VMTemplateInstantiate::merge(
 
     return SUCCESS;
 }
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Builds a quota template for a set of VMs. MEMORY and CPU are added and the
+ *  DISK and NIC attributes of all the VMs are included.
+ *    @param tmpls the (extended) templates of the VMs
+ *    @param from first VM to include
+ *    @param qtmpl the quota template
+ */
+static void quota_template(vector<VirtualMachineTemplate *>& tmpls,
+        size_t from, Template& qtmpl)
+{
+    int   memory, total_memory = 0;
+    float cpu, total_cpu = 0;
+
+    bool valid = true;
+
+    for (size_t i = from; i < tmpls.size(); ++i)
+    {
+        vector<VectorAttribute *> vatts;
+        vector<VectorAttribute *>::iterator it;
+
+        if ( tmpls[i]->get("MEMORY", memory) == false || memory <= 0 ||
+             tmpls[i]->get("CPU", cpu) == false || cpu <= 0 )
+        {
+            valid = false;
+        }
+        else
+        {
+            total_memory += memory;
+            total_cpu    += cpu;
+        }
+
+        tmpls[i]->get("DISK", vatts);
+        tmpls[i]->get("NIC", vatts);
+
+        for (it = vatts.begin(); it != vatts.end(); ++it)
+        {
+            qtmpl.set((*it)->clone());
+        }
+    }
+
+    if ( !valid ) // Makes the VM quota check fail for the whole set
+    {
+        total_memory = 0;
+        total_cpu    = 0;
+    }
+
+    qtmpl.replace("VMS", static_cast<int>(tmpls.size() - from));
+    qtmpl.replace("MEMORY", total_memory);
+    qtmpl.replace("CPU", total_cpu);
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+void VMTemplateInstantiateBulk::request_execute(
+        xmlrpc_c::paramList const& paramList, RequestAttributes& att)
+{
+    int    id    = xmlrpc_c::value_int(paramList.getInt(1));
+    string name  = xmlrpc_c::value_string(paramList.getString(2));
+    int    count = xmlrpc_c::value_int(paramList.getInt(3));
+
+    bool   on_hold = false;           //Optional XML-RPC argument
+    string str_uattrs;                //Optional XML-RPC argument
+    vector<xmlrpc_c::value> vm_uattrs;//Optional XML-RPC argument
+
+    if ( paramList.size() > 4 )
+    {
+        on_hold = xmlrpc_c::value_boolean(paramList.getBoolean(4));
+    }
+
+    if ( paramList.size() > 5 )
+    {
+        str_uattrs = xmlrpc_c::value_string(paramList.getString(5));
+    }
+
+    if ( paramList.size() > 6 )
+    {
+        vm_uattrs = xmlrpc_c::value_array(
+                paramList.getArray(6)).vectorValueValue();
+    }
+
+    if ( count <= 0 || vm_uattrs.size() > static_cast<size_t>(count) )
+    {
+        att.resp_msg = "Number of VMs must be positive and not lower than the"
+            " number of VM templates";
+        failure_response(ACTION, att);
+        return;
+    }
+
+    Nebula& nd = Nebula::instance();
+
+    VirtualMachinePool * vmpool = nd.get_vmpool();
+    VMTemplatePool *     tpool  = static_cast<VMTemplatePool *>(pool);
+
+    VMTemplateInstantiate instantiate;
+
+    VirtualMachineTemplate * tmpl;
+    VMTemplate *             rtmpl;
+
+    PoolObjectAuth perms;
+
+    vector<VirtualMachineTemplate *> tmpls;
+    vector<VirtualMachineTemplate *> ext_tmpls;
+    vector<VirtualMachineTemplate *> owned;
+
+    vector<VirtualMachineTemplate *>::iterator it;
+
+    vector<int> oids;
+
+    ostringstream sid;
+
+    string tmpl_name;
+
+    ErrorCode ec = SUCCESS;
+
+    /* ---------------------------------------------------------------------- */
+    /* Get, check and clone the template                                      */
+    /* ---------------------------------------------------------------------- */
+    rtmpl = tpool->get(id, true);
+
+    if ( rtmpl == 0 )
+    {
+        att.resp_id = id;
+        failure_response(NO_EXISTS, att);
+        return;
+    }
+
+    if ( rtmpl->is_vrouter() )
+    {
+        rtmpl->unlock();
+
+        att.resp_msg = "Virtual router templates cannot be instantiated";
+        failure_response(ACTION, att);
+        return;
+    }
+
+    tmpl_name = rtmpl->get_name();
+    tmpl      = rtmpl->clone_template();
+
+    rtmpl->get_permissions(perms);
+
+    rtmpl->unlock();
+
+    ec = instantiate.merge(tmpl, str_uattrs, att);
+
+    if ( ec != SUCCESS )
+    {
+        delete tmpl;
+
+        failure_response(ec, att);
+        return;
+    }
+
+    tmpl->erase("NAME");
+
+    sid << id;
+
+    /* ---------------------------------------------------------------------- */
+    /* Build the template of each VM                                          */
+    /* ---------------------------------------------------------------------- */
+    for (int i = 0; i < count && ec == SUCCESS; ++i)
+    {
+        VirtualMachineTemplate * vm_tmpl = new VirtualMachineTemplate(*tmpl);
+
+        tmpls.push_back(vm_tmpl);
+
+        if ( static_cast<size_t>(i) < vm_uattrs.size() )
+        {
+            string str_vm_uattrs = xmlrpc_c::value_string(vm_uattrs[i]);
+
+            ec = instantiate.merge(vm_tmpl, str_vm_uattrs, att);
+        }
+
+        vm_tmpl->erase("TEMPLATE_NAME");
+        vm_tmpl->erase("TEMPLATE_ID");
+
+        vm_tmpl->set(new SingleAttribute("TEMPLATE_NAME", tmpl_name));
+        vm_tmpl->set(new SingleAttribute("TEMPLATE_ID", sid.str()));
+
+        string vm_name;
+
+        vm_tmpl->get("NAME", vm_name);
+
+        if ( !name.empty() && vm_name.empty() )
+        {
+            ostringstream oss;
+
+            oss << i;
+
+            vm_tmpl->replace("NAME", one_util::gsub(name, "%i", oss.str()));
+        }
+    }
+
+    if ( ec != SUCCESS )
+    {
+        for (it = tmpls.begin(); it != tmpls.end(); ++it)
+        {
+            delete *it;
+        }
+
+        delete tmpl;
+
+        failure_response(ec, att);
+        return;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* Authorize the VMs and check quotas for all of them                     */
+    /* ---------------------------------------------------------------------- */
+    if ( att.uid != 0 )
+    {
+        AuthRequest ar(att.uid, att.group_ids);
+
+        ar.add_auth(AuthRequest::USE, perms); //USE TEMPLATE
+
+        if (!str_uattrs.empty() || !vm_uattrs.empty())
+        {
+            string tmpl_str;
+
+            tmpl->to_xml(tmpl_str);
+
+            // CREATE TEMPLATE
+            ar.add_create_auth(att.uid, att.gid, PoolObjectSQL::TEMPLATE,
+                    tmpl_str);
+        }
+
+        VirtualMachine::set_auth_request(att.uid, ar, tmpl);
+
+        // Templates with VM attributes may use additional resources
+        for (size_t i = 0; i < vm_uattrs.size(); ++i)
+        {
+            VirtualMachine::set_auth_request(att.uid, ar, tmpls[i]);
+        }
+
+        if (UserPool::authorize(ar) == -1)
+        {
+            att.resp_msg = ar.message;
+            ec = AUTHORIZATION;
+        }
+        else
+        {
+            // VMs without their own attributes share the extended template
+            VirtualMachineTemplate * shared_tmpl = 0;
+
+            for (size_t i = 0; i < tmpls.size(); ++i)
+            {
+                VirtualMachineTemplate * ext_tmpl = shared_tmpl;
+
+                if ( i < vm_uattrs.size() || shared_tmpl == 0 )
+                {
+                    ext_tmpl = new VirtualMachineTemplate(*tmpls[i]);
+
+                    VirtualMachineDisks::extended_info(att.uid, ext_tmpl);
+
+                    owned.push_back(ext_tmpl);
+
+                    if ( i >= vm_uattrs.size() )
+                    {
+                        shared_tmpl = ext_tmpl;
+                    }
+                }
+
+                ext_tmpls.push_back(ext_tmpl);
+            }
+
+            Template quota_tmpl;
+
+            quota_template(ext_tmpls, 0, quota_tmpl);
+
+            if (quota_authorization(&quota_tmpl, Quotas::VIRTUALMACHINE, att,
+                        att.resp_msg) == false)
+            {
+                ec = AUTHORIZATION;
+            }
+        }
+    }
+
+    delete tmpl;
+
+    if ( ec != SUCCESS )
+    {
+        for (it = tmpls.begin(); it != tmpls.end(); ++it)
+        {
+            delete *it;
+        }
+
+        for (it = owned.begin(); it != owned.end(); ++it)
+        {
+            delete *it;
+        }
+
+        failure_response(ec, att);
+        return;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    /* Allocate the VMs                                                       */
+    /* ---------------------------------------------------------------------- */
+    int rc = vmpool->allocate(att.uid, att.gid, att.uname, att.gname,
+            att.umask, tmpls, oids, att.resp_msg, on_hold);
+
+    if ( rc != 0 && !ext_tmpls.empty() )
+    {
+        Template quota_tmpl;
+
+        quota_template(ext_tmpls, oids.size(), quota_tmpl);
+
+        quota_rollback(&quota_tmpl, Quotas::VIRTUALMACHINE, att);
+    }
+
+    for (it = owned.begin(); it != owned.end(); ++it)
+    {
+        delete *it;
+    }
+
+    if ( rc != 0 )
+    {
+        if ( !oids.empty() )
+        {
+            ostringstream oss;
+
+            oss << att.resp_msg << ". VMs allocated: "
+                << one_util::join(oids.begin(), oids.end(), ',');
+
+            att.resp_msg = oss.str();
+        }
+
+        failure_response(ALLOCATE, att);
+        return;
+    }
+
+    success_response(oids, att);
+}
@@ -379,10 +379,9 @@ bool RequestManagerVirtualMachine::check_host(
     bool   test;
     string capacity_error;
 
-    int cpu, mem, disk;
-    vector<VectorAttribute *> pci;
+    HostShareCapacity sr;
 
-    vm->get_requirements(cpu, mem, disk, pci);
+    vm->get_capacity(sr);
 
     host = hpool->get(hid, true);
 
@@ -394,11 +393,11 @@ bool RequestManagerVirtualMachine::check_host(
 
     if (enforce)
     {
-        test = host->test_capacity(cpu, mem, disk, pci, capacity_error);
+        test = host->test_capacity(sr, capacity_error);
     }
     else
     {
-        test = host->test_capacity(pci, capacity_error);
+        test = host->test_devices(sr, capacity_error);
     }
 
     if (!test)
@@ -475,72 +474,21 @@ int RequestManagerVirtualMachine::add_history(VirtualMachine * vm,
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-void VirtualMachineAction::request_execute(xmlrpc_c::paramList const& paramList,
-                                           RequestAttributes& att)
+/**
+ *  Triggers a VM action in the DispatchManager
+ *    @param action to perform
+ *    @param id of the VM
+ *    @param att the specific request attributes
+ *    @param error description if any
+ *    @return 0 on success, -1 if the VM does not exist, -2 if the action
+ *    cannot be performed and -3 if the action is not supported
+ */
+static int dm_action(History::VMAction action, int id, RequestAttributes& att,
+        string& error)
 {
-    string action_st = xmlrpc_c::value_string(paramList.getString(1));
-    int    id        = xmlrpc_c::value_int(paramList.getInt(2));
-
-    int    rc;
-
-    Nebula& nd = Nebula::instance();
-    DispatchManager * dm = nd.get_dm();
-
-    ostringstream oss;
-    string error;
-
-    AuthRequest::Operation op;
-    History::VMAction action;
-
-    VirtualMachine * vm;
-
-    // Compatibility with 4.x
-    if (action_st == "shutdown-hard" || action_st == "delete" )
-    {
-        action_st = "terminate-hard";
-    }
-    else if (action_st == "shutdown")
-    {
-        action_st = "terminate";
-    }
-
-    History::action_from_str(action_st, action);
-
-    op = nd.get_vm_auth_op(action);
-
-    if ( vm_authorization(id, 0, 0, att, 0, 0, 0, op) == false )
-    {
-        return;
-    }
-
-    if ((vm = get_vm(id, att)) == 0)
-    {
-        return;
-    }
-
-    if (vm->is_imported() && !vm->is_imported_action_supported(action))
-    {
-        att.resp_msg = "Action \"" + action_st + "\" is not supported for "
-            "imported VMs";
-
-        failure_response(ACTION, att);
-
-        vm->unlock();
-        return;
-    }
-
-    if (vm->is_vrouter() && !VirtualRouter::is_action_supported(action))
-    {
-        att.resp_msg = "Action \"" + action_st + "\" is not supported for "
-            "virtual router VMs";
-
-        failure_response(ACTION, att);
+    DispatchManager * dm = Nebula::instance().get_dm();
 
-        vm->unlock();
-        return;
-    }
-
-    vm->unlock();
+    int rc;
 
     switch (action)
     {
@@ -594,6 +542,110 @@ void VirtualMachineAction::request_execute(xmlrpc_c::paramList const& paramList,
             break;
     }
 
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Checks that the action is supported by the VM (imported or virtual router)
+ *    @param vm the VM, it has to be locked
+ *    @param action to perform
+ *    @param action_st name of the action
+ *    @param error description if not supported
+ *    @return true if the action is supported
+ */
+static bool action_supported(VirtualMachine * vm, History::VMAction action,
+        const string& action_st, string& error)
+{
+    if (vm->is_imported() && !vm->is_imported_action_supported(action))
+    {
+        error = "Action \"" + action_st + "\" is not supported for "
+            "imported VMs";
+
+        return false;
+    }
+
+    if (vm->is_vrouter() && !VirtualRouter::is_action_supported(action))
+    {
+        error = "Action \"" + action_st + "\" is not supported for "
+            "virtual router VMs";
+
+        return false;
+    }
+
+    return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Translates the action name, including the 4.x compatibility names
+ *    @param action_st name of the action, it is updated to the current name
+ *    @param action the action
+ */
+static void action_from_str(string& action_st, History::VMAction& action)
+{
+    // Compatibility with 4.x
+    if (action_st == "shutdown-hard" || action_st == "delete" )
+    {
+        action_st = "terminate-hard";
+    }
+    else if (action_st == "shutdown")
+    {
+        action_st = "terminate";
+    }
+
+    History::action_from_str(action_st, action);
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+void VirtualMachineAction::request_execute(xmlrpc_c::paramList const& paramList,
+                                           RequestAttributes& att)
+{
+    string action_st = xmlrpc_c::value_string(paramList.getString(1));
+    int    id        = xmlrpc_c::value_int(paramList.getInt(2));
+
+    int    rc;
+
+    Nebula& nd = Nebula::instance();
+
+    ostringstream oss;
+    string error;
+
+    AuthRequest::Operation op;
+    History::VMAction action;
+
+    VirtualMachine * vm;
+
+    action_from_str(action_st, action);
+
+    op = nd.get_vm_auth_op(action);
+
+    if ( vm_authorization(id, 0, 0, att, 0, 0, 0, op) == false )
+    {
+        return;
+    }
+
+    if ((vm = get_vm(id, att)) == 0)
+    {
+        return;
+    }
+
+    if (!action_supported(vm, action, action_st, att.resp_msg))
+    {
+        failure_response(ACTION, att);
+
+        vm->unlock();
+        return;
+    }
+
+    vm->unlock();
+
+    rc = dm_action(action, id, att, error);
+
     switch (rc)
     {
         case 0:
@@ -630,6 +682,150 @@ void VirtualMachineAction::request_execute(xmlrpc_c::paramList const& paramList,
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+void VirtualMachineActionBulk::request_execute(
+        xmlrpc_c::paramList const& paramList, RequestAttributes& att)
+{
+    string action_st = xmlrpc_c::value_string(paramList.getString(1));
+
+    vector<xmlrpc_c::value> ids = xmlrpc_c::value_array(
+            paramList.getArray(2)).vectorValueValue();
+
+    Nebula& nd = Nebula::instance();
+
+    AuthRequest::Operation op;
+    History::VMAction action;
+
+    vector<int>            oids;
+    vector<PoolObjectAuth> perms;
+    vector<string>         errors;
+
+    action_from_str(action_st, action);
+
+    op = nd.get_vm_auth_op(action);
+
+    // ------------------------------------------------------------------------
+    // Get the permissions of the VMs and check the action is supported
+    // ------------------------------------------------------------------------
+    for (vector<xmlrpc_c::value>::iterator it = ids.begin(); it != ids.end();
+            ++it)
+    {
+        int id = xmlrpc_c::value_int(*it);
+
+        VirtualMachine * vm = static_cast<VirtualMachine *>(pool->get(id,true));
+
+        PoolObjectAuth vm_perms;
+        string         error;
+
+        if ( vm == 0 )
+        {
+            error = "VM does not exist";
+        }
+        else
+        {
+            action_supported(vm, action, action_st, error);
+
+            vm->get_permissions(vm_perms);
+
+            vm->unlock();
+        }
+
+        oids.push_back(id);
+        perms.push_back(vm_perms);
+        errors.push_back(error);
+    }
+
+    // ------------------------------------------------------------------------
+    // Authorize all the VMs in a single request. If it fails, each VM is
+    // authorized to report the VMs that cannot be operated
+    // ------------------------------------------------------------------------
+    if ( att.uid != 0 )
+    {
+        AuthRequest ar(att.uid, att.group_ids);
+
+        for (size_t i = 0; i < oids.size(); ++i)
+        {
+            if ( errors[i].empty() )
+            {
+                ar.add_auth(op, perms[i]);
+            }
+        }
+
+        if ( UserPool::authorize(ar) == -1 )
+        {
+            for (size_t i = 0; i < oids.size(); ++i)
+            {
+                if ( !errors[i].empty() )
+                {
+                    continue;
+                }
+
+                AuthRequest vm_ar(att.uid, att.group_ids);
+
+                vm_ar.add_auth(op, perms[i]);
+
+                if ( UserPool::authorize(vm_ar) == -1 )
+                {
+                    errors[i] = vm_ar.message;
+                }
+            }
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Perform the action on the authorized VMs
+    // ------------------------------------------------------------------------
+    vector<xmlrpc_c::value> results;
+
+    for (size_t i = 0; i < oids.size(); ++i)
+    {
+        string error = errors[i];
+
+        if ( error.empty() )
+        {
+            ostringstream oss;
+
+            switch (dm_action(action, oids[i], att, error))
+            {
+                case 0:
+                    break;
+
+                case -1:
+                    error = "VM does not exist";
+                    break;
+
+                case -2:
+                    oss << "Error performing action \"" << action_st << "\": "
+                        << error;
+
+                    error = oss.str();
+                    break;
+
+                case -3:
+                    oss << "Action \"" << action_st << "\" is not supported";
+
+                    error = oss.str();
+                    break;
+
+                default:
+                    error = "Internal error. Action result not defined";
+            }
+        }
+
+        vector<xmlrpc_c::value> result;
+
+        result.push_back(xmlrpc_c::value_int(oids[i]));
+        result.push_back(xmlrpc_c::value_boolean(error.empty()));
+        result.push_back(xmlrpc_c::value_string(error));
+
+        results.push_back(xmlrpc_c::value_array(result));
+    }
+
+    success_response(xmlrpc_c::value_array(results), att);
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 /**
  *  Adds extra info to the volatile disks of the given template, ds inherited
  *  attributes and TYPE
@@ -1947,7 +2143,12 @@ void VirtualMachineResize::request_execute(xmlrpc_c::paramList const& paramList,
         int dcpu_host = (int) (dcpu * 100);//now in 100%
         int dmem_host = dmemory * 1024;    //now in Kilobytes
 
-        vector<VectorAttribute *> empty_pci;
+        HostShareCapacity sr;
+
+        sr.vmid = id;
+        sr.cpu  = dcpu_host;
+        sr.mem  = dmem_host;
+        sr.disk = 0;
 
         host = hpool->get(hid, true);
 
@@ -1962,8 +2163,7 @@ void VirtualMachineResize::request_execute(xmlrpc_c::paramList const& paramList,
             return;
         }
 
-        if ( enforce && host->test_capacity(dcpu_host, dmem_host, 0,
-                    empty_pci, att.resp_msg) == false)
+        if ( enforce && host->test_capacity(sr, att.resp_msg) == false)
         {
             ostringstream oss;
 
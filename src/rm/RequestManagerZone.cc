@@ -364,10 +364,22 @@ void ZoneReplicateLog::request_execute(xmlrpc_c::paramList const& paramList,
     {
         if ( logdb->get_log_record(prev_index, prev_lr) != 0 )
         {
+            unsigned int lindex, lterm;
+
+            logdb->get_last_record_index(lindex, lterm);
+
             att.resp_msg = "Error loading previous log record";
             att.resp_id  = current_term;
 
             failure_response(ACTION, att);
+
+            // Last index in the log, so the leader can skip missing records
+            vector<xmlrpc_c::value> values =
+                xmlrpc_c::value_array(*(att.retval)).vectorValueValue();
+
+            values.push_back(xmlrpc_c::value_int(lindex));
+
+            *(att.retval) = xmlrpc_c::value_array(values);
             return;
         }
 
@@ -415,6 +427,87 @@ void ZoneReplicateLog::request_execute(xmlrpc_c::paramList const& paramList,
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+void ZoneInstallSnapshot::request_execute(xmlrpc_c::paramList const& paramList,
+    RequestAttributes& att)
+{
+    Nebula& nd = Nebula::instance();
+
+    RaftManager * raftm = nd.get_raftm();
+
+    int leader_id            = xmlrpc_c::value_int(paramList.getInt(1));
+    unsigned int leader_term = xmlrpc_c::value_int(paramList.getInt(2));
+
+    unsigned int index = xmlrpc_c::value_int(paramList.getInt(3));
+    unsigned int term  = xmlrpc_c::value_int(paramList.getInt(4));
+    int          chunk = xmlrpc_c::value_int(paramList.getInt(5));
+
+    string data = xmlrpc_c::value_string(paramList.getString(6));
+    bool   last = xmlrpc_c::value_boolean(paramList.getBoolean(7));
+
+    unsigned int current_term = raftm->get_term();
+
+    string error;
+
+    if ( att.uid != 0 )
+    {
+        att.resp_id  = current_term;
+
+        failure_response(AUTHORIZATION, att);
+        return;
+    }
+
+    if ( leader_term < current_term )
+    {
+        std::ostringstream oss;
+
+        oss << "Leader term (" << leader_term << ") is outdated ("
+            << current_term<<")";
+
+        NebulaLog::log("ReM", Log::INFO, oss);
+
+        att.resp_msg = oss.str();
+        att.resp_id  = current_term;
+
+        failure_response(ACTION, att);
+        return;
+    }
+    else if ( leader_term > current_term )
+    {
+        std::ostringstream oss;
+
+        oss << "New term (" << leader_term << ") discovered from leader "
+            << leader_id;
+
+        NebulaLog::log("ReM", Log::INFO, oss);
+
+        raftm->follower(leader_term);
+    }
+
+    if ( raftm->is_candidate() )
+    {
+        raftm->follower(leader_term);
+    }
+
+    raftm->update_last_heartbeat(leader_id);
+
+    if ( raftm->receive_snapshot(leader_id, leader_term, index, term, chunk,
+                data, last, error) != 0 )
+    {
+        NebulaLog::log("ReM", Log::ERROR, error);
+
+        att.resp_msg = error;
+        att.resp_id  = current_term;
+
+        failure_response(ACTION, att);
+        return;
+    }
+
+    success_response(static_cast<int>(current_term), att);
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 void ZoneVoteRequest::request_execute(xmlrpc_c::paramList const& paramList,
     RequestAttributes& att)
 {
@@ -590,3 +683,86 @@ void ZoneReplicateFedLog::request_execute(xmlrpc_c::paramList const& paramList,
     return;
 }
 
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+void ZoneReplicateFedLogBatch::request_execute(
+    xmlrpc_c::paramList const& paramList, RequestAttributes& att)
+{
+    std::ostringstream oss;
+    std::string error;
+
+    Nebula& nd = Nebula::instance();
+
+    FedReplicaManager * frm = nd.get_frm();
+
+    int index      = xmlrpc_c::value_int(paramList.getInt(1));
+    int count      = xmlrpc_c::value_int(paramList.getInt(2));
+    string records = xmlrpc_c::value_string(paramList.getString(3));
+
+    if ( att.uid != 0 )
+    {
+        att.resp_id  = -1;
+
+        failure_response(AUTHORIZATION, att);
+        return;
+    }
+
+    if ( records.empty() || count <= 0 )
+    {
+        oss << "Received an empty batch of SQL commands at index " << index;
+
+        NebulaLog::log("ReM", Log::ERROR, oss);
+
+        att.resp_msg = oss.str();
+        att.resp_id  = index;
+
+        failure_response(ACTION, att);
+        return;
+    }
+
+    if ( !nd.is_federation_slave() )
+    {
+        oss << "Cannot replicate federate log records on federation master";
+
+        NebulaLog::log("ReM", Log::INFO, oss);
+
+        att.resp_msg = oss.str();
+        att.resp_id  = - 1;
+
+        failure_response(ACTION, att);
+        return;
+    }
+
+    int rc = frm->apply_log_records(index, records, error);
+
+    if ( rc == 0 )
+    {
+        success_response(frm->get_last_index(), att);
+    }
+    else if ( rc < 0 )
+    {
+        oss << "Error replicating log entries " << index << "-"
+            << index + count - 1 << " in zone: " << error;
+
+        NebulaLog::log("ReM", Log::INFO, oss);
+
+        att.resp_msg = oss.str();
+        att.resp_id  = frm->get_last_index();
+
+        failure_response(ACTION, att);
+    }
+    else // rc == last_index in log
+    {
+        oss << "Zone log is outdated last log index is " << rc;
+
+        NebulaLog::log("ReM", Log::INFO, oss);
+
+        att.resp_msg = oss.str();
+        att.resp_id  = rc;
+
+        failure_response(ACTION, att);
+    }
+
+    return;
+}
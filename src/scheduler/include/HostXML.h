@@ -59,23 +59,27 @@ public:
      *    @param cpu needed by the VM (percentage)
      *    @param mem needed by the VM (in KB)
      *    @param pci devices needed by the VM
+     *    @param nodes virtual NUMA nodes of the VM
      *    @param error error message
      *    @return true if the share can host the VM
      */
     bool test_capacity(long long cpu, long long mem,
-            vector<VectorAttribute *> &pci, string & error);
+            vector<VectorAttribute *> &pci, vector<VectorAttribute *> &nodes,
+            string & error);
 
     /**
      *  Tests whether a new VM can be hosted by the host or not
      *    @param cpu needed by the VM (percentage)
      *    @param mem needed by the VM (in KB)
      *    @param pci devices needed by the VM
+     *    @param nodes virtual NUMA nodes of the VM
      *    @return true if the share can host the VM
      */
-    bool test_capacity(long long cpu,long long mem,vector<VectorAttribute *> &p)
+    bool test_capacity(long long cpu,long long mem,vector<VectorAttribute *> &p,
+            vector<VectorAttribute *> &nodes)
     {
         string tmp_st;
-        return test_capacity(cpu, mem, p, tmp_st);
+        return test_capacity(cpu, mem, p, nodes, tmp_st);
     };
 
     /**
@@ -83,16 +87,20 @@ public:
      *  counters
      *    @param cpu needed by the VM (percentage)
      *    @param mem needed by the VM (in KB)
+     *    @param p devices needed by the VM
+     *    @param nodes virtual NUMA nodes of the VM
      *    @return 0 on success
      */
     void add_capacity(int vmid, long long cpu, long long mem,
-        vector<VectorAttribute *> &p)
+        vector<VectorAttribute *> &p, vector<VectorAttribute *> &nodes)
     {
         cpu_usage  += cpu;
         mem_usage  += mem;
 
         pci.add(p, vmid);
 
+        numa.add(nodes, vmid);
+
         dispatched_vms.insert(vmid);
 
         running_vms++;
@@ -187,6 +195,8 @@ private:
 
     HostSharePCI pci;  /**< PCI devices of the host */
 
+    HostShareNUMA numa; /**< NUMA nodes of the host */
+
     long long free_disk;  /**< Free disk capacity (in MB)*/
 
     map<int, long long> ds_free_disk; /**< Free MB for local system DS */
@@ -119,7 +119,7 @@ public:
      *  Return VM usage requirments
      */
     void get_requirements(int& cpu, int& memory, long long& disk,
-        vector<VectorAttribute *> &pci);
+        vector<VectorAttribute *> &pci, vector<VectorAttribute *> &nodes);
 
     /**
      *  Return the requirements of this VM (as is) and reset them
@@ -38,27 +38,38 @@ const char *HostXML::host_paths[] = {
 
 void HostXML::init_attributes()
 {
-    xpath(oid,         "/HOST/ID",                     -1);
-    xpath(cluster_id,  "/HOST/CLUSTER_ID",             -1);
-    xpath<long long>(mem_usage, "/HOST/HOST_SHARE/MEM_USAGE",   0);
-    xpath<long long>(cpu_usage, "/HOST/HOST_SHARE/CPU_USAGE",   0);
-    xpath<long long>(max_mem,   "/HOST/HOST_SHARE/MAX_MEM",     0);
-    xpath<long long>(max_cpu,   "/HOST/HOST_SHARE/MAX_CPU",     0);
-    xpath<long long>(free_disk, "/HOST/HOST_SHARE/FREE_DISK",   0);
-    xpath<long long>(running_vms, "/HOST/HOST_SHARE/RUNNING_VMS", 0);
+    ObjectXMLDecoder dec;
 
     string public_cloud_st;
 
-    xpath(public_cloud_st, "/HOST/TEMPLATE/PUBLIC_CLOUD", "");
-    public_cloud = (one_util::toupper(public_cloud_st) == "YES");
-
-    //-------------------- HostShare Datastores ------------------------------
     vector<string> ds_ids;
     vector<string> ds_free;
 
-    xpaths(ds_ids, "/HOST/HOST_SHARE/DATASTORES/DS/ID");
-    xpaths(ds_free,"/HOST/HOST_SHARE/DATASTORES/DS/FREE_MB");
+    xmlNodePtr pci_node;
+    xmlNodePtr numa_node;
+
+    dec.bind("/HOST/ID",         oid,         -1);
+    dec.bind("/HOST/CLUSTER_ID", cluster_id,  -1);
+    dec.bind<long long>("/HOST/HOST_SHARE/MEM_USAGE",   mem_usage,   0);
+    dec.bind<long long>("/HOST/HOST_SHARE/CPU_USAGE",   cpu_usage,   0);
+    dec.bind<long long>("/HOST/HOST_SHARE/MAX_MEM",     max_mem,     0);
+    dec.bind<long long>("/HOST/HOST_SHARE/MAX_CPU",     max_cpu,     0);
+    dec.bind<long long>("/HOST/HOST_SHARE/FREE_DISK",   free_disk,   0);
+    dec.bind<long long>("/HOST/HOST_SHARE/RUNNING_VMS", running_vms, 0);
+
+    dec.bind("/HOST/TEMPLATE/PUBLIC_CLOUD", public_cloud_st, "");
+
+    dec.bind_all("/HOST/HOST_SHARE/DATASTORES/DS/ID", ds_ids);
+    dec.bind_all("/HOST/HOST_SHARE/DATASTORES/DS/FREE_MB", ds_free);
 
+    dec.bind_node("/HOST/HOST_SHARE/PCI_DEVICES", pci_node);
+    dec.bind_node("/HOST/HOST_SHARE/NUMA_NODES", numa_node);
+
+    decode(dec);
+
+    public_cloud = (one_util::toupper(public_cloud_st) == "YES");
+
+    //-------------------- HostShare Datastores ------------------------------
     int id;
     long long disk;
 
@@ -71,17 +82,15 @@ void HostXML::init_attributes()
     }
 
     //-------------------- HostShare PCI Devices ------------------------------
-    vector<xmlNodePtr> content;
-
-    get_nodes("/HOST/HOST_SHARE/PCI_DEVICES", content);
-
-    if( !content.empty())
+    if ( pci_node != 0 )
     {
-        pci.from_xml_node(content[0]);
-
-        free_nodes(content);
+        pci.from_xml_node(pci_node);
+    }
 
-        content.clear();
+    //-------------------- HostShare NUMA Nodes -------------------------------
+    if ( numa_node != 0 )
+    {
+        numa.from_xml_node(numa_node);
     }
 
     //-------------------- Init search xpath routes ---------------------------
@@ -93,45 +102,42 @@ void HostXML::init_attributes()
 /* -------------------------------------------------------------------------- */
 
 bool HostXML::test_capacity(long long cpu, long long mem,
-    vector<VectorAttribute *>& p, string & error)
+    vector<VectorAttribute *>& p, vector<VectorAttribute *>& nodes,
+    string & error)
 {
-    bool pci_fits = pci.test(p);
-    bool fits     = ((max_cpu  - cpu_usage ) >= cpu) &&
-                    ((max_mem  - mem_usage ) >= mem) &&
-                    pci_fits;
+    bool pci_fits  = pci.test(p);
+    bool numa_fits = numa.test(nodes);
+    bool fits      = ((max_cpu  - cpu_usage ) >= cpu) &&
+                     ((max_mem  - mem_usage ) >= mem) &&
+                     pci_fits && numa_fits;
     if (!fits)
     {
-        if (NebulaLog::log_level() >= Log::DDEBUG)
+        if ( !pci_fits )
         {
-            if ( pci_fits )
-            {
-                ostringstream oss;
-
-                oss << "Not enough capacity. "
-                    << "Requested: "
-                    << cpu << " CPU, "
-                    << mem << " KB MEM; "
-                    << "Available: "
-                    << (max_cpu  - cpu_usage ) << " CPU, "
-                    << (max_mem  - mem_usage ) << " KB MEM";
-
-                error = oss.str();
-            }
-            else
-            {
-                error = "Unavailable PCI device.";
-            }
+            error = "Unavailable PCI device.";
+        }
+        else if ( !numa_fits )
+        {
+            error = "Not enough free CPUs, memory or hugepages in the host "
+                "NUMA nodes.";
+        }
+        else if (NebulaLog::log_level() >= Log::DDEBUG)
+        {
+            ostringstream oss;
+
+            oss << "Not enough capacity. "
+                << "Requested: "
+                << cpu << " CPU, "
+                << mem << " KB MEM; "
+                << "Available: "
+                << (max_cpu  - cpu_usage ) << " CPU, "
+                << (max_mem  - mem_usage ) << " KB MEM";
+
+            error = oss.str();
         }
         else
         {
-            if ( pci_fits )
-            {
-                error = "Not enough capacity.";
-            }
-            else
-            {
-                error = "Unavailable PCI device.";
-            }
+            error = "Not enough capacity.";
         }
     }
 
@@ -51,6 +51,7 @@ int VirtualMachinePoolXML::set_up()
                 int cpu, mem;
                 long long disk;
                 vector<VectorAttribute *> pci;
+                vector<VectorAttribute *> nodes;
 
                 string action = "DEPLOY";
 
@@ -58,7 +59,7 @@ int VirtualMachinePoolXML::set_up()
 
                 vm = static_cast<VirtualMachineXML *>(it->second);
 
-                vm->get_requirements(cpu, mem, disk, pci);
+                vm->get_requirements(cpu, mem, disk, pci, nodes);
 
                 if (vm->is_resched())
                 {
@@ -229,13 +229,16 @@ void VirtualMachineXML::reset_requirements(float& c, int& m, long long& d)
 /* -------------------------------------------------------------------------- */
 
 void VirtualMachineXML::get_requirements (int& cpu, int& memory,
-    long long& disk, vector<VectorAttribute *> &pci)
+    long long& disk, vector<VectorAttribute *> &pci,
+    vector<VectorAttribute *> &nodes)
 {
     pci.clear();
+    nodes.clear();
 
     if (vm_template != 0)
     {
         vm_template->get("PCI", pci);
+        vm_template->get("NUMA_NODE", nodes);
     }
 
     if (this->memory == 0 || this->cpu == 0)
@@ -500,6 +500,7 @@ int Scheduler::set_up_pools()
  *  @param vm_memory vm requirement
  *  @param vm_cpu vm requirement
  *  @param vm_pci vm requirement
+ *  @param vm_nodes vm requirement (virtual NUMA nodes)
  *  @param host to evaluate vm assgiment
  *  @param n_auth number of hosts authorized for the user, incremented if needed
  *  @param n_error number of requirement errors, incremented if needed
@@ -509,7 +510,8 @@ int Scheduler::set_up_pools()
  *  @return true for a positive match
  */
 static bool match_host(AclXML * acls, UserPoolXML * upool, VirtualMachineXML* vm,
-    int vmem, int vcpu, vector<VectorAttribute *>& vpci, HostXML * host,
+    int vmem, int vcpu, vector<VectorAttribute *>& vpci,
+    vector<VectorAttribute *>& vnodes, HostXML * host,
     int &n_auth, int& n_error, int &n_fits, int &n_matched, string &error)
 {
     // -------------------------------------------------------------------------
@@ -563,7 +565,7 @@ static bool match_host(AclXML * acls, UserPoolXML * upool, VirtualMachineXML* vm
     // -------------------------------------------------------------------------
     // Check host capacity
     // -------------------------------------------------------------------------
-    if (host->test_capacity(vcpu, vmem, vpci, error) != true)
+    if (host->test_capacity(vcpu, vmem, vpci, vnodes, error) != true)
     {
         return false;
     }
@@ -736,6 +738,7 @@ void Scheduler::match_schedule()
     int vm_cpu;
     long long vm_disk;
     vector<VectorAttribute *> vm_pci;
+    vector<VectorAttribute *> vm_nodes;
 
     int n_resources;
     int n_matched;
@@ -770,7 +773,7 @@ void Scheduler::match_schedule()
     {
         vm = static_cast<VirtualMachineXML*>(vm_it->second);
 
-        vm->get_requirements(vm_cpu, vm_memory, vm_disk, vm_pci);
+        vm->get_requirements(vm_cpu, vm_memory, vm_disk, vm_pci, vm_nodes);
 
         n_resources = 0;
         n_fits    = 0;
@@ -810,8 +813,8 @@ void Scheduler::match_schedule()
         {
             host = static_cast<HostXML *>(obj_it->second);
 
-            if (match_host(acls, upool, vm, vm_memory, vm_cpu, vm_pci, host,
-                    n_auth, n_error, n_fits, n_matched, m_error))
+            if (match_host(acls, upool, vm, vm_memory, vm_cpu, vm_pci, vm_nodes,
+                    host, n_auth, n_error, n_fits, n_matched, m_error))
             {
                 vm->add_match_host(host->get_hid());
 
@@ -1070,6 +1073,7 @@ void Scheduler::dispatch()
     int cpu, mem;
     long long dsk;
     vector<VectorAttribute *> pci;
+    vector<VectorAttribute *> nodes;
 
     int hid, dsid, cid;
 
@@ -1123,7 +1127,7 @@ void Scheduler::dispatch()
             }
         }
 
-        vm->get_requirements(cpu, mem, dsk, pci);
+        vm->get_requirements(cpu, mem, dsk, pci, nodes);
 
         //----------------------------------------------------------------------
         // Get the highest ranked host and best System DS for it
@@ -1169,7 +1173,7 @@ void Scheduler::dispatch()
             //------------------------------------------------------------------
             // Test host capacity
             //------------------------------------------------------------------
-            if (host->test_capacity(cpu, mem, pci) != true)
+            if (host->test_capacity(cpu, mem, pci, nodes) != true)
             {
                 continue;
             }
@@ -1329,7 +1333,7 @@ void Scheduler::dispatch()
             //------------------------------------------------------------------
             // Update usage and statistics counters
             //------------------------------------------------------------------
-            host->add_capacity(vm->get_oid(), cpu, mem, pci);
+            host->add_capacity(vm->get_oid(), cpu, mem, pci, nodes);
 
             dispatched_vms++;
 
@@ -14,6 +14,8 @@
 /* limitations under the License.                                             */
 /* -------------------------------------------------------------------------- */
 
+#include <zlib.h>
+
 #include "LogDB.h"
 #include "Nebula.h"
 #include "NebulaUtil.h"
@@ -31,6 +33,11 @@ const char * LogDB::db_bootstrap = "CREATE TABLE IF NOT EXISTS "
     "logdb (log_index INTEGER PRIMARY KEY, term INTEGER, sqlcmd MEDIUMTEXT, "
     "timestamp INTEGER)";
 
+const char * LogDB::local_tables[] = { "logdb", "db_versioning",
+    "local_db_versioning", "vm_monitoring", "host_monitoring", 0 };
+
+const std::string LogDB::snapshot_sql = "-- SNAPSHOT --";
+
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
@@ -80,6 +87,8 @@ LogDB::LogDB(SqlDB * _db, bool _solo, unsigned int _lret):solo(_solo), db(_db),
 
     pthread_mutex_init(&mutex, 0);
 
+    pthread_cond_init(&applied_cond, 0);
+
     LogDBRecord lr;
 
     if ( get_log_record(0, lr) != 0 )
@@ -209,6 +218,56 @@ void LogDB::get_last_record_index(unsigned int& _i, unsigned int& _t)
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+unsigned int LogDB::get_last_applied()
+{
+    unsigned int _last_applied;
+
+    pthread_mutex_lock(&mutex);
+
+    _last_applied = last_applied;
+
+    pthread_mutex_unlock(&mutex);
+
+    return _last_applied;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+int LogDB::wait_applied(unsigned int index, long long timeout_ms)
+{
+    struct timespec timeout;
+
+    int rc = 0;
+
+    clock_gettime(CLOCK_REALTIME, &timeout);
+
+    timeout.tv_sec  += timeout_ms / 1000;
+    timeout.tv_nsec += (timeout_ms % 1000) * 1000000;
+
+    if ( timeout.tv_nsec >= 1000000000 )
+    {
+        timeout.tv_sec  += 1;
+        timeout.tv_nsec -= 1000000000;
+    }
+
+    pthread_mutex_lock(&mutex);
+
+    while ( last_applied < index && rc == 0 )
+    {
+        rc = pthread_cond_timedwait(&applied_cond, &mutex, &timeout);
+    }
+
+    rc = last_applied < index ? -1 : 0;
+
+    pthread_mutex_unlock(&mutex);
+
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 int LogDB::get_raft_state(std::string &raft_xml)
 {
     ostringstream oss;
@@ -255,10 +314,9 @@ int LogDB::update_raft_state(std::string& raft_xml)
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-int LogDB::insert(int index, int term, const std::string& sql, time_t tstamp)
+int LogDB::insert_sql(int index, int term, const std::string& sql,
+        time_t tstamp, std::ostringstream& oss)
 {
-    std::ostringstream oss;
-
     std::string * zsql;
 
     zsql = one_util::zlib_compress(sql, true);
@@ -280,6 +338,22 @@ int LogDB::insert(int index, int term, const std::string& sql, time_t tstamp)
     oss << "INSERT INTO " << table << " ("<< db_names <<") VALUES ("
         << index << "," << term << "," << "'" << sql_db << "'," << tstamp<< ")";
 
+    db->free_str(sql_db);
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int LogDB::insert(int index, int term, const std::string& sql, time_t tstamp)
+{
+    std::ostringstream oss;
+
+    if ( insert_sql(index, term, sql, tstamp, oss) != 0 )
+    {
+        return -1;
+    }
+
     int rc = db->exec_wr(oss);
 
     if ( rc != 0 )
@@ -298,8 +372,6 @@ int LogDB::insert(int index, int term, const std::string& sql, time_t tstamp)
         }
     }
 
-    db->free_str(sql_db);
-
     return rc;
 }
 
@@ -327,6 +399,8 @@ int LogDB::apply_log_record(LogDBRecord * lr)
         }
 
         last_applied = lr->index;
+
+        pthread_cond_broadcast(&applied_cond);
     }
 
     return rc;
@@ -544,6 +618,337 @@ int LogDB::purge_log()
     return rc;
 }
 
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+/* DB Snapshots. The snapshot file is a zlib stream of SQL commands, each one */
+/* preceded by its length: "<length>\n<command>"                              */
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Dumps the rows of a table, read from a DB view, as INSERT commands in the
+ *  snapshot file. The DB is only used to escape the values.
+ */
+class SnapshotWriter : public Callbackable
+{
+public:
+    SnapshotWriter(SqlDB * _db, SqlSnapshot * _view, gzFile _file):db(_db),
+        view(_view), file(_file), error(0){};
+
+    int write(const std::string& cmd)
+    {
+        std::ostringstream oss;
+
+        oss << cmd.size() << "\n" << cmd;
+
+        const std::string& record = oss.str();
+
+        if ( gzwrite(file, record.c_str(), record.size()) !=
+                static_cast<int>(record.size()) )
+        {
+            error = -1;
+        }
+
+        return error;
+    }
+
+    int dump(const std::string& _table)
+    {
+        std::ostringstream oss;
+
+        table = _table;
+
+        if ( write("DELETE FROM " + table) != 0 )
+        {
+            return -1;
+        }
+
+        oss << "SELECT * FROM " << table;
+
+        set_callback(static_cast<Callbackable::Callback>(&SnapshotWriter::row));
+
+        int rc = view->exec_rd(oss, this);
+
+        unset_callback();
+
+        return rc + error;
+    }
+
+private:
+    SqlDB *     db;
+
+    SqlSnapshot * view;
+
+    gzFile      file;
+
+    std::string table;
+
+    int         error;
+
+    int row(void *nil, int num, char **values, char **names)
+    {
+        std::ostringstream oss;
+
+        oss << "INSERT INTO " << table << " (";
+
+        for (int i = 0; i < num; ++i)
+        {
+            oss << (i == 0 ? "" : ",") << names[i];
+        }
+
+        oss << ") VALUES (";
+
+        for (int i = 0; i < num; ++i)
+        {
+            oss << (i == 0 ? "" : ",");
+
+            if ( values[i] == 0 )
+            {
+                oss << "NULL";
+                continue;
+            }
+
+            char * value = db->escape_str(values[i]);
+
+            if ( value == 0 )
+            {
+                error = -1;
+                return -1;
+            }
+
+            oss << "'" << value << "'";
+
+            db->free_str(value);
+        }
+
+        oss << ")";
+
+        return write(oss.str());
+    }
+};
+
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Reads the SQL commands from the snapshot file, followed by the commands
+ *  to reset the log
+ */
+class SnapshotReader : public SqlCommandReader
+{
+public:
+    SnapshotReader(gzFile _file, const std::vector<std::string>& _tail):
+        file(_file), file_eof(false), tail(_tail), tail_pos(0){};
+
+    int next(string& cmd)
+    {
+        if ( !file_eof )
+        {
+            int rc = read(cmd);
+
+            if ( rc != 1 )
+            {
+                return rc;
+            }
+
+            file_eof = true;
+        }
+
+        if ( tail_pos < tail.size() )
+        {
+            cmd = tail[tail_pos++];
+            return 0;
+        }
+
+        return 1;
+    }
+
+private:
+    gzFile file;
+
+    bool   file_eof;
+
+    const std::vector<std::string>& tail;
+
+    std::size_t tail_pos;
+
+    int read(string& cmd)
+    {
+        std::size_t length = 0;
+        int         c;
+        bool        empty = true;
+
+        while ( (c = gzgetc(file)) != '\n' )
+        {
+            if ( c == -1 )
+            {
+                return empty ? 1 : -1;
+            }
+            else if ( c < '0' || c > '9' )
+            {
+                return -1;
+            }
+
+            length = length * 10 + (c - '0');
+            empty  = false;
+        }
+
+        cmd.resize(length);
+
+        if ( length == 0 )
+        {
+            return 0;
+        }
+
+        if ( gzread(file, &cmd[0], length) != static_cast<int>(length) )
+        {
+            return -1;
+        }
+
+        return 0;
+    }
+};
+
+/* -------------------------------------------------------------------------- */
+
+int LogDB::create_snapshot(const std::string& file, unsigned int& index,
+        unsigned int& term)
+{
+    std::vector<std::string> tables;
+    std::vector<std::string>::iterator it;
+
+    LogDBRecord lr;
+
+    SqlSnapshot * view = 0;
+
+    gzFile zfile = gzopen(file.c_str(), "wb");
+
+    if ( zfile == 0 )
+    {
+        return -1;
+    }
+
+    // Records are applied with the mutex held, so the DB view opened here is
+    // consistent with last_applied. Rows are dumped after releasing it.
+    pthread_mutex_lock(&mutex);
+
+    int rc = db->table_names(tables);
+
+    if ( rc == 0 )
+    {
+        rc = get_log_record(last_applied, lr);
+    }
+
+    if ( rc == 0 && last_applied > 0 )
+    {
+        index = last_applied;
+        term  = lr.term;
+
+        view = db->open_snapshot();
+    }
+
+    pthread_mutex_unlock(&mutex);
+
+    if ( view != 0 )
+    {
+        SnapshotWriter writer(db, view, zfile);
+
+        for ( it = tables.begin() ; it != tables.end() && rc == 0; ++it )
+        {
+            bool local = false;
+
+            for (int i = 0; local_tables[i] != 0 ; ++i)
+            {
+                if ( *it == local_tables[i] )
+                {
+                    local = true;
+                    break;
+                }
+            }
+
+            if ( !local )
+            {
+                rc = writer.dump(*it);
+            }
+        }
+
+        delete view;
+    }
+    else
+    {
+        rc = -1;
+    }
+
+    if ( gzclose(zfile) != Z_OK )
+    {
+        rc = -1;
+    }
+
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int LogDB::install_snapshot(const std::string& file, unsigned int index,
+        unsigned int term)
+{
+    std::vector<std::string> log_cmds;
+    std::ostringstream oss;
+
+    if ( index == 0 )
+    {
+        return -1;
+    }
+
+    // -------------------------------------------------------------------------
+    // The log is reset to the snapshot index. Records index - 1 and index are
+    // kept so the consistency check of the next record can be performed
+    // -------------------------------------------------------------------------
+    oss << "DELETE FROM " << table << " WHERE log_index >= 0";
+
+    log_cmds.push_back(oss.str());
+
+    for (unsigned int i = index - 1; i <= index; ++i)
+    {
+        oss.str("");
+
+        if ( insert_sql(i, term, snapshot_sql, time(0), oss) != 0 )
+        {
+            return -1;
+        }
+
+        log_cmds.push_back(oss.str());
+    }
+
+    gzFile zfile = gzopen(file.c_str(), "rb");
+
+    if ( zfile == 0 )
+    {
+        return -1;
+    }
+
+    SnapshotReader reader(zfile, log_cmds);
+
+    pthread_mutex_lock(&mutex);
+
+    int rc = db->exec_transaction(reader);
+
+    if ( rc == 0 )
+    {
+        last_applied = index;
+        last_index   = index;
+        last_term    = term;
+        next_index   = index + 1;
+
+        pthread_cond_broadcast(&applied_cond);
+    }
+
+    pthread_mutex_unlock(&mutex);
+
+    gzclose(zfile);
+
+    return rc;
+}
+
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
@@ -139,7 +139,174 @@ bool MySqlDB::multiple_values_support()
 
 /* -------------------------------------------------------------------------- */
 
+int MySqlDB::index_exists(const string& table, const string& name)
+{
+    ostringstream  oss;
+    single_cb<int> cb;
+
+    int count = 0;
+
+    oss << "SELECT COUNT(*) FROM information_schema.statistics WHERE "
+        << "table_schema = DATABASE() AND table_name = '" << table << "' AND "
+        << "index_name = '" << name << "'";
+
+    cb.set_callback(&count);
+
+    int rc = exec(oss, &cb, false);
+
+    cb.unset_callback();
+
+    if ( rc != 0 )
+    {
+        return -1;
+    }
+
+    return count > 0 ? 1 : 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int MySqlDB::table_names(vector<string>& tables)
+{
+    ostringstream oss;
+
+    vector_cb<string> cb;
+
+    oss << "SHOW TABLES";
+
+    cb.set_callback(&tables);
+
+    int rc = exec(oss, &cb, false);
+
+    cb.unset_callback();
+
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int MySqlDB::exec_transaction(SqlCommandReader& cmds)
+{
+    string cmd;
+    int    rc;
+
+    MYSQL * db = get_db_connection();
+
+    if ( mysql_query(db, "START TRANSACTION") != 0 )
+    {
+        rc = -1;
+    }
+    else
+    {
+        while ( (rc = cmds.next(cmd)) == 0 )
+        {
+            if ( mysql_real_query(db, cmd.c_str(), cmd.size()) != 0 )
+            {
+                rc = -1;
+                break;
+            }
+        }
+    }
+
+    if ( rc == -1 )
+    {
+        ostringstream oss;
+
+        oss << "Transaction rolled back, error " << mysql_errno(db) << " : "
+            << mysql_error(db);
+
+        NebulaLog::log("ONE", Log::ERROR, oss);
+
+        mysql_query(db, "ROLLBACK");
+
+        free_db_connection(db);
+
+        return -1;
+    }
+
+    rc = mysql_query(db, "COMMIT");
+
+    free_db_connection(db);
+
+    return rc == 0 ? 0 : -1;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Consistent view of a MySQL DB, it uses its own connection with an open
+ *  transaction. The transaction is rolled back and the connection closed when
+ *  the view is deleted.
+ */
+class MySqlSnapshot : public SqlSnapshot
+{
+public:
+    MySqlSnapshot(MySqlDB * _mysql, MYSQL * _db):mysql(_mysql), db(_db){};
+
+    ~MySqlSnapshot()
+    {
+        mysql_query(db, "ROLLBACK");
+
+        mysql_close(db);
+    };
+
+    int exec_rd(ostringstream& cmd, Callbackable* obj)
+    {
+        return mysql->exec(db, cmd, obj, false);
+    };
+
+private:
+    MySqlDB * mysql;
+
+    MYSQL *   db;
+};
+
+/* -------------------------------------------------------------------------- */
+
+SqlSnapshot * MySqlDB::open_snapshot()
+{
+    MYSQL * db = mysql_init(NULL);
+
+    MYSQL * rc = mysql_real_connect(db, server.c_str(), user.c_str(),
+            password.c_str(), database.c_str(), port, NULL, 0);
+
+    if ( rc == NULL ||
+         mysql_query(db, "SET SESSION TRANSACTION ISOLATION LEVEL "
+             "REPEATABLE READ") != 0 ||
+         mysql_query(db, "START TRANSACTION WITH CONSISTENT SNAPSHOT") != 0 )
+    {
+        ostringstream oss;
+
+        oss << "Cannot open a DB snapshot, error " << mysql_errno(db) << " : "
+            << mysql_error(db);
+
+        NebulaLog::log("ONE", Log::ERROR, oss);
+
+        mysql_close(db);
+
+        return 0;
+    }
+
+    return new MySqlSnapshot(this, db);
+}
+
+/* -------------------------------------------------------------------------- */
+
 int MySqlDB::exec(ostringstream& cmd, Callbackable* obj, bool quiet)
+{
+    MYSQL * db = get_db_connection();
+
+    int rc = exec(db, cmd, obj, quiet);
+
+    free_db_connection(db);
+
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int MySqlDB::exec(MYSQL * db, ostringstream& cmd, Callbackable* obj,
+        bool quiet)
 {
     int          rc;
 
@@ -151,10 +318,6 @@ int MySqlDB::exec(ostringstream& cmd, Callbackable* obj, bool quiet)
 
     Log::MessageType error_level = quiet ? Log::DDEBUG : Log::ERROR;
 
-    MYSQL *db;
-
-    db = get_db_connection();
-
     rc = mysql_query(db, c_str);
 
     if (rc != 0)
@@ -187,8 +350,6 @@ int MySqlDB::exec(ostringstream& cmd, Callbackable* obj, bool quiet)
 
         NebulaLog::log("ONE",error_level,oss);
 
-        free_db_connection(db);
-
         return -1;
     }
 
@@ -215,9 +376,7 @@ int MySqlDB::exec(ostringstream& cmd, Callbackable* obj, bool quiet)
 
             NebulaLog::log("ONE",error_level,oss);
 
-            free_db_connection(db);
-
-            return -1;
+                return -1;
         }
 
         // Fetch the names of the fields
@@ -243,8 +402,6 @@ int MySqlDB::exec(ostringstream& cmd, Callbackable* obj, bool quiet)
         delete[] names;
     }
 
-    free_db_connection(db);
-
     return 0;
 }
 
@@ -0,0 +1,67 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#include "SqlDB.h"
+#include "NebulaLog.h"
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+int SqlDB::create_indexes(const SqlIndex * indexes)
+{
+    int rc = 0;
+
+    for (const SqlIndex * idx = indexes; idx->name != 0; ++idx)
+    {
+        int exists = index_exists(idx->table, idx->name);
+
+        if ( exists == 1 )
+        {
+            continue;
+        }
+        else if ( exists == -1 )
+        {
+            ostringstream oss;
+
+            oss << "Could not check index " << idx->name << " of table "
+                << idx->table;
+
+            NebulaLog::log("ONE", Log::ERROR, oss);
+
+            rc = -1;
+            continue;
+        }
+
+        ostringstream oss;
+
+        oss << "Index " << idx->name << " (" << idx->columns << ") missing in "
+            << "table " << idx->table << ", creating it.";
+
+        NebulaLog::log("ONE", Log::INFO, oss);
+
+        oss.str("");
+
+        oss << "CREATE INDEX " << idx->name << " ON " << idx->table
+            << " (" << idx->columns << ")";
+
+        if ( exec_local_wr(oss) != 0 )
+        {
+            rc = -1;
+        }
+    }
+
+    return rc;
+}
@@ -76,6 +76,212 @@ bool SqliteDB::multiple_values_support()
 
 /* -------------------------------------------------------------------------- */
 
+int SqliteDB::index_exists(const string& table, const string& name)
+{
+    ostringstream  oss;
+    single_cb<int> cb;
+
+    int count = 0;
+
+    oss << "SELECT COUNT(*) FROM sqlite_master WHERE type = 'index' AND "
+        << "tbl_name = '" << table << "' AND name = '" << name << "'";
+
+    cb.set_callback(&count);
+
+    int rc = exec(oss, &cb, false);
+
+    cb.unset_callback();
+
+    if ( rc != 0 )
+    {
+        return -1;
+    }
+
+    return count > 0 ? 1 : 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int SqliteDB::table_names(vector<string>& tables)
+{
+    ostringstream oss;
+
+    vector_cb<string> cb;
+
+    oss << "SELECT name FROM sqlite_master WHERE type = 'table'";
+
+    cb.set_callback(&tables);
+
+    int rc = exec(oss, &cb, false);
+
+    cb.unset_callback();
+
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int SqliteDB::exec_transaction(SqlCommandReader& cmds)
+{
+    string cmd;
+    int    rc;
+
+    char * err_msg = 0;
+
+    lock();
+
+    if ( sqlite3_exec(db, "BEGIN", 0, 0, &err_msg) != SQLITE_OK )
+    {
+        rc = -1;
+    }
+    else
+    {
+        while ( (rc = cmds.next(cmd)) == 0 )
+        {
+            if ( sqlite3_exec(db, cmd.c_str(), 0, 0, &err_msg) != SQLITE_OK )
+            {
+                rc = -1;
+                break;
+            }
+        }
+    }
+
+    if ( rc == -1 )
+    {
+        ostringstream oss;
+
+        oss << "Transaction rolled back";
+
+        if ( err_msg != 0 )
+        {
+            oss << ", error: " << err_msg;
+
+            sqlite3_free(err_msg);
+        }
+
+        NebulaLog::log("ONE", Log::ERROR, oss);
+
+        sqlite3_exec(db, "ROLLBACK", 0, 0, 0);
+
+        unlock();
+
+        return -1;
+    }
+
+    rc = sqlite3_exec(db, "COMMIT", 0, 0, 0);
+
+    unlock();
+
+    return rc == SQLITE_OK ? 0 : -1;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Consistent view of a SQLite DB, it is a private copy of the DB made with
+ *  the online backup API. The copy is removed when the view is deleted.
+ */
+class SqliteSnapshot : public SqlSnapshot
+{
+public:
+    SqliteSnapshot(sqlite3 * _db):db(_db){};
+
+    ~SqliteSnapshot()
+    {
+        sqlite3_close(db);
+    };
+
+    int exec_rd(ostringstream& cmd, Callbackable* obj)
+    {
+        string str    = cmd.str();
+        char * err_msg = 0;
+
+        int   (*callback)(void*,int,char**,char**) = 0;
+        void * arg = 0;
+
+        if ((obj != 0)&&(obj->isCallBackSet()))
+        {
+            callback = sqlite_callback;
+            arg      = static_cast<void *>(obj);
+        }
+
+        int rc = sqlite3_exec(db, str.c_str(), callback, arg, &err_msg);
+
+        if (rc != SQLITE_OK)
+        {
+            if (err_msg != 0)
+            {
+                ostringstream oss;
+
+                oss << "SQL command was: " << str << ", error: " << err_msg;
+                NebulaLog::log("ONE", Log::ERROR, oss);
+
+                sqlite3_free(err_msg);
+            }
+
+            return -1;
+        }
+
+        return 0;
+    };
+
+private:
+    sqlite3 * db;
+};
+
+/* -------------------------------------------------------------------------- */
+
+SqlSnapshot * SqliteDB::open_snapshot()
+{
+    sqlite3 *        copy;
+    sqlite3_backup * backup;
+
+    int rc;
+
+    // An empty name creates a temporary DB, deleted when it is closed
+    if ( sqlite3_open("", &copy) != SQLITE_OK )
+    {
+        NebulaLog::log("ONE", Log::ERROR, "Cannot open a DB for the snapshot");
+
+        sqlite3_close(copy);
+        return 0;
+    }
+
+    lock();
+
+    backup = sqlite3_backup_init(copy, "main", db, "main");
+
+    if ( backup == 0 )
+    {
+        rc = sqlite3_errcode(copy);
+    }
+    else
+    {
+        sqlite3_backup_step(backup, -1);
+
+        rc = sqlite3_backup_finish(backup);
+    }
+
+    unlock();
+
+    if ( rc != SQLITE_OK )
+    {
+        ostringstream oss;
+
+        oss << "Cannot copy the DB for the snapshot, error: "
+            << sqlite3_errmsg(copy);
+
+        NebulaLog::log("ONE", Log::ERROR, oss);
+
+        sqlite3_close(copy);
+        return 0;
+    }
+
+    return new SqliteSnapshot(copy);
+}
+
+/* -------------------------------------------------------------------------- */
+
 int SqliteDB::exec(ostringstream& cmd, Callbackable* obj, bool quiet)
 {
     int          rc;
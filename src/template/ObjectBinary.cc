@@ -0,0 +1,270 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#include "ObjectBinary.h"
+#include "NebulaUtil.h"
+
+/* -------------------------------------------------------------------------- */
+/* Varint helpers                                                             */
+/* -------------------------------------------------------------------------- */
+
+static void put_varint(string& buffer, unsigned long long value)
+{
+    while ( value >= 0x80 )
+    {
+        buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    buffer.push_back(static_cast<char>(value));
+}
+
+static int get_varint(const string& buffer, size_t& pos,
+        unsigned long long& value)
+{
+    unsigned int shift = 0;
+
+    value = 0;
+
+    while ( pos < buffer.size() && shift < 64 )
+    {
+        unsigned char byte = static_cast<unsigned char>(buffer[pos++]);
+
+        value |= static_cast<unsigned long long>(byte & 0x7F) << shift;
+
+        if ( (byte & 0x80) == 0 )
+        {
+            return 0;
+        }
+
+        shift += 7;
+    }
+
+    return -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* BinaryWriter                                                               */
+/* -------------------------------------------------------------------------- */
+
+void BinaryWriter::put(long long value)
+{
+    unsigned long long zz = (static_cast<unsigned long long>(value) << 1) ^
+        static_cast<unsigned long long>(value >> 63);
+
+    put_varint(buffer, zz);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void BinaryWriter::put(const string& value)
+{
+    put_varint(buffer, value.size());
+
+    buffer.append(value);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void BinaryWriter::put_name(const string& name)
+{
+    map<string, unsigned int>::iterator it = names.find(name);
+
+    if ( it != names.end() )
+    {
+        put_varint(buffer, it->second + 1);
+        return;
+    }
+
+    unsigned int index = names.size();
+
+    names.insert(make_pair(name, index));
+
+    put_varint(buffer, 0);
+
+    put(name);
+}
+
+/* -------------------------------------------------------------------------- */
+/* BinaryReader                                                               */
+/* -------------------------------------------------------------------------- */
+
+int BinaryReader::get(long long& value)
+{
+    unsigned long long zz;
+
+    if ( get_varint(buffer, pos, zz) != 0 )
+    {
+        return -1;
+    }
+
+    value = static_cast<long long>(zz >> 1) ^ -static_cast<long long>(zz & 1);
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int BinaryReader::get(int& value)
+{
+    long long lvalue;
+
+    if ( get(lvalue) != 0 )
+    {
+        return -1;
+    }
+
+    value = static_cast<int>(lvalue);
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int BinaryReader::get(time_t& value)
+{
+    long long lvalue;
+
+    if ( get(lvalue) != 0 )
+    {
+        return -1;
+    }
+
+    value = static_cast<time_t>(lvalue);
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int BinaryReader::get(string& value)
+{
+    unsigned long long size;
+
+    if ( get_varint(buffer, pos, size) != 0 || size > buffer.size() - pos )
+    {
+        return -1;
+    }
+
+    value.assign(buffer, pos, size);
+
+    pos += size;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int BinaryReader::get_name(string& name)
+{
+    unsigned long long index;
+
+    if ( get_varint(buffer, pos, index) != 0 )
+    {
+        return -1;
+    }
+
+    if ( index == 0 )
+    {
+        if ( get(name) != 0 )
+        {
+            return -1;
+        }
+
+        names.push_back(name);
+
+        return 0;
+    }
+
+    if ( index > names.size() )
+    {
+        return -1;
+    }
+
+    name = names[index - 1];
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Body storage                                                               */
+/* -------------------------------------------------------------------------- */
+
+static const string body_prefix = "OBIN:";
+
+bool one_binary::is_binary(const string& body)
+{
+    return body.compare(0, body_prefix.size(), body_prefix) == 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int one_binary::to_body(const BinaryWriter& bw, string& body)
+{
+    string data;
+
+    put_varint(data, bw.stable_size());
+
+    data.append(bw.str());
+
+    string * data64 = one_util::base64_encode(data);
+
+    if ( data64 == 0 )
+    {
+        return -1;
+    }
+
+    body = body_prefix + *data64;
+
+    delete data64;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int one_binary::from_body(const string& body, string& fields, string& stable)
+{
+    unsigned long long stable_size;
+    size_t pos = 0;
+
+    if ( !is_binary(body) )
+    {
+        return -1;
+    }
+
+    string * data = one_util::base64_decode(body.substr(body_prefix.size()));
+
+    if ( data == 0 )
+    {
+        return -1;
+    }
+
+    if ( get_varint(*data, pos, stable_size) != 0 ||
+         stable_size > data->size() - pos )
+    {
+        delete data;
+        return -1;
+    }
+
+    fields.assign(*data, pos, string::npos);
+
+    stable.assign(*data, pos, stable_size);
+
+    delete data;
+
+    return 0;
+}
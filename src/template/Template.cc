@@ -28,7 +28,7 @@
 
 Template::~Template()
 {
-    multimap<string,Attribute *>::iterator  it;
+    FlatMultiMap<string, Attribute *>::iterator  it;
 
     for ( it = attributes.begin(); it != attributes.end(); it++)
     {
@@ -39,21 +39,26 @@ Template::~Template()
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-pthread_mutex_t Template::mutex = PTHREAD_MUTEX_INITIALIZER;
-
 extern "C"
 {
+    #ifndef YY_TYPEDEF_YY_SCANNER_T
+    #define YY_TYPEDEF_YY_SCANNER_T
+    typedef void * yyscan_t;
+    #endif
+
     typedef struct yy_buffer_state * YY_BUFFER_STATE;
 
-    extern FILE *template_in, *template_out;
+    int template_parse(Template * tmpl, yyscan_t scanner, char ** errmsg);
 
-    int template_parse(Template * tmpl, char ** errmsg);
+    int template_lex_init(yyscan_t * scanner);
 
-    int template_lex_destroy();
+    int template_lex_destroy(yyscan_t scanner);
 
-    YY_BUFFER_STATE template__scan_string(const char * str);
+    void template_set_in(FILE * in, yyscan_t scanner);
 
-    void template__delete_buffer(YY_BUFFER_STATE);
+    YY_BUFFER_STATE template__scan_string(const char * str, yyscan_t scanner);
+
+    void template__delete_buffer(YY_BUFFER_STATE, yyscan_t scanner);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -61,35 +66,37 @@ extern "C"
 
 int Template::parse(const char * filename, char **error_msg)
 {
-    int     rc;
-
-    pthread_mutex_lock(&mutex);
+    int      rc;
+    FILE *   file;
+    yyscan_t scanner;
 
     *error_msg = 0;
 
-    template_in = fopen (filename, "r");
+    file = fopen(filename, "r");
 
-    if ( template_in == 0 )
+    if ( file == 0 )
     {
-        goto error_open;
+        *error_msg = strdup("Error opening template file");
+        return -1;
     }
 
-    rc = template_parse(this,error_msg);
-
-    fclose(template_in);
+    if ( template_lex_init(&scanner) != 0 )
+    {
+        fclose(file);
 
-    template_lex_destroy();
+        *error_msg = strdup("Error initializing template scanner");
+        return -1;
+    }
 
-    pthread_mutex_unlock(&mutex);
+    template_set_in(file, scanner);
 
-    return rc;
+    rc = template_parse(this, scanner, error_msg);
 
-error_open:
-    *error_msg = strdup("Error opening template file");
+    template_lex_destroy(scanner);
 
-    pthread_mutex_unlock(&mutex);
+    fclose(file);
 
-    return -1;
+    return rc;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -97,40 +104,35 @@ error_open:
 
 int Template::parse(const string &parse_str, char **error_msg)
 {
-    YY_BUFFER_STATE     str_buffer = 0;
-    const char *        str;
-    int                 rc;
-
-    pthread_mutex_lock(&mutex);
+    YY_BUFFER_STATE str_buffer = 0;
+    yyscan_t        scanner;
+    int             rc;
 
     *error_msg = 0;
 
-    str = parse_str.c_str();
+    if ( template_lex_init(&scanner) != 0 )
+    {
+        *error_msg = strdup("Error initializing template scanner");
+        return -1;
+    }
 
-    str_buffer = template__scan_string(str);
+    str_buffer = template__scan_string(parse_str.c_str(), scanner);
 
     if (str_buffer == 0)
     {
-        goto error_yy;
-    }
+        template_lex_destroy(scanner);
 
-    rc = template_parse(this,error_msg);
+        *error_msg = strdup("Error setting scan buffer");
+        return -1;
+    }
 
-    template__delete_buffer(str_buffer);
+    rc = template_parse(this, scanner, error_msg);
 
-    template_lex_destroy();
+    template__delete_buffer(str_buffer, scanner);
 
-    pthread_mutex_unlock(&mutex);
+    template_lex_destroy(scanner);
 
     return rc;
-
-error_yy:
-
-    *error_msg=strdup("Error setting scan buffer");
-
-    pthread_mutex_unlock(&mutex);
-
-    return -1;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -189,21 +191,24 @@ int Template::parse_str_or_xml(const string &parse_str, string& error_msg)
 
 void Template::marshall(string &str, const char delim)
 {
-    multimap<string,Attribute *>::iterator  it;
-    string *                                attr;
+    FlatMultiMap<string, Attribute *>::iterator it;
 
-    for(it=attributes.begin(),str="";it!=attributes.end();it++)
-    {
-        attr = it->second->marshall();
+    str.clear();
 
-        if ( attr == 0 )
+    for(it=attributes.begin();it!=attributes.end();it++)
+    {
+        // Empty vector attributes are not marshalled
+        if ( it->second->type() == Attribute::VECTOR &&
+             static_cast<VectorAttribute *>(it->second)->value().empty() )
         {
             continue;
         }
 
-        str += it->first + "=" + *attr + delim;
+        str.append(it->first).append(1, '=');
 
-        delete attr;
+        it->second->marshall(str);
+
+        str.append(1, delim);
     }
 }
 
@@ -214,9 +219,9 @@ void Template::set(Attribute * attr)
 {
     if ( replace_mode == true )
     {
-        multimap<string, Attribute *>::iterator         i;
-        pair<multimap<string, Attribute *>::iterator,
-        multimap<string, Attribute *>::iterator>        index;
+        FlatMultiMap<string, Attribute *>::iterator         i;
+        pair<FlatMultiMap<string, Attribute *>::iterator,
+        FlatMultiMap<string, Attribute *>::iterator>        index;
 
         index = attributes.equal_range(attr->name());
 
@@ -236,14 +241,14 @@ void Template::set(Attribute * attr)
 
 int Template::replace(const string& name, const string& value)
 {
-    pair<multimap<string, Attribute *>::iterator,
-         multimap<string, Attribute *>::iterator>   index;
+    pair<FlatMultiMap<string, Attribute *>::iterator,
+         FlatMultiMap<string, Attribute *>::iterator>   index;
 
     index = attributes.equal_range(name);
 
     if (index.first != index.second )
     {
-        multimap<string, Attribute *>::iterator i;
+        FlatMultiMap<string, Attribute *>::iterator i;
 
         for ( i = index.first; i != index.second; i++)
         {
@@ -268,14 +273,14 @@ int Template::replace(const string& name, const bool& value)
 {
     string s_val;
 
-    pair<multimap<string, Attribute *>::iterator,
-         multimap<string, Attribute *>::iterator>   index;
+    pair<FlatMultiMap<string, Attribute *>::iterator,
+         FlatMultiMap<string, Attribute *>::iterator>   index;
 
     index = attributes.equal_range(name);
 
     if (index.first != index.second )
     {
-        multimap<string, Attribute *>::iterator i;
+        FlatMultiMap<string, Attribute *>::iterator i;
 
         for ( i = index.first; i != index.second; i++)
         {
@@ -307,11 +312,11 @@ int Template::replace(const string& name, const bool& value)
 
 int Template::erase(const string& name)
 {
-    multimap<string, Attribute *>::iterator         i;
+    FlatMultiMap<string, Attribute *>::iterator         i;
 
     pair<
-        multimap<string, Attribute *>::iterator,
-        multimap<string, Attribute *>::iterator
+        FlatMultiMap<string, Attribute *>::iterator,
+        FlatMultiMap<string, Attribute *>::iterator
         >                                           index;
     int                                             j;
 
@@ -339,11 +344,11 @@ int Template::erase(const string& name)
 
 Attribute * Template::remove(Attribute * att)
 {
-    multimap<string, Attribute *>::iterator         i;
+    FlatMultiMap<string, Attribute *>::iterator         i;
 
     pair<
-        multimap<string, Attribute *>::iterator,
-        multimap<string, Attribute *>::iterator
+        FlatMultiMap<string, Attribute *>::iterator,
+        FlatMultiMap<string, Attribute *>::iterator
         >                                           index;
 
     index = attributes.equal_range( att->name() );
@@ -409,46 +414,47 @@ bool Template::get(const string& name, bool& value) const
 
 string& Template::to_xml(string& xml) const
 {
-    multimap<string,Attribute *>::const_iterator  it;
-    ostringstream                           oss;
-    string *                                s;
+    xml.clear();
 
-    oss << "<" << xml_root << ">";
+    return append_xml(xml);
+}
 
-    for ( it = attributes.begin(); it!=attributes.end(); it++)
-    {
-        s = it->second->to_xml();
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
 
-        oss << *s;
+string& Template::append_xml(string& buffer) const
+{
+    FlatMultiMap<string, Attribute *>::const_iterator it;
 
-        delete s;
-    }
+    buffer.append(1, '<').append(xml_root).append(1, '>');
 
-    oss << "</" << xml_root << ">";
+    for ( it = attributes.begin(); it!=attributes.end(); it++)
+    {
+        it->second->to_xml(buffer);
+    }
 
-    xml = oss.str();
+    buffer.append("</").append(xml_root).append(1, '>');
 
-    return xml;
+    return buffer;
 }
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
 string& Template::to_str(string& str) const
 {
-    ostringstream os;
-    multimap<string,Attribute *>::const_iterator  it;
-    string *                                s;
+    FlatMultiMap<string, Attribute *>::const_iterator it;
+
+    str.clear();
 
     for ( it = attributes.begin(); it!=attributes.end(); it++)
     {
-        s = it->second->marshall(",");
+        str.append(it->first).append(1, separator);
 
-        os << it->first << separator << *s << endl;
+        it->second->marshall(str, ",");
 
-        delete s;
+        str.append(1, '\n');
     }
 
-    str = os.str();
     return str;
 }
 
@@ -587,9 +593,106 @@ int Template::from_xml_node(const xmlNodePtr node)
 /* ------------------------------------------------------------------------ */
 /* ------------------------------------------------------------------------ */
 
+void Template::to_binary(BinaryWriter& bw) const
+{
+    FlatMultiMap<string, Attribute *>::const_iterator it;
+
+    bw.put(static_cast<long long>(attributes.size()));
+
+    for (it = attributes.begin(); it != attributes.end(); ++it)
+    {
+        bw.put_name(it->first);
+
+        if ( it->second->type() == Attribute::SIMPLE )
+        {
+            SingleAttribute * sattr = static_cast<SingleAttribute *>(it->second);
+
+            bw.put(-1LL);
+            bw.put(sattr->value());
+        }
+        else
+        {
+            VectorAttribute * vattr = static_cast<VectorAttribute *>(it->second);
+
+            const FlatMap<string, string>& values = vattr->value();
+
+            FlatMap<string, string>::const_iterator jt;
+
+            bw.put(static_cast<long long>(values.size()));
+
+            for (jt = values.begin(); jt != values.end(); ++jt)
+            {
+                bw.put_name(jt->first);
+                bw.put(jt->second);
+            }
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------ */
+
+int Template::from_binary(BinaryReader& br)
+{
+    long long num_attrs;
+
+    clear();
+
+    if ( br.get(num_attrs) != 0 )
+    {
+        return -1;
+    }
+
+    for (long long i = 0; i < num_attrs; ++i)
+    {
+        string    name;
+        long long num_values;
+
+        if ( br.get_name(name) != 0 || br.get(num_values) != 0 )
+        {
+            return -1;
+        }
+
+        if ( num_values == -1 )
+        {
+            string value;
+
+            if ( br.get(value) != 0 )
+            {
+                return -1;
+            }
+
+            set(new SingleAttribute(name, value));
+
+            continue;
+        }
+
+        FlatMap<string, string> values;
+
+        for (long long j = 0; j < num_values; ++j)
+        {
+            string vname;
+            string value;
+
+            if ( br.get_name(vname) != 0 || br.get(value) != 0 )
+            {
+                return -1;
+            }
+
+            values.insert(make_pair(vname, value));
+        }
+
+        set(new VectorAttribute(name, values));
+    }
+
+    return 0;
+}
+
+/* ------------------------------------------------------------------------ */
+/* ------------------------------------------------------------------------ */
+
 void Template::merge(const Template * from_tmpl)
 {
-    multimap<string,Attribute *>::const_iterator it;
+    FlatMultiMap<string, Attribute *>::const_iterator it;
 
     for (it = from_tmpl->attributes.begin(); it != from_tmpl->attributes.end(); ++it)
     {
@@ -653,12 +756,12 @@ void Template::set_restricted_attributes(vector<const SingleAttribute *>& rattrs
 /* -------------------------------------------------------------------------- */
 
 static int get_attributes(
-        multimap<string, Attribute *>& attributes,
+        FlatMultiMap<string, Attribute *>& attributes,
         const string& name, vector<const Attribute*>& values)
 {
-    multimap<string, Attribute *>::const_iterator       i;
-    pair<multimap<string, Attribute *>::const_iterator,
-    multimap<string, Attribute *>::const_iterator>      index;
+    FlatMultiMap<string, Attribute *>::const_iterator       i;
+    pair<FlatMultiMap<string, Attribute *>::const_iterator,
+    FlatMultiMap<string, Attribute *>::const_iterator>      index;
     int                                           j;
 
     index = attributes.equal_range(name);
@@ -747,12 +850,12 @@ bool Template::has_restricted()
 /* -------------------------------------------------------------------------- */
 
 static int get_attributes(
-        multimap<string, Attribute *>& attributes,
+        FlatMultiMap<string, Attribute *>& attributes,
         const string& name, vector<Attribute*>& values)
 {
-    multimap<string, Attribute *>::iterator       i;
-    pair<multimap<string, Attribute *>::iterator,
-    multimap<string, Attribute *>::iterator>      index;
+    FlatMultiMap<string, Attribute *>::iterator       i;
+    pair<FlatMultiMap<string, Attribute *>::iterator,
+    FlatMultiMap<string, Attribute *>::iterator>      index;
     int                                           j;
 
     index = attributes.equal_range(name);
@@ -881,7 +984,7 @@ void Template::clear()
         return;
     }
 
-    multimap<string,Attribute *>::iterator it;
+    FlatMultiMap<string, Attribute *>::iterator it;
 
     for ( it = attributes.begin(); it != attributes.end(); it++)
     {
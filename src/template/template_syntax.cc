@@ -90,25 +90,33 @@ extern "C"
 {
     #include "mem_collector.h"
 
+    #ifndef YY_TYPEDEF_YY_SCANNER_T
+    #define YY_TYPEDEF_YY_SCANNER_T
+    typedef void * yyscan_t;
+    #endif
+
     void template__error(
         YYLTYPE *       llocp,
         mem_collector * mc,
+        yyscan_t        scanner,
         Template *      tmpl,
         char **         error_msg,
         const char *    str);
 
-    int template__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc);
+    int template__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc,
+                       yyscan_t scanner);
 
-    int template__parse(mem_collector * mc, Template * tmpl, char ** errmsg);
+    int template__parse(mem_collector * mc, yyscan_t scanner, Template * tmpl,
+                        char ** errmsg);
 
-    int template_parse(Template * tmpl, char ** errmsg)
+    int template_parse(Template * tmpl, yyscan_t scanner, char ** errmsg)
     {
         mem_collector mc;
         int           rc;
 
         mem_collector_init(&mc);
 
-        rc = template__parse(&mc, tmpl, errmsg);
+        rc = template__parse(&mc, scanner, tmpl, errmsg);
 
         mem_collector_cleanup(&mc);
 
@@ -119,7 +127,7 @@ extern "C"
 }
 
 
-#line 123 "template_syntax.cc" /* yacc.c:339  */
+#line 131 "template_syntax.cc" /* yacc.c:339  */
 
 # ifndef YY_NULLPTR
 #  if defined __cplusplus && 201103L <= __cplusplus
@@ -170,12 +178,12 @@ extern int template__debug;
 
 union YYSTYPE
 {
-#line 74 "template_syntax.y" /* yacc.c:355  */
+#line 84 "template_syntax.y" /* yacc.c:355  */
 
     char * val_str;
     void * val_attr;
 
-#line 179 "template_syntax.cc" /* yacc.c:355  */
+#line 187 "template_syntax.cc" /* yacc.c:355  */
 };
 
 typedef union YYSTYPE YYSTYPE;
@@ -199,13 +207,13 @@ struct YYLTYPE
 
 
 
-int template__parse (mem_collector * mc, Template *      tmpl, char **         error_msg);
+int template__parse (mem_collector * mc, yyscan_t        scanner, Template *      tmpl, char **         error_msg);
 
 #endif /* !YY_TEMPLATE_TEMPLATE_SYNTAX_HH_INCLUDED  */
 
 /* Copy the second part of user declarations.  */
 
-#line 209 "template_syntax.cc" /* yacc.c:358  */
+#line 217 "template_syntax.cc" /* yacc.c:358  */
 
 #ifdef short
 # undef short
@@ -505,8 +513,8 @@ static const yytype_uint8 yytranslate[] =
   /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_uint8 yyrline[] =
 {
-       0,    94,    94,    95,    98,    99,   102,   112,   125,   135,
-     141,   154
+       0,   104,   104,   105,   108,   109,   112,   122,   135,   145,
+     151,   164
 };
 #endif
 
@@ -635,7 +643,7 @@ do                                                              \
     }                                                           \
   else                                                          \
     {                                                           \
-      yyerror (&yylloc, mc, tmpl, error_msg, YY_("syntax error: cannot back up")); \
+      yyerror (&yylloc, mc, scanner, tmpl, error_msg, YY_("syntax error: cannot back up")); \
       YYERROR;                                                  \
     }                                                           \
 while (0)
@@ -737,7 +745,7 @@ do {                                                                      \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, Location, mc, tmpl, error_msg); \
+                  Type, Value, Location, mc, scanner, tmpl, error_msg); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -748,12 +756,13 @@ do {                                                                      \
 `----------------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, mem_collector * mc, Template *      tmpl, char **         error_msg)
+yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, mem_collector * mc, yyscan_t        scanner, Template *      tmpl, char **         error_msg)
 {
   FILE *yyo = yyoutput;
   YYUSE (yyo);
   YYUSE (yylocationp);
   YYUSE (mc);
+  YYUSE (scanner);
   YYUSE (tmpl);
   YYUSE (error_msg);
   if (!yyvaluep)
@@ -771,14 +780,14 @@ yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvalue
 `--------------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, mem_collector * mc, Template *      tmpl, char **         error_msg)
+yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, mem_collector * mc, yyscan_t        scanner, Template *      tmpl, char **         error_msg)
 {
   YYFPRINTF (yyoutput, "%s %s (",
              yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
 
   YY_LOCATION_PRINT (yyoutput, *yylocationp);
   YYFPRINTF (yyoutput, ": ");
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp, mc, tmpl, error_msg);
+  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp, mc, scanner, tmpl, error_msg);
   YYFPRINTF (yyoutput, ")");
 }
 
@@ -811,7 +820,7 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule, mem_collector * mc, Template *      tmpl, char **         error_msg)
+yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule, mem_collector * mc, yyscan_t        scanner, Template *      tmpl, char **         error_msg)
 {
   unsigned long int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
@@ -825,7 +834,7 @@ yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule
       yy_symbol_print (stderr,
                        yystos[yyssp[yyi + 1 - yynrhs]],
                        &(yyvsp[(yyi + 1) - (yynrhs)])
-                       , &(yylsp[(yyi + 1) - (yynrhs)])                       , mc, tmpl, error_msg);
+                       , &(yylsp[(yyi + 1) - (yynrhs)])                       , mc, scanner, tmpl, error_msg);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -833,7 +842,7 @@ yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule
 # define YY_REDUCE_PRINT(Rule)          \
 do {                                    \
   if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, mc, tmpl, error_msg); \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, mc, scanner, tmpl, error_msg); \
 } while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
@@ -1091,11 +1100,12 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, mem_collector * mc, Template *      tmpl, char **         error_msg)
+yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, mem_collector * mc, yyscan_t        scanner, Template *      tmpl, char **         error_msg)
 {
   YYUSE (yyvaluep);
   YYUSE (yylocationp);
   YYUSE (mc);
+  YYUSE (scanner);
   YYUSE (tmpl);
   YYUSE (error_msg);
   if (!yymsg)
@@ -1115,7 +1125,7 @@ yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocatio
 `----------*/
 
 int
-yyparse (mem_collector * mc, Template *      tmpl, char **         error_msg)
+yyparse (mem_collector * mc, yyscan_t        scanner, Template *      tmpl, char **         error_msg)
 {
 /* The lookahead symbol.  */
 int yychar;
@@ -1309,7 +1319,7 @@ yybackup:
   if (yychar == YYEMPTY)
     {
       YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = yylex (&yylval, &yylloc, mc);
+      yychar = yylex (&yylval, &yylloc, mc, scanner);
     }
 
   if (yychar <= YYEOF)
@@ -1389,7 +1399,7 @@ yyreduce:
   switch (yyn)
     {
         case 6:
-#line 103 "template_syntax.y" /* yacc.c:1646  */
+#line 113 "template_syntax.y" /* yacc.c:1646  */
     {
                 Attribute * pattr;
                 string      name((yyvsp[-2].val_str));
@@ -1399,28 +1409,28 @@ yyreduce:
 
                 tmpl->set(pattr);
             }
-#line 1403 "template_syntax.cc" /* yacc.c:1646  */
+#line 1413 "template_syntax.cc" /* yacc.c:1646  */
     break;
 
   case 7:
-#line 113 "template_syntax.y" /* yacc.c:1646  */
+#line 123 "template_syntax.y" /* yacc.c:1646  */
     {
                 Attribute * pattr;
                 string      name((yyvsp[-4].val_str));
-                map<string,string> * amap;
+                FlatMap<string,string> * amap;
 
-                amap    = static_cast<map<string,string> *>((yyvsp[-1].val_attr));
+                amap    = static_cast<FlatMap<string,string> *>((yyvsp[-1].val_attr));
                 pattr   = new VectorAttribute(name,*amap);
 
                 tmpl->set(pattr);
 
                 delete amap;
             }
-#line 1420 "template_syntax.cc" /* yacc.c:1646  */
+#line 1430 "template_syntax.cc" /* yacc.c:1646  */
     break;
 
   case 8:
-#line 126 "template_syntax.y" /* yacc.c:1646  */
+#line 136 "template_syntax.y" /* yacc.c:1646  */
     {
                 Attribute * pattr;
                 string      name((yyvsp[-1].val_str));
@@ -1430,53 +1440,53 @@ yyreduce:
 
                 tmpl->set(pattr);
             }
-#line 1434 "template_syntax.cc" /* yacc.c:1646  */
+#line 1444 "template_syntax.cc" /* yacc.c:1646  */
     break;
 
   case 9:
-#line 136 "template_syntax.y" /* yacc.c:1646  */
+#line 146 "template_syntax.y" /* yacc.c:1646  */
     {
                 YYABORT;
             }
-#line 1442 "template_syntax.cc" /* yacc.c:1646  */
+#line 1452 "template_syntax.cc" /* yacc.c:1646  */
     break;
 
   case 10:
-#line 142 "template_syntax.y" /* yacc.c:1646  */
+#line 152 "template_syntax.y" /* yacc.c:1646  */
     {
-                map<string,string>* vattr;
-                string              name((yyvsp[-2].val_str));
-                string              value((yyvsp[0].val_str));
+                FlatMap<string,string>* vattr;
+                string                  name((yyvsp[-2].val_str));
+                string                  value((yyvsp[0].val_str));
 
                 TEMPLATE_TO_UPPER(name);
 
-                vattr = new map<string,string>;
+                vattr = new FlatMap<string,string>;
                 vattr->insert(make_pair(name,unescape(value)));
 
                 (yyval.val_attr) = static_cast<void *>(vattr);
             }
-#line 1459 "template_syntax.cc" /* yacc.c:1646  */
+#line 1469 "template_syntax.cc" /* yacc.c:1646  */
     break;
 
   case 11:
-#line 155 "template_syntax.y" /* yacc.c:1646  */
+#line 165 "template_syntax.y" /* yacc.c:1646  */
     {
-                string               name((yyvsp[-2].val_str));
-                string               value((yyvsp[0].val_str));
-                map<string,string> * attrmap;
+                string                   name((yyvsp[-2].val_str));
+                string                   value((yyvsp[0].val_str));
+                FlatMap<string,string> * attrmap;
 
                 TEMPLATE_TO_UPPER(name);
 
-                attrmap = static_cast<map<string,string> *>((yyvsp[-4].val_attr));
+                attrmap = static_cast<FlatMap<string,string> *>((yyvsp[-4].val_attr));
 
                 attrmap->insert(make_pair(name,unescape(value)));
                 (yyval.val_attr) = (yyvsp[-4].val_attr);
             }
-#line 1476 "template_syntax.cc" /* yacc.c:1646  */
+#line 1486 "template_syntax.cc" /* yacc.c:1646  */
     break;
 
 
-#line 1480 "template_syntax.cc" /* yacc.c:1646  */
+#line 1490 "template_syntax.cc" /* yacc.c:1646  */
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -1527,7 +1537,7 @@ yyerrlab:
     {
       ++yynerrs;
 #if ! YYERROR_VERBOSE
-      yyerror (&yylloc, mc, tmpl, error_msg, YY_("syntax error"));
+      yyerror (&yylloc, mc, scanner, tmpl, error_msg, YY_("syntax error"));
 #else
 # define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
                                         yyssp, yytoken)
@@ -1554,7 +1564,7 @@ yyerrlab:
                 yymsgp = yymsg;
               }
           }
-        yyerror (&yylloc, mc, tmpl, error_msg, yymsgp);
+        yyerror (&yylloc, mc, scanner, tmpl, error_msg, yymsgp);
         if (yysyntax_error_status == 2)
           goto yyexhaustedlab;
       }
@@ -1578,7 +1588,7 @@ yyerrlab:
       else
         {
           yydestruct ("Error: discarding",
-                      yytoken, &yylval, &yylloc, mc, tmpl, error_msg);
+                      yytoken, &yylval, &yylloc, mc, scanner, tmpl, error_msg);
           yychar = YYEMPTY;
         }
     }
@@ -1635,7 +1645,7 @@ yyerrlab1:
 
       yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, yylsp, mc, tmpl, error_msg);
+                  yystos[yystate], yyvsp, yylsp, mc, scanner, tmpl, error_msg);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -1677,7 +1687,7 @@ yyabortlab:
 | yyexhaustedlab -- memory exhaustion comes here.  |
 `-------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (&yylloc, mc, tmpl, error_msg, YY_("memory exhausted"));
+  yyerror (&yylloc, mc, scanner, tmpl, error_msg, YY_("memory exhausted"));
   yyresult = 2;
   /* Fall through.  */
 #endif
@@ -1689,7 +1699,7 @@ yyreturn:
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval, &yylloc, mc, tmpl, error_msg);
+                  yytoken, &yylval, &yylloc, mc, scanner, tmpl, error_msg);
     }
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
@@ -1698,7 +1708,7 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp, yylsp, mc, tmpl, error_msg);
+                  yystos[*yyssp], yyvsp, yylsp, mc, scanner, tmpl, error_msg);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
@@ -1711,7 +1721,7 @@ yyreturn:
 #endif
   return yyresult;
 }
-#line 168 "template_syntax.y" /* yacc.c:1906  */
+#line 178 "template_syntax.y" /* yacc.c:1906  */
 
 
 string& unescape (string &str)
@@ -1729,6 +1739,7 @@ string& unescape (string &str)
 extern "C" void template__error(
     YYLTYPE *       llocp,
     mem_collector * mc,
+    yyscan_t        scanner,
     Template *      tmpl,
     char **         error_msg,
     const char *    str)
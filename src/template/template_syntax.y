@@ -35,25 +35,33 @@ extern "C"
 {
     #include "mem_collector.h"
 
+    #ifndef YY_TYPEDEF_YY_SCANNER_T
+    #define YY_TYPEDEF_YY_SCANNER_T
+    typedef void * yyscan_t;
+    #endif
+
     void template__error(
         YYLTYPE *       llocp,
         mem_collector * mc,
+        yyscan_t        scanner,
         Template *      tmpl,
         char **         error_msg,
         const char *    str);
 
-    int template__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc);
+    int template__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc,
+                       yyscan_t scanner);
 
-    int template__parse(mem_collector * mc, Template * tmpl, char ** errmsg);
+    int template__parse(mem_collector * mc, yyscan_t scanner, Template * tmpl,
+                        char ** errmsg);
 
-    int template_parse(Template * tmpl, char ** errmsg)
+    int template_parse(Template * tmpl, yyscan_t scanner, char ** errmsg)
     {
         mem_collector mc;
         int           rc;
 
         mem_collector_init(&mc);
 
-        rc = template__parse(&mc, tmpl, errmsg);
+        rc = template__parse(&mc, scanner, tmpl, errmsg);
 
         mem_collector_cleanup(&mc);
 
@@ -66,10 +74,12 @@ extern "C"
 %}
 
 %parse-param {mem_collector * mc}
+%parse-param {yyscan_t        scanner}
 %parse-param {Template *      tmpl}
 %parse-param {char **         error_msg}
 
 %lex-param {mem_collector * mc}
+%lex-param {yyscan_t        scanner}
 
 %union {
     char * val_str;
@@ -113,9 +123,9 @@ attribute:  VARIABLE EQUAL STRING
             {
                 Attribute * pattr;
                 string      name($1);
-                map<string,string> * amap;
+                FlatMap<string,string> * amap;
 
-                amap    = static_cast<map<string,string> *>($4);
+                amap    = static_cast<FlatMap<string,string> *>($4);
                 pattr   = new VectorAttribute(name,*amap);
 
                 tmpl->set(pattr);
@@ -140,26 +150,26 @@ attribute:  VARIABLE EQUAL STRING
 
 array_val:  VARIABLE EQUAL STRING
             {
-                map<string,string>* vattr;
-                string              name($1);
-                string              value($3);
+                FlatMap<string,string>* vattr;
+                string                  name($1);
+                string                  value($3);
 
                 TEMPLATE_TO_UPPER(name);
 
-                vattr = new map<string,string>;
+                vattr = new FlatMap<string,string>;
                 vattr->insert(make_pair(name,unescape(value)));
 
                 $$ = static_cast<void *>(vattr);
             }
         |   array_val COMMA VARIABLE EQUAL STRING
             {
-                string               name($3);
-                string               value($5);
-                map<string,string> * attrmap;
+                string                   name($3);
+                string                   value($5);
+                FlatMap<string,string> * attrmap;
 
                 TEMPLATE_TO_UPPER(name);
 
-                attrmap = static_cast<map<string,string> *>($1);
+                attrmap = static_cast<FlatMap<string,string> *>($1);
 
                 attrmap->insert(make_pair(name,unescape(value)));
                 $$ = $1;
@@ -182,6 +192,7 @@ string& unescape (string &str)
 extern "C" void template__error(
     YYLTYPE *       llocp,
     mem_collector * mc,
+    yyscan_t        scanner,
     Template *      tmpl,
     char **         error_msg,
     const char *    str)
@@ -30,7 +30,7 @@ const int Quota::UNLIMITED      = -2;
 int Quota::get_quota(
         const string& id,
         VectorAttribute ** va,
-        map<string, Attribute *>::iterator& it)
+        FlatMultiMap<string, Attribute *>::iterator& it)
 {
     VectorAttribute * q;
 
@@ -315,7 +315,7 @@ void Quota::del_quota(const string& qid, map<string, float>& usage_req)
 void Quota::cleanup_quota(const string& qid)
 {
     VectorAttribute * q;
-    map<string, Attribute *>::iterator q_it;
+    FlatMultiMap<string, Attribute *>::iterator q_it;
 
     float usage, limit, implicit_limit;
 
@@ -46,10 +46,15 @@ bool QuotaVirtualMachine::check(Template * tmpl,
 {
     map<string, float> vm_request;
 
-    int         memory;
+    int         memory, vms;
     float       cpu;
     long long   size;
 
+    if ( tmpl->get("VMS", vms) == false || vms <= 0 )
+    {
+        vms = 1;
+    }
+
     if ( tmpl->get("MEMORY", memory) == false  || memory <= 0 )
     {
         error = "MEMORY attribute must be a positive integer value";
@@ -64,7 +69,7 @@ bool QuotaVirtualMachine::check(Template * tmpl,
 
     size = VirtualMachineDisks::system_ds_size(tmpl);
 
-    vm_request.insert(make_pair("VMS",1));
+    vm_request.insert(make_pair("VMS", vms));
     vm_request.insert(make_pair("MEMORY", memory));
     vm_request.insert(make_pair("CPU", cpu));
     vm_request.insert(make_pair("SYSTEM_DISK_SIZE", size));
@@ -120,17 +120,17 @@ int QuotasSQL::insert_replace(SqlDB *db, bool replace, string& error_str)
         goto error_quota_xml;
     }
 
-    // Construct the SQL statement to Insert or Replace
+    // Updates are group-committed with other quota updates of the table
     if(replace)
     {
-        oss << "REPLACE";
-    }
-    else
-    {
-        oss << "INSERT";
+        rc = ledger().commit(db, oid, sql_quota_xml);
+
+        db->free_str(sql_quota_xml);
+
+        return rc;
     }
 
-    oss << " INTO " << table() << " ("<< table_names() <<") VALUES ("
+    oss << "INSERT INTO " << table() << " ("<< table_names() <<") VALUES ("
         <<          oid             << ","
         << "'" <<   sql_quota_xml   << "')";
 
@@ -171,6 +171,121 @@ int QuotasSQL::drop(SqlDB *db)
     return rc;
 }
 
+/* ************************************************************************** */
+/* QuotasLedger                                                               */
+/* ************************************************************************** */
+
+QuotasLedger::QuotasLedger(const char * _table, const char * _names):
+    table(_table), names(_names), filling(new Batch), writing(false)
+{
+    pthread_mutex_init(&mutex, 0);
+
+    pthread_cond_init(&cond, 0);
+}
+
+/* -------------------------------------------------------------------------- */
+
+QuotasLedger::~QuotasLedger()
+{
+    delete filling;
+
+    pthread_mutex_destroy(&mutex);
+
+    pthread_cond_destroy(&cond);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int QuotasLedger::commit(SqlDB * db, int oid, const string& sql_xml)
+{
+    int rc;
+
+    pthread_mutex_lock(&mutex);
+
+    Batch * batch = filling;
+
+    batch->bodies[oid] = sql_xml;
+    batch->refs++;
+
+    while ( !batch->done )
+    {
+        if ( writing )
+        {
+            pthread_cond_wait(&cond, &mutex);
+            continue;
+        }
+
+        // Write the open batch, new updates go to the next one
+        Batch * wbatch = filling;
+
+        filling = new Batch;
+        writing = true;
+
+        pthread_mutex_unlock(&mutex);
+
+        rc = write(db, wbatch->bodies);
+
+        pthread_mutex_lock(&mutex);
+
+        wbatch->rc   = rc;
+        wbatch->done = true;
+
+        writing = false;
+
+        pthread_cond_broadcast(&cond);
+    }
+
+    rc = batch->rc;
+
+    if ( --batch->refs == 0 )
+    {
+        delete batch;
+    }
+
+    pthread_mutex_unlock(&mutex);
+
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int QuotasLedger::write(SqlDB * db, const map<int, string>& bodies)
+{
+    ostringstream oss;
+    int rc = 0;
+
+    map<int, string>::const_iterator it;
+
+    if (db->multiple_values_support())
+    {
+        oss << "REPLACE INTO " << table << " (" << names << ") VALUES ";
+
+        for (it = bodies.begin(); it != bodies.end(); ++it)
+        {
+            if ( it != bodies.begin() )
+            {
+                oss << ", ";
+            }
+
+            oss << "(" << it->first << ",'" << it->second << "')";
+        }
+
+        return db->exec_wr(oss);
+    }
+
+    for (it = bodies.begin(); it != bodies.end(); ++it)
+    {
+        oss.str("");
+
+        oss << "REPLACE INTO " << table << " (" << names << ") VALUES ("
+            << it->first << ",'" << it->second << "')";
+
+        rc += db->exec_wr(oss);
+    }
+
+    return rc;
+}
+
 /* ************************************************************************** */
 /* UserQuotas :: Database Access Functions                                    */
 /* ************************************************************************** */
@@ -181,6 +296,8 @@ const char * UserQuotas::db_names = "user_oid, body";
 
 const char * UserQuotas::db_oid_column = "user_oid";
 
+QuotasLedger UserQuotas::db_ledger(UserQuotas::db_table, UserQuotas::db_names);
+
 const char * UserQuotas::db_bootstrap =
     "CREATE TABLE IF NOT EXISTS user_quotas ("
     "user_oid INTEGER PRIMARY KEY, body MEDIUMTEXT)";
@@ -195,6 +312,9 @@ const char * GroupQuotas::db_names = "group_oid, body";
 
 const char * GroupQuotas::db_oid_column = "group_oid";
 
+QuotasLedger GroupQuotas::db_ledger(GroupQuotas::db_table,
+        GroupQuotas::db_names);
+
 const char * GroupQuotas::db_bootstrap =
     "CREATE TABLE IF NOT EXISTS group_quotas ("
     "group_oid INTEGER PRIMARY KEY, body MEDIUMTEXT)";
@@ -457,12 +457,12 @@ const char * VirtualMachine::table = "vm_pool";
 
 const char * VirtualMachine::db_names =
     "oid, name, body, uid, gid, last_poll, state, lcm_state, "
-    "owner_u, group_u, other_u";
+    "owner_u, group_u, other_u, short_body";
 
 const char * VirtualMachine::db_bootstrap = "CREATE TABLE IF NOT EXISTS "
     "vm_pool (oid INTEGER PRIMARY KEY, name VARCHAR(128), body MEDIUMTEXT, uid INTEGER, "
     "gid INTEGER, last_poll INTEGER, state INTEGER, lcm_state INTEGER, "
-    "owner_u INTEGER, group_u INTEGER, other_u INTEGER)";
+    "owner_u INTEGER, group_u INTEGER, other_u INTEGER, short_body MEDIUMTEXT)";
 
 
 const char * VirtualMachine::monit_table = "vm_monitoring";
@@ -483,6 +483,29 @@ const char * VirtualMachine::showback_db_bootstrap =
     "(vmid INTEGER, year INTEGER, month INTEGER, body MEDIUMTEXT, "
     "PRIMARY KEY(vmid, year, month))";
 
+
+const char * VirtualMachine::archive_table = "vm_pool_archive";
+
+const char * VirtualMachine::archive_db_names =
+    "oid, name, body, uid, gid, etime, owner_u, group_u, other_u, short_body";
+
+const char * VirtualMachine::archive_db_bootstrap = "CREATE TABLE IF NOT EXISTS "
+    "vm_pool_archive (oid INTEGER PRIMARY KEY, name VARCHAR(128), "
+    "body MEDIUMTEXT, uid INTEGER, gid INTEGER, etime INTEGER, "
+    "owner_u INTEGER, group_u INTEGER, other_u INTEGER, short_body MEDIUMTEXT)";
+
+const SqlIndex VirtualMachine::db_indexes[] = {
+    {"vm_pool_state_idx",   "vm_pool",         "state, lcm_state, last_poll"},
+    {"vm_pool_uid_idx",     "vm_pool",         "uid"},
+    {"vm_pool_gid_idx",     "vm_pool",         "gid"},
+    {"vm_pool_other_idx",   "vm_pool",         "other_u"},
+    {"vm_monit_poll_idx",   "vm_monitoring",   "last_poll"},
+    {"history_etime_idx",   "history",         "etime"},
+    {"history_stime_idx",   "history",         "stime"},
+    {"vm_archive_uid_idx",  "vm_pool_archive", "uid"},
+    {"vm_archive_gid_idx",  "vm_pool_archive", "gid"},
+    {0, 0, 0}};
+
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
@@ -494,12 +517,19 @@ int VirtualMachine::select(SqlDB * db)
     string system_dir;
     int    rc;
     int    last_seq;
+    int    boid = oid;
 
     Nebula& nd = Nebula::instance();
 
     // Rebuild the VirtualMachine object
     rc = PoolObjectSQL::select(db);
 
+    if ( rc != 0 ) // DONE VMs are moved to the archive table
+    {
+        oid = boid;
+        rc  = select_archive(db);
+    }
+
     if( rc != 0 )
     {
         return rc;
@@ -892,6 +922,28 @@ int VirtualMachine::insert(SqlDB * db, string& error_str)
         goto error_pci;
     }
 
+    // ------------------------------------------------------------------------
+    // NUMA topology and CPU pinning
+    // ------------------------------------------------------------------------
+
+    rc = parse_topology(error_str);
+
+    if ( rc != 0 )
+    {
+        goto error_topology;
+    }
+
+    // ------------------------------------------------------------------------
+    // I/O threads and virtio-net queues
+    // ------------------------------------------------------------------------
+
+    rc = parse_io_tuning(error_str);
+
+    if ( rc != 0 )
+    {
+        goto error_io_tuning;
+    }
+
     // ------------------------------------------------------------------------
     // Parse the defaults to merge
     // ------------------------------------------------------------------------
@@ -1092,6 +1144,8 @@ error_one_vms:
 
 error_os:
 error_pci:
+error_topology:
+error_io_tuning:
 error_defaults:
 error_vrouter:
 error_public:
@@ -1476,8 +1530,23 @@ int VirtualMachine::insert_replace(SqlDB *db, bool replace, string& error_str)
     int             rc;
 
     string xml_body;
+    string xml_short;
+    string digest;
     char * sql_name;
     char * sql_xml;
+    char * sql_short;
+
+    if ( state == DONE )
+    {
+        return insert_archive(db, error_str);
+    }
+
+    to_xml(xml_body);
+
+    if ( replace && !body_changed(xml_body, digest) )
+    {
+        return update_last_poll(db);
+    }
 
     sql_name =  db->escape_str(name.c_str());
 
@@ -1486,7 +1555,7 @@ int VirtualMachine::insert_replace(SqlDB *db, bool replace, string& error_str)
         goto error_generic;
     }
 
-    sql_xml = db->escape_str(to_xml(xml_body).c_str());
+    sql_xml = db->escape_str(xml_body.c_str());
 
     if ( sql_xml == 0 )
     {
@@ -1498,6 +1567,13 @@ int VirtualMachine::insert_replace(SqlDB *db, bool replace, string& error_str)
         goto error_xml;
     }
 
+    sql_short = db->escape_str(to_xml_short(xml_short).c_str());
+
+    if ( sql_short == 0 )
+    {
+        goto error_short;
+    }
+
     if(replace)
     {
         oss << "REPLACE";
@@ -1505,6 +1581,7 @@ int VirtualMachine::insert_replace(SqlDB *db, bool replace, string& error_str)
     else
     {
         oss << "INSERT";
+        digest = digest_body(xml_body);
     }
 
     oss << " INTO " << table << " ("<< db_names <<") VALUES ("
@@ -1518,13 +1595,20 @@ int VirtualMachine::insert_replace(SqlDB *db, bool replace, string& error_str)
         <<          lcm_state       << ","
         <<          owner_u         << ","
         <<          group_u         << ","
-        <<          other_u         << ")";
+        <<          other_u         << ","
+        << "'" <<   sql_short       << "')";
 
     db->free_str(sql_name);
     db->free_str(sql_xml);
+    db->free_str(sql_short);
 
     rc = db->exec_wr(oss);
 
+    if ( rc == 0 )
+    {
+        body_written(digest);
+    }
+
     return rc;
 
 error_xml:
@@ -1535,6 +1619,9 @@ error_xml:
 
     goto error_common;
 
+error_short:
+    db->free_str(sql_xml);
+
 error_body:
     db->free_str(sql_name);
     goto error_generic;
@@ -1548,6 +1635,191 @@ error_common:
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+const char * const VirtualMachine::volatile_names[] = { "LAST_POLL", 0 };
+
+/* -------------------------------------------------------------------------- */
+
+int VirtualMachine::update_last_poll(SqlDB *db)
+{
+    ostringstream oss;
+    string        xml_short;
+
+    char * sql_short = db->escape_str(to_xml_short(xml_short).c_str());
+
+    if ( sql_short == 0 )
+    {
+        return -1;
+    }
+
+    oss << "UPDATE " << table << " SET "
+        << "last_poll = "    << last_poll << ", "
+        << "short_body = '"  << sql_short << "' "
+        << "WHERE oid = "    << oid;
+
+    db->free_str(sql_short);
+
+    return db->exec_wr(oss);
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+int VirtualMachine::insert_archive(SqlDB *db, string& error_str)
+{
+    ostringstream oss;
+    int           rc;
+
+    string   xml_body;
+    string   xml_short;
+    string * zbody;
+    char *   sql_name;
+    char *   sql_body;
+    char *   sql_short;
+
+    if ( validate_xml(to_xml(xml_body).c_str()) != 0 )
+    {
+        error_str = "Error transforming the VM to XML.";
+        return -1;
+    }
+
+    zbody = one_util::zlib_compress(xml_body, true);
+
+    if ( zbody == 0 )
+    {
+        goto error_generic;
+    }
+
+    sql_name = db->escape_str(name.c_str());
+
+    if ( sql_name == 0 )
+    {
+        delete zbody;
+        goto error_generic;
+    }
+
+    sql_body = db->escape_str(zbody->c_str());
+
+    delete zbody;
+
+    if ( sql_body == 0 )
+    {
+        db->free_str(sql_name);
+        goto error_generic;
+    }
+
+    sql_short = db->escape_str(to_xml_short(xml_short).c_str());
+
+    if ( sql_short == 0 )
+    {
+        db->free_str(sql_name);
+        db->free_str(sql_body);
+        goto error_generic;
+    }
+
+    oss << "REPLACE INTO " << archive_table << " (" << archive_db_names
+        << ") VALUES ("
+        <<          oid             << ","
+        << "'" <<   sql_name        << "',"
+        << "'" <<   sql_body        << "',"
+        <<          uid             << ","
+        <<          gid             << ","
+        <<          etime           << ","
+        <<          owner_u         << ","
+        <<          group_u         << ","
+        <<          other_u         << ","
+        << "'" <<   sql_short       << "')";
+
+    db->free_str(sql_name);
+    db->free_str(sql_body);
+    db->free_str(sql_short);
+
+    rc = db->exec_wr(oss);
+
+    if ( rc != 0 )
+    {
+        goto error_generic;
+    }
+
+    // The archived copy is written first, so the VM is never lost. Listings
+    // skip it while the VM is still in vm_pool (see VirtualMachinePool::dump)
+    oss.str("");
+
+    oss << "DELETE FROM " << table << " WHERE oid = " << oid;
+
+    if ( db->exec_wr(oss) != 0 )
+    {
+        oss.str("");
+
+        oss << "DELETE FROM " << archive_table << " WHERE oid = " << oid;
+
+        db->exec_wr(oss);
+
+        goto error_generic;
+    }
+
+    return 0;
+
+error_generic:
+    error_str = "Error archiving VM in DB.";
+    return -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+int VirtualMachine::select_archive_cb(void *nil, int num, char **values,
+        char **names)
+{
+    if ( (!values[0]) || (num != 1) )
+    {
+        return -1;
+    }
+
+    string * xml = one_util::zlib_decompress(values[0], true);
+
+    if ( xml == 0 )
+    {
+        return -1;
+    }
+
+    int rc = from_xml(*xml);
+
+    delete xml;
+
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int VirtualMachine::select_archive(SqlDB *db)
+{
+    ostringstream oss;
+    int           rc;
+    int           boid;
+
+    set_callback(
+        static_cast<Callbackable::Callback>(&VirtualMachine::select_archive_cb));
+
+    oss << "SELECT body FROM " << archive_table << " WHERE oid = " << oid;
+
+    boid = oid;
+    oid  = -1;
+
+    rc = db->exec_rd(oss, this);
+
+    unset_callback();
+
+    if ((rc != 0) || (oid != boid ))
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 int VirtualMachine::update_monitoring(SqlDB * db)
 {
     ostringstream oss;
@@ -1716,39 +1988,113 @@ void VirtualMachine::cp_previous_history()
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
-void VirtualMachine::get_requirements (int& cpu, int& memory, int& disk,
-        vector<VectorAttribute *>& pci_devs)
+void VirtualMachine::get_capacity(HostShareCapacity& sr)
 {
-    istringstream   iss;
-    float           fcpu;
+    float fcpu;
+    int   memory;
+
+    sr.vmid = oid;
 
-    pci_devs.clear();
+    sr.pci.clear();
+    sr.nodes.clear();
 
     if ((get_template_attribute("MEMORY",memory) == false) ||
         (get_template_attribute("CPU",fcpu) == false))
     {
-        cpu    = 0;
-        memory = 0;
-        disk   = 0;
+        sr.cpu  = 0;
+        sr.mem  = 0;
+        sr.disk = 0;
 
         return;
     }
 
-    cpu    = (int) (fcpu * 100);//now in 100%
-    memory = memory * 1024;     //now in Kilobytes
-    disk   = 0;
+    sr.cpu  = (int) (fcpu * 100);//now in 100%
+    sr.mem  = memory * 1024;     //now in Kilobytes
+    sr.disk = 0;
 
-    obj_template->get("PCI", pci_devs);
+    obj_template->get("PCI", sr.pci);
+    obj_template->get("NUMA_NODE", sr.nodes);
 
     return;
 }
 
+/* -------------------------------------------------------------------------- */
+
+void VirtualMachine::save_numa_pinning()
+{
+    vector<VectorAttribute *> nodes;
+    vector<VectorAttribute *>::iterator it;
+
+    obj_template->get("NUMA_NODE", nodes);
+
+    for (it = nodes.begin(); it != nodes.end(); ++it)
+    {
+        string node_id = (*it)->vector_value("NODE_ID");
+        string cpus    = (*it)->vector_value("CPUS");
+
+        (*it)->remove("NODE_ID_PREV");
+        (*it)->remove("CPUS_PREV");
+
+        if ( !node_id.empty() )
+        {
+            (*it)->replace("NODE_ID_PREV", node_id);
+        }
+
+        if ( !cpus.empty() )
+        {
+            (*it)->replace("CPUS_PREV", cpus);
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+void VirtualMachine::clear_numa_pinning(bool restore)
+{
+    vector<VectorAttribute *> nodes;
+    vector<VectorAttribute *>::iterator it;
+
+    obj_template->get("NUMA_NODE", nodes);
+
+    for (it = nodes.begin(); it != nodes.end(); ++it)
+    {
+        if ( restore )
+        {
+            string node_id = (*it)->vector_value("NODE_ID_PREV");
+            string cpus    = (*it)->vector_value("CPUS_PREV");
+
+            (*it)->remove("NODE_ID");
+            (*it)->remove("CPUS");
+
+            if ( !node_id.empty() )
+            {
+                (*it)->replace("NODE_ID", node_id);
+            }
+
+            if ( !cpus.empty() )
+            {
+                (*it)->replace("CPUS", cpus);
+            }
+        }
+
+        (*it)->remove("NODE_ID_PREV");
+        (*it)->remove("CPUS_PREV");
+    }
+}
+
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
 int VirtualMachine::check_resize (
         float cpu, int memory, int vcpu, string& error_str)
 {
+    if ((memory > 0 || vcpu > 0) && obj_template->get("NUMA_NODE") != 0)
+    {
+        error_str = "VCPU and MEMORY of a VM with a pinned TOPOLOGY cannot be "
+            "resized.";
+        return -1;
+    }
+
     if (cpu < 0)
     {
         error_str = "CPU must be a positive float or integer value.";
@@ -2005,6 +2351,70 @@ string& VirtualMachine::to_xml_extended(string& xml, int n_history) const
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+string& VirtualMachine::to_xml_short(string& xml) const
+{
+    string perm_xml;
+    string cpu, vcpu, memory, mon_cpu, mon_memory;
+
+    ostringstream oss;
+
+    obj_template->get("CPU", cpu);
+    obj_template->get("VCPU", vcpu);
+    obj_template->get("MEMORY", memory);
+
+    monitoring.get("CPU", mon_cpu);
+    monitoring.get("MEMORY", mon_memory);
+
+    oss << "<VM>"
+        << "<ID>"        << oid       << "</ID>"
+        << "<UID>"       << uid       << "</UID>"
+        << "<GID>"       << gid       << "</GID>"
+        << "<UNAME>"     << uname     << "</UNAME>"
+        << "<GNAME>"     << gname     << "</GNAME>"
+        << "<NAME>"      << name      << "</NAME>"
+        << perms_to_xml(perm_xml)
+        << "<LAST_POLL>" << last_poll << "</LAST_POLL>"
+        << "<STATE>"     << state     << "</STATE>"
+        << "<LCM_STATE>" << lcm_state << "</LCM_STATE>"
+        << "<RESCHED>"   << resched   << "</RESCHED>"
+        << "<STIME>"     << stime     << "</STIME>"
+        << "<ETIME>"     << etime     << "</ETIME>"
+        << "<DEPLOY_ID>" << deploy_id << "</DEPLOY_ID>"
+        << "<MONITORING>"
+        << "<CPU>"       << one_util::escape_xml(mon_cpu)    << "</CPU>"
+        << "<MEMORY>"    << one_util::escape_xml(mon_memory) << "</MEMORY>"
+        << "</MONITORING>"
+        << "<TEMPLATE>"
+        << "<CPU>"       << one_util::escape_xml(cpu)    << "</CPU>"
+        << "<VCPU>"      << one_util::escape_xml(vcpu)   << "</VCPU>"
+        << "<MEMORY>"    << one_util::escape_xml(memory) << "</MEMORY>"
+        << "</TEMPLATE>";
+
+    if ( hasHistory() )
+    {
+        oss << "<HISTORY_RECORDS><HISTORY>"
+            << "<SEQ>"      << history->seq      << "</SEQ>"
+            << "<HOSTNAME>" << history->hostname << "</HOSTNAME>"
+            << "<HID>"      << history->hid      << "</HID>"
+            << "<CID>"      << history->cid      << "</CID>"
+            << "<DS_ID>"    << history->ds_id    << "</DS_ID>"
+            << "</HISTORY></HISTORY_RECORDS>";
+    }
+    else
+    {
+        oss << "<HISTORY_RECORDS/>";
+    }
+
+    oss << "</VM>";
+
+    xml = oss.str();
+
+    return xml;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 int VirtualMachine::from_xml(const string &xml_str)
 {
     vector<xmlNodePtr> content;
@@ -93,3 +93,35 @@ void VirtualMachineStateHook::parse_hook_arguments(PoolObjectSQL * obj,
         parsed.replace(found, 15, VirtualMachine::lcm_state_to_str(str, prev_lcm));
     }
 }
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+
+void VirtualMachineEventHook::do_hook(void *arg)
+{
+    VirtualMachine * vm = static_cast<VirtualMachine *>(arg);
+
+    if ( vm == 0 || !vm->has_changed_state() )
+    {
+        return;
+    }
+
+    HookEvent event("VM", "STATE", vm->get_oid());
+
+    string st;
+
+    event.add("STATE", VirtualMachine::vm_state_to_str(st, vm->get_state()));
+    event.add("LCM_STATE",
+            VirtualMachine::lcm_state_to_str(st, vm->get_lcm_state()));
+    event.add("PREV_STATE",
+            VirtualMachine::vm_state_to_str(st, vm->get_prev_state()));
+    event.add("PREV_LCM_STATE",
+            VirtualMachine::lcm_state_to_str(st, vm->get_prev_lcm_state()));
+
+    if ( vm->hasHistory() )
+    {
+        event.add("HOST", vm->get_hostname());
+    }
+
+    bus.publish(event);
+}
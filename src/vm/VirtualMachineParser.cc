@@ -52,8 +52,6 @@ const char*  VirtualMachine::VROUTER_ATTRIBUTES[] = {
         "VROUTER_KEEPALIVED_PASSWORD"};
 const int VirtualMachine::NUM_VROUTER_ATTRIBUTES = 3;
 
-pthread_mutex_t VirtualMachine::lex_mutex = PTHREAD_MUTEX_INITIALIZER;
-
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 /**
@@ -393,6 +391,191 @@ int VirtualMachine::parse_pci(string& error_str)
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+int VirtualMachine::parse_topology(string& error_str)
+{
+    VectorAttribute * user_topology = user_obj_template->get("TOPOLOGY");
+
+    if ( user_topology == 0 )
+    {
+        return 0;
+    }
+
+    VectorAttribute * topology = new VectorAttribute(user_topology);
+
+    user_obj_template->erase("TOPOLOGY");
+
+    obj_template->set(topology);
+
+    string policy = topology->vector_value("PIN_POLICY");
+
+    one_util::toupper(policy);
+
+    if ( policy.empty() )
+    {
+        policy = "NONE";
+    }
+
+    if ( policy != "NONE" && policy != "PINNED" )
+    {
+        error_str = "Wrong PIN_POLICY in TOPOLOGY, must be NONE or PINNED";
+        return -1;
+    }
+
+    topology->replace("PIN_POLICY", policy);
+
+    // -------------------------------------------------------------------------
+    // Hugepage backed memory, HUGEPAGE_SIZE in MB (2M or 1G pages)
+    // -------------------------------------------------------------------------
+    unsigned long hp_size = 0;
+
+    if ( !topology->vector_value("HUGEPAGE_SIZE").empty() &&
+         (topology->vector_value("HUGEPAGE_SIZE", hp_size) != 0 ||
+          (hp_size != 2 && hp_size != 1024)) )
+    {
+        error_str = "HUGEPAGE_SIZE in TOPOLOGY must be 2 or 1024 (MB)";
+        return -1;
+    }
+
+    if ( policy == "NONE" && hp_size == 0 )
+    {
+        return 0;
+    }
+
+    // -------------------------------------------------------------------------
+    // Split VCPUs and MEMORY in NUMA_NODES, each one placed in a host node.
+    // Hugepages are reserved per node, so they also need a NUMA placement.
+    // -------------------------------------------------------------------------
+    int vcpu   = 1;
+    int memory = 0;
+    int num_nodes = 1;
+
+    obj_template->get("VCPU", vcpu);
+    obj_template->get("MEMORY", memory);
+
+    if ( !topology->vector_value("NUMA_NODES").empty() &&
+         (topology->vector_value("NUMA_NODES", num_nodes) != 0 ||
+          num_nodes <= 0 || num_nodes > vcpu) )
+    {
+        error_str = "NUMA_NODES in TOPOLOGY must be between 1 and VCPU";
+        return -1;
+    }
+
+    topology->replace("NUMA_NODES", num_nodes);
+
+    long long mem_kb = (long long) memory * 1024;
+
+    for (int i = 0; i < num_nodes; ++i)
+    {
+        VectorAttribute * node = new VectorAttribute("NUMA_NODE");
+
+        int       node_cpus = vcpu / num_nodes;
+        long long node_mem  = mem_kb / num_nodes;
+
+        if ( i < vcpu % num_nodes )
+        {
+            node_cpus++;
+        }
+
+        if ( i == num_nodes - 1 )
+        {
+            node_mem += mem_kb % num_nodes;
+        }
+
+        node->replace("TOTAL_CPUS", node_cpus);
+        node->replace("MEMORY", node_mem);
+        node->replace("PIN_POLICY", policy);
+
+        if ( hp_size != 0 )
+        {
+            node->replace("HUGEPAGE_SIZE", hp_size * 1024);
+        }
+
+        obj_template->set(node);
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+int VirtualMachine::parse_io_tuning(string& error_str)
+{
+    vector<VectorAttribute *> attrs;
+    vector<VectorAttribute *>::iterator it;
+
+    int iothreads = -1;
+
+    // -------------------------------------------------------------------------
+    // FEATURES/IOTHREADS, number of I/O threads of the VM
+    // -------------------------------------------------------------------------
+    VectorAttribute * features = user_obj_template->get("FEATURES");
+
+    if ( features != 0 && !features->vector_value("IOTHREADS").empty() &&
+         (features->vector_value("IOTHREADS", iothreads) != 0 || iothreads < 0))
+    {
+        error_str = "IOTHREADS in FEATURES must be a non-negative integer";
+        return -1;
+    }
+
+    // -------------------------------------------------------------------------
+    // DISK/IOTHREAD, I/O thread (1 to IOTHREADS) of the disk
+    // -------------------------------------------------------------------------
+    user_obj_template->get("DISK", attrs);
+
+    for (it = attrs.begin(); it != attrs.end(); ++it)
+    {
+        int iothread;
+
+        if ( (*it)->vector_value("IOTHREAD").empty() )
+        {
+            continue;
+        }
+
+        if ( (*it)->vector_value("IOTHREAD", iothread) != 0 || iothread < 1 ||
+             (iothreads != -1 && iothread > iothreads) )
+        {
+            error_str = "IOTHREAD in DISK must be between 1 and IOTHREADS";
+            return -1;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // NIC/VIRTIO_QUEUES (number or AUTO) and NIC/VHOST (YES or NO)
+    // -------------------------------------------------------------------------
+    attrs.clear();
+
+    user_obj_template->get("NIC", attrs);
+
+    for (it = attrs.begin(); it != attrs.end(); ++it)
+    {
+        string queues = (*it)->vector_value("VIRTIO_QUEUES");
+        string vhost  = (*it)->vector_value("VHOST");
+        int    num;
+
+        one_util::toupper(queues);
+        one_util::toupper(vhost);
+
+        if ( !queues.empty() && queues != "AUTO" &&
+             ((*it)->vector_value("VIRTIO_QUEUES", num) != 0 || num < 1) )
+        {
+            error_str = "VIRTIO_QUEUES in NIC must be AUTO or a positive integer";
+            return -1;
+        }
+
+        if ( !vhost.empty() && vhost != "YES" && vhost != "NO" )
+        {
+            error_str = "VHOST in NIC must be YES or NO";
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 int VirtualMachine::parse_graphics(string& error_str)
 {
     VectorAttribute * user_graphics = user_obj_template->get("GRAPHICS");
@@ -547,21 +730,30 @@ void VirtualMachine::parse_well_known_attributes()
 
 extern "C"
 {
+    #ifndef YY_TYPEDEF_YY_SCANNER_T
+    #define YY_TYPEDEF_YY_SCANNER_T
+    typedef void * yyscan_t;
+    #endif
+
     typedef struct yy_buffer_state * YY_BUFFER_STATE;
 
     int vm_var_parse (VirtualMachine * vm,
+                      yyscan_t         scanner,
                       ostringstream *  parsed,
                       char **          errmsg);
 
     int vm_file_var_parse (VirtualMachine * vm,
+                           yyscan_t         scanner,
                            vector<int> *    img_ids,
                            char **          errmsg);
 
-    int vm_var_lex_destroy();
+    int vm_var_lex_init(yyscan_t * scanner);
+
+    int vm_var_lex_destroy(yyscan_t scanner);
 
-    YY_BUFFER_STATE vm_var__scan_string(const char * str);
+    YY_BUFFER_STATE vm_var__scan_string(const char * str, yyscan_t scanner);
 
-    void vm_var__delete_buffer(YY_BUFFER_STATE);
+    void vm_var__delete_buffer(YY_BUFFER_STATE, yyscan_t scanner);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -571,28 +763,29 @@ int VirtualMachine::parse_template_attribute(const string& attribute,
                                              string&       error_str)
 {
     YY_BUFFER_STATE  str_buffer = 0;
-    const char *     str;
+    yyscan_t         scanner;
     int              rc;
     ostringstream    oss_parsed;
     char *           error_msg = 0;
 
-    pthread_mutex_lock(&lex_mutex);
+    if ( vm_var_lex_init(&scanner) != 0 )
+    {
+        goto error_yy;
+    }
 
-    str        = attribute.c_str();
-    str_buffer = vm_var__scan_string(str);
+    str_buffer = vm_var__scan_string(attribute.c_str(), scanner);
 
     if (str_buffer == 0)
     {
+        vm_var_lex_destroy(scanner);
         goto error_yy;
     }
 
-    rc = vm_var_parse(this, &oss_parsed, &error_msg);
+    rc = vm_var_parse(this, scanner, &oss_parsed, &error_msg);
 
-    vm_var__delete_buffer(str_buffer);
+    vm_var__delete_buffer(str_buffer, scanner);
 
-    vm_var_lex_destroy();
-
-    pthread_mutex_unlock(&lex_mutex);
+    vm_var_lex_destroy(scanner);
 
     if ( rc != 0 && error_msg != 0 )
     {
@@ -612,7 +805,6 @@ int VirtualMachine::parse_template_attribute(const string& attribute,
 
 error_yy:
     log("VM",Log::ERROR,"Error setting scan buffer");
-    pthread_mutex_unlock(&lex_mutex);
     return -1;
 }
 
@@ -623,9 +815,8 @@ int VirtualMachine::parse_file_attribute(string       attribute,
                                          string&      error)
 {
     YY_BUFFER_STATE  str_buffer = 0;
-    const char *     str;
+    yyscan_t         scanner;
     int              rc;
-    ostringstream    oss_parsed;
     char *           error_msg = 0;
 
     size_t non_blank_pos;
@@ -639,23 +830,24 @@ int VirtualMachine::parse_file_attribute(string       attribute,
         attribute.erase(0, non_blank_pos);
     }
 
-    pthread_mutex_lock(&lex_mutex);
+    if ( vm_var_lex_init(&scanner) != 0 )
+    {
+        goto error_yy;
+    }
 
-    str        = attribute.c_str();
-    str_buffer = vm_var__scan_string(str);
+    str_buffer = vm_var__scan_string(attribute.c_str(), scanner);
 
     if (str_buffer == 0)
     {
+        vm_var_lex_destroy(scanner);
         goto error_yy;
     }
 
-    rc = vm_file_var_parse(this, &img_ids, &error_msg);
-
-    vm_var__delete_buffer(str_buffer);
+    rc = vm_file_var_parse(this, scanner, &img_ids, &error_msg);
 
-    vm_var_lex_destroy();
+    vm_var__delete_buffer(str_buffer, scanner);
 
-    pthread_mutex_unlock(&lex_mutex);
+    vm_var_lex_destroy(scanner);
 
     if ( rc != 0  )
     {
@@ -678,6 +870,5 @@ int VirtualMachine::parse_file_attribute(string       attribute,
 
 error_yy:
     log("VM",Log::ERROR,"Error setting scan buffer");
-    pthread_mutex_unlock(&lex_mutex);
     return -1;
 }
@@ -57,7 +57,9 @@ VirtualMachinePool::VirtualMachinePool(
     string on;
     string cmd;
     string arg;
+    string socket;
     bool   remote;
+    int    batch;
 
     if ( _monitor_expiration == 0 )
     {
@@ -72,11 +74,13 @@ VirtualMachinePool::VirtualMachinePool(
         on   = hook_mads[i]->vector_value("ON");
         cmd  = hook_mads[i]->vector_value("COMMAND");
         arg  = hook_mads[i]->vector_value("ARGUMENTS");
+        socket = hook_mads[i]->vector_value("SOCKET");
         hook_mads[i]->vector_value("REMOTE", remote);
 
         one_util::toupper(on);
 
-        if ( on.empty() || cmd.empty() )
+        // STATE hooks can deliver the events to a socket instead of a command
+        if ( on.empty() || (cmd.empty() && (on != "STATE" || socket.empty())) )
         {
             ostringstream oss;
 
@@ -89,10 +93,10 @@ VirtualMachinePool::VirtualMachinePool(
 
         if ( name.empty() )
         {
-            name = cmd;
+            name = cmd.empty() ? socket : cmd;
         }
 
-        if (cmd[0] != '/')
+        if ( !cmd.empty() && cmd[0] != '/' )
         {
             ostringstream cmd_os;
 
@@ -164,6 +168,19 @@ VirtualMachinePool::VirtualMachinePool(
                             VirtualMachine::UNKNOWN, VirtualMachine::ACTIVE);
             add_hook(hook);
         }
+        else if ( on == "STATE" )
+        {
+            VirtualMachineEventHook * hook;
+
+            if ( hook_mads[i]->vector_value("BATCH", batch) != 0 || batch <= 0 )
+            {
+                batch = 100;
+            }
+
+            hook = new VirtualMachineEventHook(name, cmd, arg, socket, batch);
+
+            add_hook(hook);
+        }
         else if ( on == "CUSTOM" )
         {
             VirtualMachineStateHook * hook;
@@ -335,6 +352,73 @@ int VirtualMachinePool::allocate (
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+int VirtualMachinePool::allocate (
+    int                               uid,
+    int                               gid,
+    const string&                     uname,
+    const string&                     gname,
+    int                               umask,
+    vector<VirtualMachineTemplate *>& vm_templates,
+    vector<int>&                      oids,
+    string&                           error_str,
+    bool                              on_hold)
+{
+    vector<VirtualMachineTemplate *>::iterator it;
+    vector<PoolObjectSQL *> vms;
+
+    string deploy_id;
+
+    for (it = vm_templates.begin(); it != vm_templates.end(); ++it)
+    {
+        (*it)->get("IMPORT_VM_ID", deploy_id);
+
+        if (!deploy_id.empty())
+        {
+            for (it = vm_templates.begin(); it != vm_templates.end(); ++it)
+            {
+                delete *it;
+            }
+
+            vm_templates.clear();
+
+            error_str = "Imported VMs cannot be allocated in bulk.";
+            return -1;
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Build the new Virtual Machine objects
+    // ------------------------------------------------------------------------
+    for (it = vm_templates.begin(); it != vm_templates.end(); ++it)
+    {
+        VirtualMachine * vm = new VirtualMachine(-1, uid, gid, uname, gname,
+                umask, *it);
+
+        if ( _submit_on_hold == true || on_hold )
+        {
+            vm->state = VirtualMachine::HOLD;
+
+            vm->user_obj_template->replace("SUBMIT_ON_HOLD", true);
+        }
+        else
+        {
+            vm->state = VirtualMachine::PENDING;
+        }
+
+        vms.push_back(vm);
+    }
+
+    vm_templates.clear();
+
+    // ------------------------------------------------------------------------
+    // Insert the Objects in the pool
+    // ------------------------------------------------------------------------
+    return PoolSQL::allocate(vms, oids, error_str);
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 int VirtualMachinePool::get_running(
     vector<int>&    oids,
     int             vm_limit,
@@ -373,6 +457,166 @@ int VirtualMachinePool::get_pending(
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
+int VirtualMachinePool::dump_archive_cb(void * _oss, int num, char **values,
+        char **names)
+{
+    ostringstream * oss = static_cast<ostringstream *>(_oss);
+
+    if ( num < 2 || values[0] == 0 || values[1] == 0 )
+    {
+        return -1;
+    }
+
+    if ( values[1][0] == '0' )
+    {
+        *oss << values[0];
+        return 0;
+    }
+
+    string * xml = one_util::zlib_decompress(values[0], true);
+
+    if ( xml == 0 )
+    {
+        return -1;
+    }
+
+    *oss << *xml;
+
+    delete xml;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Condition to skip archived VMs still in vm_pool. The VM is removed from
+ *  vm_pool after writing its archived copy, listings use the live row.
+ */
+static void not_in_pool(ostringstream& cmd, const char * pool_table)
+{
+    cmd << "oid NOT IN (SELECT oid FROM " << pool_table << ")";
+}
+
+/* -------------------------------------------------------------------------- */
+
+/**
+ *  Builds the query for the VMs of a table. Each row includes the VM, a flag
+ *  set if it is compressed (archived body) and the VM id.
+ *    @param summary select the VM summary instead of the body
+ */
+static void archive_query(ostringstream& cmd, const char * table, int archived,
+        const string& where, bool summary)
+{
+    if ( summary )
+    {
+        cmd << "SELECT short_body, 0, oid FROM " << table;
+    }
+    else
+    {
+        cmd << "SELECT body, " << archived << ", oid FROM " << table;
+    }
+
+    if ( !where.empty() )
+    {
+        cmd << " WHERE " << where;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+int VirtualMachinePool::dump(ostringstream& oss, const string& where,
+        const string& archive_where, const string& limit, bool summary)
+{
+    ostringstream cmd;
+    ostringstream awhere;
+    int           rc;
+
+    if ( !archive_where.empty() )
+    {
+        awhere << "(" << archive_where << ") AND ";
+    }
+
+    not_in_pool(awhere, VirtualMachine::table);
+
+    archive_query(cmd, VirtualMachine::table, 0, where, summary);
+
+    cmd << " UNION ALL ";
+
+    archive_query(cmd, VirtualMachine::archive_table, 1, awhere.str(),
+            summary);
+
+    cmd << " ORDER BY oid";
+
+    if ( !limit.empty() )
+    {
+        cmd << " LIMIT " << limit;
+    }
+
+    oss << "<VM_POOL>";
+
+    set_callback(static_cast<Callbackable::Callback>(
+                &VirtualMachinePool::dump_archive_cb), static_cast<void *>(&oss));
+
+    rc = db->exec_rd(cmd, this);
+
+    unset_callback();
+
+    oss << "</VM_POOL>";
+
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int VirtualMachinePool::dump_archive(ostringstream& oss, const string& where,
+        const string& limit)
+{
+    ostringstream cmd;
+    int           rc;
+
+    archive_query(cmd, VirtualMachine::archive_table, 1, where, false);
+
+    cmd << " ORDER BY oid";
+
+    if ( !limit.empty() )
+    {
+        cmd << " LIMIT " << limit;
+    }
+
+    oss << "<VM_POOL>";
+
+    set_callback(static_cast<Callbackable::Callback>(
+                &VirtualMachinePool::dump_archive_cb), static_cast<void *>(&oss));
+
+    rc = db->exec_rd(cmd, this);
+
+    unset_callback();
+
+    oss << "</VM_POOL>";
+
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+void VirtualMachinePool::all_vms_table(ostringstream& cmd)
+{
+    const char * cols = "oid, uid, gid, owner_u, group_u, other_u";
+
+    cmd << "(SELECT " << cols << " FROM " << VirtualMachine::table
+        << " UNION ALL SELECT " << cols << " FROM "
+        << VirtualMachine::archive_table << " WHERE ";
+
+    not_in_pool(cmd, VirtualMachine::table);
+
+    cmd << ") vms";
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
 int VirtualMachinePool::dump_acct(ostringstream& oss,
                                   const string&  where,
                                   int            time_start,
@@ -381,8 +625,11 @@ int VirtualMachinePool::dump_acct(ostringstream& oss,
     ostringstream cmd;
 
     cmd << "SELECT " << History::table << ".body FROM " << History::table
-        << " INNER JOIN " << VirtualMachine::table
-        << " WHERE vid=oid";
+        << " INNER JOIN ";
+
+    all_vms_table(cmd);
+
+    cmd << " WHERE vid=oid";
 
     if ( !where.empty() )
     {
@@ -420,9 +667,11 @@ int VirtualMachinePool::dump_showback(ostringstream& oss,
     ostringstream cmd;
 
     cmd << "SELECT " << VirtualMachine::showback_table << ".body FROM "
-        << VirtualMachine::showback_table
-        << " INNER JOIN " << VirtualMachine::table
-        << " WHERE vmid=oid";
+        << VirtualMachine::showback_table << " INNER JOIN ";
+
+    all_vms_table(cmd);
+
+    cmd << " WHERE vmid=oid";
 
     if ( !where.empty() )
     {
@@ -95,22 +95,31 @@ extern "C"
 {
     #include "mem_collector.h"
 
+    #ifndef YY_TYPEDEF_YY_SCANNER_T
+    #define YY_TYPEDEF_YY_SCANNER_T
+    typedef void * yyscan_t;
+    #endif
+
     void vm_file_var__error(
         YYLTYPE *        llocp,
         mem_collector *  mc,
+        yyscan_t         scanner,
         VirtualMachine * vm,
         vector<int> *    img_ids,
         char **          errmsg,
         const char *     str);
 
-    int vm_file_var__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc);
+    int vm_file_var__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc,
+                          yyscan_t scanner);
 
     int vm_file_var__parse (mem_collector *  mc,
+                            yyscan_t         scanner,
                             VirtualMachine * vm,
                             vector<int> *    img_ids,
                             char **          errmsg);
 
     int vm_file_var_parse (VirtualMachine * vm,
+                           yyscan_t         scanner,
                            vector<int> *    img_ids,
                            char **          errmsg)
     {
@@ -119,7 +128,7 @@ extern "C"
 
         mem_collector_init(&mc);
 
-        rc = vm_file_var__parse(&mc, vm, img_ids, errmsg);
+        rc = vm_file_var__parse(&mc, scanner, vm, img_ids, errmsg);
 
         mem_collector_cleanup(&mc);
 
@@ -254,7 +263,7 @@ int get_image_path(VirtualMachine * vm,
 /* -------------------------------------------------------------------------- */
 
 
-#line 258 "vm_file_var_syntax.cc" /* yacc.c:339  */
+#line 267 "vm_file_var_syntax.cc" /* yacc.c:339  */
 
 # ifndef YY_NULLPTR
 #  if defined __cplusplus && 201103L <= __cplusplus
@@ -306,13 +315,13 @@ extern int vm_file_var__debug;
 
 union YYSTYPE
 {
-#line 210 "vm_file_var_syntax.y" /* yacc.c:355  */
+#line 221 "vm_file_var_syntax.y" /* yacc.c:355  */
 
     char * val_str;
     int    val_int;
     char   val_char;
 
-#line 316 "vm_file_var_syntax.cc" /* yacc.c:355  */
+#line 325 "vm_file_var_syntax.cc" /* yacc.c:355  */
 };
 
 typedef union YYSTYPE YYSTYPE;
@@ -336,13 +345,13 @@ struct YYLTYPE
 
 
 
-int vm_file_var__parse (mem_collector *  mc, VirtualMachine * vm, vector<int> *    img_ids, char **          errmsg);
+int vm_file_var__parse (mem_collector *  mc, yyscan_t         scanner, VirtualMachine * vm, vector<int> *    img_ids, char **          errmsg);
 
 #endif /* !YY_VM_FILE_VAR_VM_FILE_VAR_SYNTAX_HH_INCLUDED  */
 
 /* Copy the second part of user declarations.  */
 
-#line 346 "vm_file_var_syntax.cc" /* yacc.c:358  */
+#line 355 "vm_file_var_syntax.cc" /* yacc.c:358  */
 
 #ifdef short
 # undef short
@@ -642,7 +651,7 @@ static const yytype_uint8 yytranslate[] =
   /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_uint16 yyrline[] =
 {
-       0,   234,   234,   235,   239,   257
+       0,   245,   245,   246,   250,   268
 };
 #endif
 
@@ -766,7 +775,7 @@ do                                                              \
     }                                                           \
   else                                                          \
     {                                                           \
-      yyerror (&yylloc, mc, vm, img_ids, errmsg, YY_("syntax error: cannot back up")); \
+      yyerror (&yylloc, mc, scanner, vm, img_ids, errmsg, YY_("syntax error: cannot back up")); \
       YYERROR;                                                  \
     }                                                           \
 while (0)
@@ -868,7 +877,7 @@ do {                                                                      \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, Location, mc, vm, img_ids, errmsg); \
+                  Type, Value, Location, mc, scanner, vm, img_ids, errmsg); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -879,12 +888,13 @@ do {                                                                      \
 `----------------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, mem_collector *  mc, VirtualMachine * vm, vector<int> *    img_ids, char **          errmsg)
+yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, mem_collector *  mc, yyscan_t         scanner, VirtualMachine * vm, vector<int> *    img_ids, char **          errmsg)
 {
   FILE *yyo = yyoutput;
   YYUSE (yyo);
   YYUSE (yylocationp);
   YYUSE (mc);
+  YYUSE (scanner);
   YYUSE (vm);
   YYUSE (img_ids);
   YYUSE (errmsg);
@@ -903,14 +913,14 @@ yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvalue
 `--------------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, mem_collector *  mc, VirtualMachine * vm, vector<int> *    img_ids, char **          errmsg)
+yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, mem_collector *  mc, yyscan_t         scanner, VirtualMachine * vm, vector<int> *    img_ids, char **          errmsg)
 {
   YYFPRINTF (yyoutput, "%s %s (",
              yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
 
   YY_LOCATION_PRINT (yyoutput, *yylocationp);
   YYFPRINTF (yyoutput, ": ");
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp, mc, vm, img_ids, errmsg);
+  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp, mc, scanner, vm, img_ids, errmsg);
   YYFPRINTF (yyoutput, ")");
 }
 
@@ -943,7 +953,7 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule, mem_collector *  mc, VirtualMachine * vm, vector<int> *    img_ids, char **          errmsg)
+yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule, mem_collector *  mc, yyscan_t         scanner, VirtualMachine * vm, vector<int> *    img_ids, char **          errmsg)
 {
   unsigned long int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
@@ -957,7 +967,7 @@ yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule
       yy_symbol_print (stderr,
                        yystos[yyssp[yyi + 1 - yynrhs]],
                        &(yyvsp[(yyi + 1) - (yynrhs)])
-                       , &(yylsp[(yyi + 1) - (yynrhs)])                       , mc, vm, img_ids, errmsg);
+                       , &(yylsp[(yyi + 1) - (yynrhs)])                       , mc, scanner, vm, img_ids, errmsg);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -965,7 +975,7 @@ yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule
 # define YY_REDUCE_PRINT(Rule)          \
 do {                                    \
   if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, mc, vm, img_ids, errmsg); \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, mc, scanner, vm, img_ids, errmsg); \
 } while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
@@ -1223,11 +1233,12 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, mem_collector *  mc, VirtualMachine * vm, vector<int> *    img_ids, char **          errmsg)
+yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, mem_collector *  mc, yyscan_t         scanner, VirtualMachine * vm, vector<int> *    img_ids, char **          errmsg)
 {
   YYUSE (yyvaluep);
   YYUSE (yylocationp);
   YYUSE (mc);
+  YYUSE (scanner);
   YYUSE (vm);
   YYUSE (img_ids);
   YYUSE (errmsg);
@@ -1248,7 +1259,7 @@ yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocatio
 `----------*/
 
 int
-yyparse (mem_collector *  mc, VirtualMachine * vm, vector<int> *    img_ids, char **          errmsg)
+yyparse (mem_collector *  mc, yyscan_t         scanner, VirtualMachine * vm, vector<int> *    img_ids, char **          errmsg)
 {
 /* The lookahead symbol.  */
 int yychar;
@@ -1442,7 +1453,7 @@ yybackup:
   if (yychar == YYEMPTY)
     {
       YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = yylex (&yylval, &yylloc, mc);
+      yychar = yylex (&yylval, &yylloc, mc, scanner);
     }
 
   if (yychar <= YYEOF)
@@ -1522,7 +1533,7 @@ yyreduce:
   switch (yyn)
     {
         case 4:
-#line 240 "vm_file_var_syntax.y" /* yacc.c:1646  */
+#line 251 "vm_file_var_syntax.y" /* yacc.c:1646  */
     {
         string file((yyvsp[-6].val_str));
         string var1((yyvsp[-4].val_str));
@@ -1540,11 +1551,11 @@ yyreduce:
             YYABORT;
         }
     }
-#line 1544 "vm_file_var_syntax.cc" /* yacc.c:1646  */
+#line 1555 "vm_file_var_syntax.cc" /* yacc.c:1646  */
     break;
 
   case 5:
-#line 258 "vm_file_var_syntax.y" /* yacc.c:1646  */
+#line 269 "vm_file_var_syntax.y" /* yacc.c:1646  */
     {
         string file((yyvsp[-10].val_str));
         string var1((yyvsp[-8].val_str));
@@ -1565,11 +1576,11 @@ yyreduce:
             YYABORT;
         }
     }
-#line 1569 "vm_file_var_syntax.cc" /* yacc.c:1646  */
+#line 1580 "vm_file_var_syntax.cc" /* yacc.c:1646  */
     break;
 
 
-#line 1573 "vm_file_var_syntax.cc" /* yacc.c:1646  */
+#line 1584 "vm_file_var_syntax.cc" /* yacc.c:1646  */
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -1620,7 +1631,7 @@ yyerrlab:
     {
       ++yynerrs;
 #if ! YYERROR_VERBOSE
-      yyerror (&yylloc, mc, vm, img_ids, errmsg, YY_("syntax error"));
+      yyerror (&yylloc, mc, scanner, vm, img_ids, errmsg, YY_("syntax error"));
 #else
 # define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
                                         yyssp, yytoken)
@@ -1647,7 +1658,7 @@ yyerrlab:
                 yymsgp = yymsg;
               }
           }
-        yyerror (&yylloc, mc, vm, img_ids, errmsg, yymsgp);
+        yyerror (&yylloc, mc, scanner, vm, img_ids, errmsg, yymsgp);
         if (yysyntax_error_status == 2)
           goto yyexhaustedlab;
       }
@@ -1671,7 +1682,7 @@ yyerrlab:
       else
         {
           yydestruct ("Error: discarding",
-                      yytoken, &yylval, &yylloc, mc, vm, img_ids, errmsg);
+                      yytoken, &yylval, &yylloc, mc, scanner, vm, img_ids, errmsg);
           yychar = YYEMPTY;
         }
     }
@@ -1728,7 +1739,7 @@ yyerrlab1:
 
       yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, yylsp, mc, vm, img_ids, errmsg);
+                  yystos[yystate], yyvsp, yylsp, mc, scanner, vm, img_ids, errmsg);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -1770,7 +1781,7 @@ yyabortlab:
 | yyexhaustedlab -- memory exhaustion comes here.  |
 `-------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (&yylloc, mc, vm, img_ids, errmsg, YY_("memory exhausted"));
+  yyerror (&yylloc, mc, scanner, vm, img_ids, errmsg, YY_("memory exhausted"));
   yyresult = 2;
   /* Fall through.  */
 #endif
@@ -1782,7 +1793,7 @@ yyreturn:
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval, &yylloc, mc, vm, img_ids, errmsg);
+                  yytoken, &yylval, &yylloc, mc, scanner, vm, img_ids, errmsg);
     }
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
@@ -1791,7 +1802,7 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp, yylsp, mc, vm, img_ids, errmsg);
+                  yystos[*yyssp], yyvsp, yylsp, mc, scanner, vm, img_ids, errmsg);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
@@ -1804,12 +1815,13 @@ yyreturn:
 #endif
   return yyresult;
 }
-#line 279 "vm_file_var_syntax.y" /* yacc.c:1906  */
+#line 290 "vm_file_var_syntax.y" /* yacc.c:1906  */
 
 
 extern "C" void vm_file_var__error(
     YYLTYPE *        llocp,
     mem_collector *  mc,
+    yyscan_t         scanner,
     VirtualMachine * vm,
     vector<int> *    img_ids,
     char **          error_msg,
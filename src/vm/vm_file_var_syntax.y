@@ -40,22 +40,31 @@ extern "C"
 {
     #include "mem_collector.h"
 
+    #ifndef YY_TYPEDEF_YY_SCANNER_T
+    #define YY_TYPEDEF_YY_SCANNER_T
+    typedef void * yyscan_t;
+    #endif
+
     void vm_file_var__error(
         YYLTYPE *        llocp,
         mem_collector *  mc,
+        yyscan_t         scanner,
         VirtualMachine * vm,
         vector<int> *    img_ids,
         char **          errmsg,
         const char *     str);
 
-    int vm_file_var__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc);
+    int vm_file_var__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc,
+                          yyscan_t scanner);
 
     int vm_file_var__parse (mem_collector *  mc,
+                            yyscan_t         scanner,
                             VirtualMachine * vm,
                             vector<int> *    img_ids,
                             char **          errmsg);
 
     int vm_file_var_parse (VirtualMachine * vm,
+                           yyscan_t         scanner,
                            vector<int> *    img_ids,
                            char **          errmsg)
     {
@@ -64,7 +73,7 @@ extern "C"
 
         mem_collector_init(&mc);
 
-        rc = vm_file_var__parse(&mc, vm, img_ids, errmsg);
+        rc = vm_file_var__parse(&mc, scanner, vm, img_ids, errmsg);
 
         mem_collector_cleanup(&mc);
 
@@ -201,11 +210,13 @@ int get_image_path(VirtualMachine * vm,
 %}
 
 %parse-param {mem_collector *  mc}
+%parse-param {yyscan_t         scanner}
 %parse-param {VirtualMachine * vm}
 %parse-param {vector<int> *    img_ids}
 %parse-param {char **          errmsg}
 
 %lex-param {mem_collector * mc}
+%lex-param {yyscan_t        scanner}
 
 %union {
     char * val_str;
@@ -281,6 +292,7 @@ vm_variable:
 extern "C" void vm_file_var__error(
     YYLTYPE *        llocp,
     mem_collector *  mc,
+    yyscan_t         scanner,
     VirtualMachine * vm,
     vector<int> *    img_ids,
     char **          error_msg,
@@ -94,22 +94,31 @@ extern "C"
 {
     #include "mem_collector.h"
 
+    #ifndef YY_TYPEDEF_YY_SCANNER_T
+    #define YY_TYPEDEF_YY_SCANNER_T
+    typedef void * yyscan_t;
+    #endif
+
     void vm_var__error(
         YYLTYPE *        llocp,
         mem_collector *  mc,
+        yyscan_t         scanner,
         VirtualMachine * vm,
         ostringstream *  parsed,
         char **          errmsg,
         const char *     str);
 
-    int vm_var__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc);
+    int vm_var__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc,
+                     yyscan_t scanner);
 
     int vm_var__parse (mem_collector *  mc,
+                       yyscan_t         scanner,
                        VirtualMachine * vm,
                        ostringstream *  parsed,
                        char **          errmsg);
 
     int vm_var_parse (VirtualMachine * vm,
+                      yyscan_t         scanner,
                       ostringstream *  parsed,
                       char **          errmsg)
     {
@@ -118,7 +127,7 @@ extern "C"
 
         mem_collector_init(&mc);
 
-        rc = vm_var__parse(&mc, vm, parsed, errmsg);
+        rc = vm_var__parse(&mc, scanner, vm, parsed, errmsg);
 
         mem_collector_cleanup(&mc);
 
@@ -452,7 +461,7 @@ void insert_vector(VirtualMachine * vm,
 /* -------------------------------------------------------------------------- */
 
 
-#line 456 "vm_var_syntax.cc" /* yacc.c:339  */
+#line 465 "vm_var_syntax.cc" /* yacc.c:339  */
 
 # ifndef YY_NULLPTR
 #  if defined __cplusplus && 201103L <= __cplusplus
@@ -504,13 +513,13 @@ extern int vm_var__debug;
 
 union YYSTYPE
 {
-#line 408 "vm_var_syntax.y" /* yacc.c:355  */
+#line 419 "vm_var_syntax.y" /* yacc.c:355  */
 
     char * val_str;
     int    val_int;
     char   val_char;
 
-#line 514 "vm_var_syntax.cc" /* yacc.c:355  */
+#line 523 "vm_var_syntax.cc" /* yacc.c:355  */
 };
 
 typedef union YYSTYPE YYSTYPE;
@@ -534,13 +543,13 @@ struct YYLTYPE
 
 
 
-int vm_var__parse (mem_collector * mc, VirtualMachine * vm, ostringstream *  parsed, char **          errmsg);
+int vm_var__parse (mem_collector * mc, yyscan_t         scanner, VirtualMachine * vm, ostringstream *  parsed, char **          errmsg);
 
 #endif /* !YY_VM_VAR_VM_VAR_SYNTAX_HH_INCLUDED  */
 
 /* Copy the second part of user declarations.  */
 
-#line 544 "vm_var_syntax.cc" /* yacc.c:358  */
+#line 553 "vm_var_syntax.cc" /* yacc.c:358  */
 
 #ifdef short
 # undef short
@@ -840,7 +849,7 @@ static const yytype_uint8 yytranslate[] =
   /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_uint16 yyrline[] =
 {
-       0,   432,   432,   433,   436,   440,   453,   468
+       0,   443,   443,   444,   447,   451,   464,   479
 };
 #endif
 
@@ -964,7 +973,7 @@ do                                                              \
     }                                                           \
   else                                                          \
     {                                                           \
-      yyerror (&yylloc, mc, vm, parsed, errmsg, YY_("syntax error: cannot back up")); \
+      yyerror (&yylloc, mc, scanner, vm, parsed, errmsg, YY_("syntax error: cannot back up")); \
       YYERROR;                                                  \
     }                                                           \
 while (0)
@@ -1066,7 +1075,7 @@ do {                                                                      \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, Location, mc, vm, parsed, errmsg); \
+                  Type, Value, Location, mc, scanner, vm, parsed, errmsg); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -1077,12 +1086,13 @@ do {                                                                      \
 `----------------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, mem_collector * mc, VirtualMachine * vm, ostringstream *  parsed, char **          errmsg)
+yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, mem_collector * mc, yyscan_t         scanner, VirtualMachine * vm, ostringstream *  parsed, char **          errmsg)
 {
   FILE *yyo = yyoutput;
   YYUSE (yyo);
   YYUSE (yylocationp);
   YYUSE (mc);
+  YYUSE (scanner);
   YYUSE (vm);
   YYUSE (parsed);
   YYUSE (errmsg);
@@ -1101,14 +1111,14 @@ yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvalue
 `--------------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, mem_collector * mc, VirtualMachine * vm, ostringstream *  parsed, char **          errmsg)
+yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, mem_collector * mc, yyscan_t         scanner, VirtualMachine * vm, ostringstream *  parsed, char **          errmsg)
 {
   YYFPRINTF (yyoutput, "%s %s (",
              yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
 
   YY_LOCATION_PRINT (yyoutput, *yylocationp);
   YYFPRINTF (yyoutput, ": ");
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp, mc, vm, parsed, errmsg);
+  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp, mc, scanner, vm, parsed, errmsg);
   YYFPRINTF (yyoutput, ")");
 }
 
@@ -1141,7 +1151,7 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule, mem_collector * mc, VirtualMachine * vm, ostringstream *  parsed, char **          errmsg)
+yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule, mem_collector * mc, yyscan_t         scanner, VirtualMachine * vm, ostringstream *  parsed, char **          errmsg)
 {
   unsigned long int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
@@ -1155,7 +1165,7 @@ yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule
       yy_symbol_print (stderr,
                        yystos[yyssp[yyi + 1 - yynrhs]],
                        &(yyvsp[(yyi + 1) - (yynrhs)])
-                       , &(yylsp[(yyi + 1) - (yynrhs)])                       , mc, vm, parsed, errmsg);
+                       , &(yylsp[(yyi + 1) - (yynrhs)])                       , mc, scanner, vm, parsed, errmsg);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1163,7 +1173,7 @@ yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule
 # define YY_REDUCE_PRINT(Rule)          \
 do {                                    \
   if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, mc, vm, parsed, errmsg); \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, mc, scanner, vm, parsed, errmsg); \
 } while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
@@ -1421,11 +1431,12 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, mem_collector * mc, VirtualMachine * vm, ostringstream *  parsed, char **          errmsg)
+yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, mem_collector * mc, yyscan_t         scanner, VirtualMachine * vm, ostringstream *  parsed, char **          errmsg)
 {
   YYUSE (yyvaluep);
   YYUSE (yylocationp);
   YYUSE (mc);
+  YYUSE (scanner);
   YYUSE (vm);
   YYUSE (parsed);
   YYUSE (errmsg);
@@ -1446,7 +1457,7 @@ yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocatio
 `----------*/
 
 int
-yyparse (mem_collector * mc, VirtualMachine * vm, ostringstream *  parsed, char **          errmsg)
+yyparse (mem_collector * mc, yyscan_t         scanner, VirtualMachine * vm, ostringstream *  parsed, char **          errmsg)
 {
 /* The lookahead symbol.  */
 int yychar;
@@ -1640,7 +1651,7 @@ yybackup:
   if (yychar == YYEMPTY)
     {
       YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = yylex (&yylval, &yylloc, mc);
+      yychar = yylex (&yylval, &yylloc, mc, scanner);
     }
 
   if (yychar <= YYEOF)
@@ -1720,15 +1731,15 @@ yyreduce:
   switch (yyn)
     {
         case 4:
-#line 437 "vm_var_syntax.y" /* yacc.c:1646  */
+#line 448 "vm_var_syntax.y" /* yacc.c:1646  */
     {
         (*parsed) << (yyvsp[0].val_str);
     }
-#line 1728 "vm_var_syntax.cc" /* yacc.c:1646  */
+#line 1739 "vm_var_syntax.cc" /* yacc.c:1646  */
     break;
 
   case 5:
-#line 441 "vm_var_syntax.y" /* yacc.c:1646  */
+#line 452 "vm_var_syntax.y" /* yacc.c:1646  */
     {
         string name((yyvsp[-1].val_str));
 
@@ -1741,11 +1752,11 @@ yyreduce:
             (*parsed) << (yyvsp[0].val_char);
         }
     }
-#line 1745 "vm_var_syntax.cc" /* yacc.c:1646  */
+#line 1756 "vm_var_syntax.cc" /* yacc.c:1646  */
     break;
 
   case 6:
-#line 454 "vm_var_syntax.y" /* yacc.c:1646  */
+#line 465 "vm_var_syntax.y" /* yacc.c:1646  */
     {
         string name((yyvsp[-4].val_str));
         string vname((yyvsp[-2].val_str));
@@ -1760,11 +1771,11 @@ yyreduce:
             (*parsed) << (yyvsp[0].val_char);
         }
     }
-#line 1764 "vm_var_syntax.cc" /* yacc.c:1646  */
+#line 1775 "vm_var_syntax.cc" /* yacc.c:1646  */
     break;
 
   case 7:
-#line 469 "vm_var_syntax.y" /* yacc.c:1646  */
+#line 480 "vm_var_syntax.y" /* yacc.c:1646  */
     {
         string name((yyvsp[-8].val_str));
         string vname((yyvsp[-6].val_str));
@@ -1782,11 +1793,11 @@ yyreduce:
             (*parsed) << (yyvsp[0].val_char);
         }
     }
-#line 1786 "vm_var_syntax.cc" /* yacc.c:1646  */
+#line 1797 "vm_var_syntax.cc" /* yacc.c:1646  */
     break;
 
 
-#line 1790 "vm_var_syntax.cc" /* yacc.c:1646  */
+#line 1801 "vm_var_syntax.cc" /* yacc.c:1646  */
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -1837,7 +1848,7 @@ yyerrlab:
     {
       ++yynerrs;
 #if ! YYERROR_VERBOSE
-      yyerror (&yylloc, mc, vm, parsed, errmsg, YY_("syntax error"));
+      yyerror (&yylloc, mc, scanner, vm, parsed, errmsg, YY_("syntax error"));
 #else
 # define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
                                         yyssp, yytoken)
@@ -1864,7 +1875,7 @@ yyerrlab:
                 yymsgp = yymsg;
               }
           }
-        yyerror (&yylloc, mc, vm, parsed, errmsg, yymsgp);
+        yyerror (&yylloc, mc, scanner, vm, parsed, errmsg, yymsgp);
         if (yysyntax_error_status == 2)
           goto yyexhaustedlab;
       }
@@ -1888,7 +1899,7 @@ yyerrlab:
       else
         {
           yydestruct ("Error: discarding",
-                      yytoken, &yylval, &yylloc, mc, vm, parsed, errmsg);
+                      yytoken, &yylval, &yylloc, mc, scanner, vm, parsed, errmsg);
           yychar = YYEMPTY;
         }
     }
@@ -1945,7 +1956,7 @@ yyerrlab1:
 
       yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, yylsp, mc, vm, parsed, errmsg);
+                  yystos[yystate], yyvsp, yylsp, mc, scanner, vm, parsed, errmsg);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -1987,7 +1998,7 @@ yyabortlab:
 | yyexhaustedlab -- memory exhaustion comes here.  |
 `-------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (&yylloc, mc, vm, parsed, errmsg, YY_("memory exhausted"));
+  yyerror (&yylloc, mc, scanner, vm, parsed, errmsg, YY_("memory exhausted"));
   yyresult = 2;
   /* Fall through.  */
 #endif
@@ -1999,7 +2010,7 @@ yyreturn:
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval, &yylloc, mc, vm, parsed, errmsg);
+                  yytoken, &yylval, &yylloc, mc, scanner, vm, parsed, errmsg);
     }
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
@@ -2008,7 +2019,7 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp, yylsp, mc, vm, parsed, errmsg);
+                  yystos[*yyssp], yyvsp, yylsp, mc, scanner, vm, parsed, errmsg);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
@@ -2021,12 +2032,13 @@ yyreturn:
 #endif
   return yyresult;
 }
-#line 487 "vm_var_syntax.y" /* yacc.c:1906  */
+#line 498 "vm_var_syntax.y" /* yacc.c:1906  */
 
 
 extern "C" void vm_var__error(
     YYLTYPE *        llocp,
     mem_collector *  mc,
+    yyscan_t         scanner,
     VirtualMachine * vm,
     ostringstream *  parsed,
     char **          error_msg,
@@ -39,22 +39,31 @@ extern "C"
 {
     #include "mem_collector.h"
 
+    #ifndef YY_TYPEDEF_YY_SCANNER_T
+    #define YY_TYPEDEF_YY_SCANNER_T
+    typedef void * yyscan_t;
+    #endif
+
     void vm_var__error(
         YYLTYPE *        llocp,
         mem_collector *  mc,
+        yyscan_t         scanner,
         VirtualMachine * vm,
         ostringstream *  parsed,
         char **          errmsg,
         const char *     str);
 
-    int vm_var__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc);
+    int vm_var__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc,
+                     yyscan_t scanner);
 
     int vm_var__parse (mem_collector *  mc,
+                       yyscan_t         scanner,
                        VirtualMachine * vm,
                        ostringstream *  parsed,
                        char **          errmsg);
 
     int vm_var_parse (VirtualMachine * vm,
+                      yyscan_t         scanner,
                       ostringstream *  parsed,
                       char **          errmsg)
     {
@@ -63,7 +72,7 @@ extern "C"
 
         mem_collector_init(&mc);
 
-        rc = vm_var__parse(&mc, vm, parsed, errmsg);
+        rc = vm_var__parse(&mc, scanner, vm, parsed, errmsg);
 
         mem_collector_cleanup(&mc);
 
@@ -399,11 +408,13 @@ void insert_vector(VirtualMachine * vm,
 %}
 
 %parse-param {mem_collector * mc}
+%parse-param {yyscan_t         scanner}
 %parse-param {VirtualMachine * vm}
 %parse-param {ostringstream *  parsed}
 %parse-param {char **          errmsg}
 
 %lex-param {mem_collector * mc}
+%lex-param {yyscan_t        scanner}
 
 %union {
     char * val_str;
@@ -489,6 +500,7 @@ vm_variable:RSTRING
 extern "C" void vm_var__error(
     YYLTYPE *        llocp,
     mem_collector *  mc,
+    yyscan_t         scanner,
     VirtualMachine * vm,
     ostringstream *  parsed,
     char **          error_msg,
@@ -66,6 +66,11 @@ const char * VMTemplate::db_bootstrap =
     "name VARCHAR(128), body MEDIUMTEXT, uid INTEGER, gid INTEGER, "
     "owner_u INTEGER, group_u INTEGER, other_u INTEGER)";
 
+const SqlIndex VMTemplate::db_indexes[] = {
+    {"template_pool_uid_idx",   "template_pool", "uid"},
+    {"template_pool_gid_idx",   "template_pool", "gid"},
+    {0, 0, 0}};
+
 /* ------------------------------------------------------------------------ */
 /* ------------------------------------------------------------------------ */
 
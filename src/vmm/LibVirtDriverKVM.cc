@@ -94,9 +94,18 @@ int LibVirtDriver::deployment_description_kvm(
     int       num;
 
     string  vcpu;
-    float   cpu;
+    float   cpu = 0;
     int     memory;
 
+    vector<const VectorAttribute *> numa_nodes;
+
+    ostringstream  vcpupin;
+    ostringstream  numa_cells;
+    ostringstream  numa_memnodes;
+    vector<string> numa_nodeset;
+    int            vcpu_id = 0;
+    unsigned long  hugepage_size = 0;
+
     string  emulator_path = "";
 
     const VectorAttribute * os;
@@ -153,6 +162,8 @@ int LibVirtDriver::deployment_description_kvm(
 
     int     disk_id;
     int     order;
+    int     iothread;
+    int     virtio_disks            = 0;
     string  default_driver          = "";
     string  default_driver_cache    = "";
     string  default_driver_disk_io  = "";
@@ -180,6 +191,12 @@ int LibVirtDriver::deployment_description_kvm(
     string  default_filter = "";
     string  default_model  = "";
 
+    string  virtio_queues         = "";
+    string  default_virtio_queues = "";
+    string  vhost                 = "";
+    string  default_vhost         = "";
+    int     queues;
+
     const VectorAttribute * graphics;
 
     string  listen        = "";
@@ -211,6 +228,7 @@ int LibVirtDriver::deployment_description_kvm(
     bool localtime          = false;
     bool guest_agent        = false;
     int  virtio_scsi_queues = 0;
+    int  iothreads          = 0;
 
     int pae_found                   = -1;
     int acpi_found                  = -1;
@@ -267,15 +285,103 @@ int LibVirtDriver::deployment_description_kvm(
         file << "\t<vcpu>" << one_util::escape_xml(vcpu) << "</vcpu>" << endl;
     }
 
+    // Dedicated threads for virtio disk I/O, out of the emulator thread
+    features = vm->get_template_attribute("FEATURES");
+
+    if ( features == 0 || features->vector_value("IOTHREADS", iothreads) != 0 )
+    {
+        get_default("FEATURES", "IOTHREADS", iothreads);
+    }
+
+    if ( iothreads > 0 )
+    {
+        file << "\t<iothreads>" << iothreads << "</iothreads>" << endl;
+    }
+
+    // ------------------------------------------------------------------------
+    // NUMA nodes of the VM, placed in the host node assigned by the scheduler
+    // (NODE_ID). Pinned nodes also include the host CPUs (CPUS)
+    //
+    // Note: live migration keeps the domain definition of the source host, so
+    // the pinning assigned in the target host is only applied the next time
+    // the domain is defined (e.g. resume from poweroff or cold migration)
+    // ------------------------------------------------------------------------
+    vm->get_template_attribute("NUMA_NODE", numa_nodes);
+
+    for (vector<const VectorAttribute *>::const_iterator it =
+            numa_nodes.begin(); it != numa_nodes.end(); ++it)
+    {
+        int       node_cpus = 0;
+        long long node_mem  = 0;
+        string    node_id   = (*it)->vector_value("NODE_ID");
+
+        vector<string> host_cpus = one_util::split((*it)->vector_value("CPUS"),
+                ',', true);
+
+        (*it)->vector_value("TOTAL_CPUS", node_cpus);
+        (*it)->vector_value("MEMORY", node_mem);
+        (*it)->vector_value("HUGEPAGE_SIZE", hugepage_size);
+
+        if ( node_id.empty() || node_cpus <= 0 )
+        {
+            continue;
+        }
+
+        int cell_id = it - numa_nodes.begin();
+
+        numa_cells << "\t\t\t<cell id='" << cell_id << "' cpus='" << vcpu_id
+                   << "-" << vcpu_id + node_cpus - 1 << "' memory='"
+                   << node_mem << "' unit='KiB'/>" << endl;
+
+        numa_memnodes << "\t\t<memnode cellid='" << cell_id << "' mode='strict'"
+                      << " nodeset=" << one_util::escape_xml_attr(node_id)
+                      << "/>" << endl;
+
+        numa_nodeset.push_back(node_id);
+
+        for (int i = 0; i < node_cpus; ++i, ++vcpu_id)
+        {
+            if ( host_cpus.size() < (size_t) node_cpus )
+            {
+                continue;
+            }
+
+            vcpupin << "\t\t<vcpupin vcpu='" << vcpu_id << "' cpuset="
+                    << one_util::escape_xml_attr(host_cpus[i]) << "/>" << endl;
+        }
+    }
+
     //Every process gets 1024 shares by default (cgroups), scale this with CPU
-    if(vm->get_template_attribute("CPU", cpu))
+    if(vm->get_template_attribute("CPU", cpu) || !vcpupin.str().empty())
     {
-        file << "\t<cputune>" << endl
-             << "\t\t<shares>"<< ceil( cpu * CGROUP_BASE_CPU_SHARES )
-             << "</shares>"   << endl
+        file << "\t<cputune>" << endl;
+
+        if (cpu > 0)
+        {
+            file << "\t\t<shares>"<< ceil( cpu * CGROUP_BASE_CPU_SHARES )
+                 << "</shares>"   << endl;
+        }
+
+        file << vcpupin.str()
              << "\t</cputune>"<< endl;
     }
 
+    if (!numa_nodeset.empty())
+    {
+        file << "\t<numatune>" << endl
+             << "\t\t<memory mode='strict' nodeset=" << one_util::escape_xml_attr(
+                    one_util::join(numa_nodeset.begin(), numa_nodeset.end(), ','))
+             << "/>" << endl
+             << numa_memnodes.str()
+             << "\t</numatune>" << endl;
+
+        file << "\t<cpu>" << endl
+             << "\t\t<numa>" << endl
+             << numa_cells.str()
+             << "\t\t</numa>" << endl
+             << "\t</cpu>" << endl;
+    }
+
     // Memory must be expressed in Kb
     if (vm->get_template_attribute("MEMORY",memory))
     {
@@ -286,6 +392,17 @@ int LibVirtDriver::deployment_description_kvm(
         goto error_memory;
     }
 
+    // Hugepages reserved by the scheduler in the NUMA nodes (size in KB)
+    if ( hugepage_size > 0 )
+    {
+        file << "\t<memoryBacking>" << endl
+             << "\t\t<hugepages>" << endl
+             << "\t\t\t<page size='" << hugepage_size << "' unit='KiB'/>"
+             << endl
+             << "\t\t</hugepages>" << endl
+             << "\t</memoryBacking>" << endl;
+    }
+
     // ------------------------------------------------------------------------
     //  OS and boot options
     // ------------------------------------------------------------------------
@@ -747,6 +864,21 @@ int LibVirtDriver::deployment_description_kvm(
             file << " discard=" << one_util::escape_xml_attr(default_driver_discard);
         }
 
+        // ---- iothread, only for virtio disks. Round-robin if not set ----
+
+        if ( iothreads > 0 && type != "CDROM" && target.compare(0, 2, "vd") == 0 )
+        {
+            if ( disk[i]->vector_value("IOTHREAD", iothread) != 0 ||
+                 iothread < 1 || iothread > iothreads )
+            {
+                iothread = (virtio_disks % iothreads) + 1;
+            }
+
+            virtio_disks++;
+
+            file << " iothread='" << iothread << "'";
+        }
+
         file << "/>" << endl;
 
         // ---- I/O Options  ----
@@ -859,6 +991,10 @@ int LibVirtDriver::deployment_description_kvm(
 
     get_default("NIC", "MODEL", default_model);
 
+    get_default("NIC", "VIRTIO_QUEUES", default_virtio_queues);
+
+    get_default("NIC", "VHOST", default_vhost);
+
     num = vm->get_template_attribute("NIC", nic);
 
     for(int i=0; i<num; i++)
@@ -871,6 +1007,9 @@ int LibVirtDriver::deployment_description_kvm(
         model  = nic[i]->vector_value("MODEL");
         ip     = nic[i]->vector_value("IP");
         filter = nic[i]->vector_value("FILTER");
+        vhost  = nic[i]->vector_value("VHOST");
+
+        virtio_queues = nic[i]->vector_value("VIRTIO_QUEUES");
 
         vrouter_ip = nic[i]->vector_value("VROUTER_IP");
 
@@ -941,6 +1080,54 @@ int LibVirtDriver::deployment_description_kvm(
                  << one_util::escape_xml_attr(*the_model) << "/>\n";
         }
 
+        // ---- virtio-net backend and multiqueue (AUTO: one queue per VCPU) ----
+
+        if (the_model != 0 && *the_model == "virtio")
+        {
+            if (virtio_queues.empty())
+            {
+                virtio_queues = default_virtio_queues;
+            }
+
+            if (vhost.empty())
+            {
+                vhost = default_vhost;
+            }
+
+            one_util::toupper(virtio_queues);
+            one_util::toupper(vhost);
+
+            if (virtio_queues == "AUTO")
+            {
+                queues = atoi(vcpu.c_str());
+            }
+            else
+            {
+                queues = atoi(virtio_queues.c_str());
+            }
+
+            if ( queues > 1 || !vhost.empty() )
+            {
+                file << "\t\t\t<driver name=";
+
+                if ( vhost == "NO" )
+                {
+                    file << "'qemu'";
+                }
+                else
+                {
+                    file << "'vhost'";
+                }
+
+                if ( queues > 1 )
+                {
+                    file << " queues='" << queues << "'";
+                }
+
+                file << "/>\n";
+            }
+        }
+
         if (!ip.empty() )
         {
             string * the_filter = 0;
@@ -34,12 +34,14 @@ VirtualMachineManager::VirtualMachineManager(
     time_t                          _poll_period,
     bool                            _do_vm_poll,
     int                             _vm_limit,
-    vector<const VectorAttribute*>&       _mads):
+    vector<const VectorAttribute*>&       _mads,
+    unsigned int                    num_threads):
         MadManager(_mads),
         timer_period(_timer_period),
         poll_period(_poll_period),
         do_vm_poll(_do_vm_poll),
-        vm_limit(_vm_limit)
+        vm_limit(_vm_limit),
+        am(num_threads)
 {
     Nebula& nd = Nebula::instance();
 
@@ -288,7 +290,7 @@ string * VirtualMachineManager::format_message(
         << ds_tmpl
         << "</VMM_DRIVER_ACTION_DATA>";
 
-    return one_util::base64_encode(oss.str());
+    return new string(oss.str());
 }
 
 static int do_context_command(VirtualMachine * vm, const string& password,
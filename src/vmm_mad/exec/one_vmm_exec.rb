@@ -313,7 +313,8 @@ class ExecDriver < VirtualMachineDriver
     # @param [OpenNebulaDriver::options]
     def initialize(hypervisor, options={})
         @options={
-            :threaded => true
+            :threaded => true,
+            :framed   => true
         }.merge!(options)
 
         if options[:shell]
@@ -669,7 +670,7 @@ class ExecDriver < VirtualMachineDriver
                         :disk_target_path,
                         target,
                         target_index,
-                        drv_message
+                        encode(drv_message)
                 ],
                 :fail_actions => [
                     {
@@ -813,7 +814,7 @@ class ExecDriver < VirtualMachineDriver
                         :deploy_id,
                         disk_id,
                         size,
-                        drv_message,
+                        encode(drv_message),
                         :host
                 ]
             }
@@ -547,8 +547,8 @@ void AddressRange::addr_to_xml(unsigned int index, unsigned int rsize,
 
 void AddressRange::to_xml(ostringstream &oss) const
 {
-    const map<string,string>& ar_attrs = attr->value();
-    map<string,string>::const_iterator it;
+    const FlatMap<string,string>& ar_attrs = attr->value();
+    FlatMap<string,string>::const_iterator it;
 
     unsigned int mac_end[2];
 
@@ -635,8 +635,8 @@ void AddressRange::to_xml(ostringstream &oss) const
 void AddressRange::to_xml(ostringstream &oss, const vector<int>& vms,
         const vector<int>& vns, const vector<int>& vrs) const
 {
-    const map<string,string>&          ar_attrs = attr->value();
-    map<string,string>::const_iterator it;
+    const FlatMap<string,string>&          ar_attrs = attr->value();
+    FlatMap<string,string>::const_iterator it;
 
     int          rc;
     unsigned int mac_end[2];
@@ -1982,8 +1982,8 @@ bool AddressRange::check(string& rs_attr) const
         return false;
     }
 
-    const map<string,string>& ar_attrs = attr->value();
-    map<string,string>::const_iterator it;
+    const FlatMap<string,string>& ar_attrs = attr->value();
+    FlatMap<string,string>::const_iterator it;
 
     for (it=ar_attrs.begin(); it != ar_attrs.end(); it++)
     {
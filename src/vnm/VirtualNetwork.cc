@@ -98,6 +98,11 @@ const char * VirtualNetwork::db_bootstrap = "CREATE TABLE IF NOT EXISTS"
     " owner_u INTEGER, group_u INTEGER, other_u INTEGER,"
     " pid INTEGER, UNIQUE(name,uid))";
 
+const SqlIndex VirtualNetwork::db_indexes[] = {
+    {"network_pool_uid_idx",    "network_pool", "uid"},
+    {"network_pool_gid_idx",    "network_pool", "gid"},
+    {0, 0, 0}};
+
 /* -------------------------------------------------------------------------- */
 /* -------------------------------------------------------------------------- */
 
@@ -458,17 +458,26 @@ int ObjectXML::rename_nodes(const char * xpath_expr, const char * new_name)
 
 extern "C"
 {
+    #ifndef YY_TYPEDEF_YY_SCANNER_T
+    #define YY_TYPEDEF_YY_SCANNER_T
+    typedef void * yyscan_t;
+    #endif
+
     typedef struct yy_buffer_state * YY_BUFFER_STATE;
 
-    int expr_bool_parse(ObjectXML * oxml, bool& result, char ** errmsg);
+    int expr_bool_parse(ObjectXML * oxml, bool& result, yyscan_t scanner,
+                        char ** errmsg);
+
+    int expr_arith_parse(ObjectXML * oxml, int& result, yyscan_t scanner,
+                         char ** errmsg);
 
-    int expr_arith_parse(ObjectXML * oxml, int& result, char ** errmsg);
+    int expr_lex_init(yyscan_t * scanner);
 
-    int expr_lex_destroy();
+    int expr_lex_destroy(yyscan_t scanner);
 
-    YY_BUFFER_STATE expr__scan_string(const char * str);
+    YY_BUFFER_STATE expr__scan_string(const char * str, yyscan_t scanner);
 
-    void expr__delete_buffer(YY_BUFFER_STATE);
+    void expr__delete_buffer(YY_BUFFER_STATE, yyscan_t scanner);
 }
 
 /* ------------------------------------------------------------------------ */
@@ -476,34 +485,35 @@ extern "C"
 
 int ObjectXML::eval_bool(const string& expr, bool& result, char **errmsg)
 {
-    YY_BUFFER_STATE     str_buffer = 0;
-    const char *        str;
-    int                 rc;
+    YY_BUFFER_STATE str_buffer = 0;
+    yyscan_t        scanner;
+    int             rc;
 
     *errmsg = 0;
 
-    str = expr.c_str();
+    if ( expr_lex_init(&scanner) != 0 )
+    {
+        *errmsg = strdup("Error initializing expression scanner");
+        return -1;
+    }
 
-    str_buffer = expr__scan_string(str);
+    str_buffer = expr__scan_string(expr.c_str(), scanner);
 
     if (str_buffer == 0)
     {
-        goto error_yy;
+        expr_lex_destroy(scanner);
+
+        *errmsg = strdup("Error setting scan buffer");
+        return -1;
     }
 
-    rc = expr_bool_parse(this,result,errmsg);
+    rc = expr_bool_parse(this, result, scanner, errmsg);
 
-    expr__delete_buffer(str_buffer);
+    expr__delete_buffer(str_buffer, scanner);
 
-    expr_lex_destroy();
+    expr_lex_destroy(scanner);
 
     return rc;
-
-error_yy:
-
-    *errmsg=strdup("Error setting scan buffer");
-
-    return -1;
 }
 
 /* ------------------------------------------------------------------------ */
@@ -511,34 +521,35 @@ error_yy:
 
 int ObjectXML::eval_arith(const string& expr, int& result, char **errmsg)
 {
-    YY_BUFFER_STATE     str_buffer = 0;
-    const char *        str;
-    int                 rc;
+    YY_BUFFER_STATE str_buffer = 0;
+    yyscan_t        scanner;
+    int             rc;
 
     *errmsg = 0;
 
-    str = expr.c_str();
+    if ( expr_lex_init(&scanner) != 0 )
+    {
+        *errmsg = strdup("Error initializing expression scanner");
+        return -1;
+    }
 
-    str_buffer = expr__scan_string(str);
+    str_buffer = expr__scan_string(expr.c_str(), scanner);
 
     if (str_buffer == 0)
     {
-        goto error_yy;
+        expr_lex_destroy(scanner);
+
+        *errmsg = strdup("Error setting scan buffer");
+        return -1;
     }
 
-    rc = expr_arith_parse(this,result,errmsg);
+    rc = expr_arith_parse(this, result, scanner, errmsg);
 
-    expr__delete_buffer(str_buffer);
+    expr__delete_buffer(str_buffer, scanner);
 
-    expr_lex_destroy();
+    expr_lex_destroy(scanner);
 
     return rc;
-
-error_yy:
-
-    *errmsg=strdup("Error setting scan buffer");
-
-    return -1;
 }
 
 /* ------------------------------------------------------------------------ */
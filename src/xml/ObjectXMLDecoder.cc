@@ -0,0 +1,290 @@
+/* -------------------------------------------------------------------------- */
+/* Copyright 2002-2017, OpenNebula Project, OpenNebula Systems                */
+/*                                                                            */
+/* Licensed under the Apache License, Version 2.0 (the "License"); you may    */
+/* not use this file except in compliance with the License. You may obtain    */
+/* a copy of the License at                                                   */
+/*                                                                            */
+/* http://www.apache.org/licenses/LICENSE-2.0                                 */
+/*                                                                            */
+/* Unless required by applicable law or agreed to in writing, software        */
+/* distributed under the License is distributed on an "AS IS" BASIS,          */
+/* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   */
+/* See the License for the specific language governing permissions and        */
+/* limitations under the License.                                             */
+/* -------------------------------------------------------------------------- */
+
+#include "ObjectXMLDecoder.h"
+
+#include <stdlib.h>
+#include <errno.h>
+#include <limits.h>
+
+using namespace std;
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+int ObjectXMLDecoder::decode(const xmlNodePtr root)
+{
+    vector<Binding>::iterator it;
+
+    int rc = 0;
+
+    pending = bindings.size();
+
+    if ( root != 0 && root->type == XML_ELEMENT_NODE )
+    {
+        string path = "/";
+
+        path.append(reinterpret_cast<const char *>(root->name));
+
+        if ( is_prefix(path) )
+        {
+            visit(root, path);
+        }
+    }
+
+    for (it = bindings.begin(); it != bindings.end(); ++it)
+    {
+        if ( it->type == SCALAR && (!it->done || it->failed) )
+        {
+            rc--;
+        }
+    }
+
+    return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void ObjectXMLDecoder::visit(const xmlNodePtr node, string& path)
+{
+    vector<Binding>::iterator it;
+
+    size_t path_len = path.size();
+
+    for (xmlNodePtr child = node->children; child != 0 && pending > 0;
+            child = child->next)
+    {
+        if ( child->type != XML_ELEMENT_NODE )
+        {
+            continue;
+        }
+
+        path.append(1, '/');
+        path.append(reinterpret_cast<const char *>(child->name));
+
+        for (it = bindings.begin(); it != bindings.end(); ++it)
+        {
+            if ( it->done || it->path != path )
+            {
+                continue;
+            }
+
+            if ( it->type == NODE )
+            {
+                *static_cast<xmlNodePtr *>(it->value) = child;
+
+                it->done = true;
+                pending--;
+
+                continue;
+            }
+
+            xmlChar *    alloc = 0;
+            const char * str   = content(child, &alloc);
+
+            int rc = it->setter(str, it->value);
+
+            xmlFree(alloc);
+
+            // Only the first element is used, as in ObjectXML::xpath()
+            if ( it->type == SCALAR )
+            {
+                it->done   = true;
+                it->failed = rc != 0;
+
+                pending--;
+            }
+        }
+
+        if ( is_prefix(path) )
+        {
+            visit(child, path);
+        }
+
+        path.resize(path_len);
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+bool ObjectXMLDecoder::is_prefix(const string& path) const
+{
+    vector<Binding>::const_iterator it;
+
+    size_t len = path.size();
+
+    for (it = bindings.begin(); it != bindings.end(); ++it)
+    {
+        if ( !it->done && it->path.size() > len && it->path[len] == '/' &&
+                it->path.compare(0, len, path) == 0 )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+const char * ObjectXMLDecoder::content(const xmlNodePtr node, xmlChar ** alloc)
+{
+    xmlNodePtr child = node->children;
+
+    *alloc = 0;
+
+    if ( child == 0 )
+    {
+        return "";
+    }
+
+    if ( child->next == 0 && (child->type == XML_TEXT_NODE ||
+            child->type == XML_CDATA_SECTION_NODE) && child->content != 0 )
+    {
+        return reinterpret_cast<const char *>(child->content);
+    }
+
+    *alloc = xmlNodeGetContent(node);
+
+    if ( *alloc == 0 )
+    {
+        return "";
+    }
+
+    return reinterpret_cast<const char *>(*alloc);
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+int ObjectXMLDecoder::to_value(const char * str, long long& value)
+{
+    char * end;
+
+    errno = 0;
+
+    long long val = strtoll(str, &end, 10);
+
+    if ( end == str || errno != 0 )
+    {
+        return -1;
+    }
+
+    value = val;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int ObjectXMLDecoder::to_value(const char * str, long& value)
+{
+    long long val;
+
+    if ( to_value(str, val) != 0 || val < LONG_MIN || val > LONG_MAX )
+    {
+        return -1;
+    }
+
+    value = val;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int ObjectXMLDecoder::to_value(const char * str, int& value)
+{
+    long long val;
+
+    if ( to_value(str, val) != 0 || val < INT_MIN || val > INT_MAX )
+    {
+        return -1;
+    }
+
+    value = val;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int ObjectXMLDecoder::to_value(const char * str, unsigned int& value)
+{
+    char * end;
+
+    errno = 0;
+
+    unsigned long long val = strtoull(str, &end, 10);
+
+    if ( end == str || errno != 0 || val > UINT_MAX )
+    {
+        return -1;
+    }
+
+    value = val;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int ObjectXMLDecoder::to_value(const char * str, float& value)
+{
+    char * end;
+
+    errno = 0;
+
+    float val = strtof(str, &end);
+
+    if ( end == str || errno != 0 )
+    {
+        return -1;
+    }
+
+    value = val;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int ObjectXMLDecoder::to_value(const char * str, string& value)
+{
+    value = str;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------- */
+
+int ObjectXMLDecoder::set_string(const char * str, void * value)
+{
+    *static_cast<string *>(value) = str;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int ObjectXMLDecoder::add_string(const char * str, void * value)
+{
+    static_cast<vector<string> *>(value)->push_back(str);
+
+    return 0;
+}
@@ -36,29 +36,38 @@ extern "C"
 {
     #include "mem_collector.h"
 
+    #ifndef YY_TYPEDEF_YY_SCANNER_T
+    #define YY_TYPEDEF_YY_SCANNER_T
+    typedef void * yyscan_t;
+    #endif
+
     void expr_arith__error(
         YYLTYPE *       llocp,
         mem_collector * mc,
+        yyscan_t        scanner,
         ObjectXML *     oxml,
         int&            result,
         char **         error_msg,
         const char *    str);
 
-    int expr_arith__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc);
+    int expr_arith__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc,
+                         yyscan_t scanner);
 
     int expr_arith__parse(mem_collector * mc,
+                      yyscan_t        scanner,
                           ObjectXML *     oxml,
                           int&            result,
                           char **         errmsg);
 
-    int expr_arith_parse(ObjectXML *oxml, int& result, char ** errmsg)
+    int expr_arith_parse(ObjectXML *oxml, int& result, yyscan_t scanner,
+                         char ** errmsg)
     {
         mem_collector mc;
         int           rc;
 
         mem_collector_init(&mc);
 
-        rc = expr_arith__parse(&mc,oxml,result,errmsg);
+        rc = expr_arith__parse(&mc,scanner,oxml,result,errmsg);
 
         mem_collector_cleanup(&mc);
 
@@ -69,11 +78,13 @@ extern "C"
 %}
 
 %parse-param {mem_collector * mc}
+%parse-param {yyscan_t        scanner}
 %parse-param {ObjectXML * oxml}
 %parse-param {int&        result}
 %parse-param {char **     error_msg}
 
 %lex-param {mem_collector * mc}
+%lex-param {yyscan_t        scanner}
 
 %union {
     char *  val_str;
@@ -117,6 +128,7 @@ expr:   STRING              { float val; oxml->search($1, val); $$ = val; }
 extern "C" void expr_arith__error(
     YYLTYPE *       llocp,
     mem_collector * mc,
+    yyscan_t        scanner,
     ObjectXML *     oxml,
     int&            result,
     char **         error_msg,
@@ -36,29 +36,38 @@ extern "C"
 {
     #include "mem_collector.h"
 
+    #ifndef YY_TYPEDEF_YY_SCANNER_T
+    #define YY_TYPEDEF_YY_SCANNER_T
+    typedef void * yyscan_t;
+    #endif
+
     void expr_bool__error(
         YYLTYPE *       llocp,
         mem_collector * mc,
+        yyscan_t        scanner,
         ObjectXML *     oxml,
         bool&           result,
         char **         error_msg,
         const char *    str);
 
-    int expr_bool__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc);
+    int expr_bool__lex (YYSTYPE *lvalp, YYLTYPE *llocp, mem_collector * mc,
+                        yyscan_t scanner);
 
     int expr_bool__parse(mem_collector * mc,
+                     yyscan_t        scanner,
                          ObjectXML *     oxml,
                          bool&           result,
                          char **         errmsg);
 
-    int expr_bool_parse(ObjectXML *oxml, bool& result, char ** errmsg)
+    int expr_bool_parse(ObjectXML *oxml, bool& result, yyscan_t scanner,
+                        char ** errmsg)
     {
         mem_collector mc;
         int           rc;
 
         mem_collector_init(&mc);
 
-        rc = expr_bool__parse(&mc,oxml,result,errmsg);
+        rc = expr_bool__parse(&mc,scanner,oxml,result,errmsg);
 
         mem_collector_cleanup(&mc);
 
@@ -68,11 +77,13 @@ extern "C"
 %}
 
 %parse-param {mem_collector * mc}
+%parse-param {yyscan_t        scanner}
 %parse-param {ObjectXML *     oxml}
 %parse-param {bool&           result}
 %parse-param {char **         error_msg}
 
 %lex-param {mem_collector * mc}
+%lex-param {yyscan_t        scanner}
 
 %union {
     char *  val_str;
@@ -242,6 +253,7 @@ expr:   STRING '=' INTEGER {
 extern "C" void expr_bool__error(
     YYLTYPE *       llocp,
     mem_collector * mc,
+    yyscan_t        scanner,
     ObjectXML *     oxml,
     bool&           result,
     char **         error_msg,